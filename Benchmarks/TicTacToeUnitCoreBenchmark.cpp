@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitCore.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace Core = TicTacToeUnitCore;
+
+namespace TicTacToeUnitCoreBenchmark
+{
+	// Log-uniform magnitudes over 1e-6..1e9 with random signs, fixed seed so runs compare
+	std::vector<double> MakeValues(size_t Count)
+	{
+		std::mt19937_64 Random(1);
+		std::uniform_real_distribution<double> Exponent(-6.0, 9.0);
+		std::bernoulli_distribution Negative(0.5);
+
+		std::vector<double> Values(Count);
+		for (double& Value : Values) Value = (Negative(Random) ? -1.0 : 1.0) * std::pow(10.0, Exponent(Random));
+		return Values;
+	}
+
+	constexpr size_t NumValues = 4096;
+}
+
+using namespace TicTacToeUnitCoreBenchmark;
+
+// --- --- CONVERSIONS --- --- //
+
+static void BM_ConvertLength(benchmark::State& State)
+{
+	const std::vector<double> Values = MakeValues(NumValues);
+	for (auto _ : State)
+	{
+		for (const double Value : Values)
+			benchmark::DoNotOptimize(Core::Convert(Core::LengthToM, Value, uint8_t(Core::ELength::US_MILE), uint8_t(Core::ELength::MET_KM)));
+	}
+	State.SetItemsProcessed(int64_t(State.iterations()) * int64_t(Values.size()));
+}
+BENCHMARK(BM_ConvertLength);
+
+static void BM_ConvertTemperature(benchmark::State& State)
+{
+	const std::vector<double> Values = MakeValues(NumValues);
+	for (auto _ : State)
+	{
+		for (const double Value : Values)
+			benchmark::DoNotOptimize(Core::ConvertTemperature(Value, Core::ETemperature::CEL, Core::ETemperature::FAR));
+	}
+	State.SetItemsProcessed(int64_t(State.iterations()) * int64_t(Values.size()));
+}
+BENCHMARK(BM_ConvertTemperature);
+
+static void BM_ConvertEngineSpeed(benchmark::State& State)
+{
+	const std::vector<double> Values = MakeValues(NumValues);
+	for (auto _ : State)
+	{
+		for (const double Value : Values)
+			benchmark::DoNotOptimize(Core::ConvertEngineSpeed(Value, Core::EEngineSpeed::KM_H));
+	}
+	State.SetItemsProcessed(int64_t(State.iterations()) * int64_t(Values.size()));
+}
+BENCHMARK(BM_ConvertEngineSpeed);
+
+// --- --- AUTO UNITS --- --- //
+
+static void BM_SelectPrefix(benchmark::State& State)
+{
+	const std::vector<double> Values = MakeValues(NumValues);
+	for (auto _ : State)
+	{
+		for (const double Value : Values)
+			benchmark::DoNotOptimize(Core::SelectPrefix(Value));
+	}
+	State.SetItemsProcessed(int64_t(State.iterations()) * int64_t(Values.size()));
+}
+BENCHMARK(BM_SelectPrefix);
+
+static void BM_GetAutoLength(benchmark::State& State)
+{
+	const std::vector<double> Values = MakeValues(NumValues);
+	for (auto _ : State)
+	{
+		for (const double Value : Values)
+			benchmark::DoNotOptimize(Core::GetAutoLength(Value, Core::EAutoSystem::Metric));
+	}
+	State.SetItemsProcessed(int64_t(State.iterations()) * int64_t(Values.size()));
+}
+BENCHMARK(BM_GetAutoLength);
+
+static void BM_GetAutoDataSize(benchmark::State& State)
+{
+	const std::vector<double> Values = MakeValues(NumValues);
+	for (auto _ : State)
+	{
+		for (const double Value : Values)
+			benchmark::DoNotOptimize(Core::GetAutoDataSize(Value, Core::EAutoData::Binary, true));
+	}
+	State.SetItemsProcessed(int64_t(State.iterations()) * int64_t(Values.size()));
+}
+BENCHMARK(BM_GetAutoDataSize);
+
+// --- --- FORMATTING --- --- //
+
+static void BM_FormatNumberFixed(benchmark::State& State)
+{
+	const std::vector<double> Values = MakeValues(NumValues);
+	const int32_t Digits = int32_t(State.range(0));
+	for (auto _ : State)
+	{
+		for (const double Value : Values)
+			benchmark::DoNotOptimize(Core::FormatNumber(Value, Digits, false, true));
+	}
+	State.SetItemsProcessed(int64_t(State.iterations()) * int64_t(Values.size()));
+}
+BENCHMARK(BM_FormatNumberFixed)->Arg(0)->Arg(2)->Arg(6);
+
+static void BM_FormatNumberNotation(benchmark::State& State)
+{
+	const std::vector<double> Values = MakeValues(NumValues);
+	const Core::ENotation Notation = Core::ENotation(State.range(0));
+	for (auto _ : State)
+	{
+		for (const double Value : Values)
+			benchmark::DoNotOptimize(Core::FormatNumber(Value, Notation, 4));
+	}
+	State.SetItemsProcessed(int64_t(State.iterations()) * int64_t(Values.size()));
+}
+BENCHMARK(BM_FormatNumberNotation)->Arg(int64_t(Core::ENotation::Significant))->Arg(int64_t(Core::ENotation::Engineering));
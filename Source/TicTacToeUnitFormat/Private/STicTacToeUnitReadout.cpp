@@ -0,0 +1,303 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "STicTacToeUnitReadout.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Internationalization/FastDecimalFormat.h"
+#include "Rendering/DrawElements.h"
+#include "Rendering/SlateRenderer.h"
+#include "TicTacToeUnitCore.h"
+#include "TicTacToeUnitDisplayStrings.h"
+#include "TicTacToeUnitQuantity.h"
+
+namespace Core = TicTacToeUnitCore;
+
+void STicTacToeUnitReadout::Construct(const FArguments& InArgs)
+{
+	Value = InArgs._Value;
+	Format = InArgs._Format;
+	Font = InArgs._Font;
+	ColorAndOpacity = InArgs._ColorAndOpacity;
+
+	FInternationalization::Get().OnCultureChanged().AddSP(this, &STicTacToeUnitReadout::HandleCultureChanged);
+
+	UpdateDisplayString();
+}
+
+void STicTacToeUnitReadout::SetValue(double InValue)
+{
+	if (Value == InValue) return;
+
+	Value = InValue;
+	InvalidateDisplay(UpdateDisplayString());
+}
+
+void STicTacToeUnitReadout::SetFormat(const FTicTacToeReadoutFormat& InFormat)
+{
+	// Suffixes of another family or time unit have to be shaped again
+	const bool bSuffixesChanged = Format.Family != InFormat.Family || Format.PerTime != InFormat.PerTime || Format.ToTimeUnit != InFormat.ToTimeUnit;
+
+	Format = InFormat;
+	if (bSuffixesChanged) ResetGlyphCache();
+
+	InvalidateDisplay(UpdateDisplayString() || bSuffixesChanged);
+}
+
+void STicTacToeUnitReadout::SetFont(const FSlateFontInfo& InFont)
+{
+	if (Font.IsIdenticalTo(InFont)) return;
+
+	Font = InFont;
+	ResetGlyphCache();
+	Invalidate(EInvalidateWidgetReason::Layout);
+}
+
+void STicTacToeUnitReadout::SetColorAndOpacity(const TAttribute<FSlateColor>& InColorAndOpacity)
+{
+	ColorAndOpacity = InColorAndOpacity;
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+bool STicTacToeUnitReadout::UpdateDisplayString()
+{
+	using Library = UTicTacToeUnitFormatBPLibrary;
+
+	double value_converted = 0.0;
+	const FText* unit_string = nullptr;
+	const FText* time_string = nullptr;
+
+	if (Format.PerTime && Format.Family == EUnitFamily::UF_LENGTH)
+	{
+		const double speed_meters = Library::ConvertSpeed(Value, (ELengthUnit)Format.FromUnit, ELengthUnit::LU_MET_M, Format.FromTimeUnit, Format.ToTimeUnit);
+		const ELengthUnit target_unit = (ELengthUnit)Library::GetDisplayUnit(speed_meters, EUnitFamily::UF_LENGTH, (uint8)ELengthUnit::LU_MET_M, Format.ToUnit, Format.AutoUnit, Format.UseExtendedAutoUnits);
+
+		value_converted = Library::ConvertSpeed(Value, (ELengthUnit)Format.FromUnit, target_unit, Format.FromTimeUnit, Format.ToTimeUnit);
+		unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+		time_string = FTicTacToeUnitDisplayStrings::Find(Format.ToTimeUnit);
+	}
+	else
+	{
+		const uint8 target_unit = Library::GetDisplayUnit(Value, Format.Family, Format.FromUnit, Format.ToUnit, Format.AutoUnit, Format.UseExtendedAutoUnits);
+
+		value_converted = Library::ConvertUnit(Value, Format.Family, Format.FromUnit, target_unit);
+		unit_string = FTicTacToeUnitDisplayStrings::Find(Format.Family, target_unit);
+	}
+
+	FString NewSuffix;
+	if (unit_string) NewSuffix = time_string ? unit_string->ToString() + TEXT("/") + time_string->ToString() : unit_string->ToString();
+
+	// Significant and engineering notation print the mantissa with a fixed number of fractional digits and an exponent,
+	// as FormatNotation does
+	double number_value = value_converted;
+	int32 min_fractional_digits = Format.StableWidth > 0 ? Format.Precision : 0;
+	int32 max_fractional_digits = Format.Precision;
+	FString exponent_string;
+
+	if (Format.Notation != ENumberNotation::NN_FIXED && FMath::IsFinite(value_converted))
+	{
+		const Core::FNotationDigits notation_digits = Core::GetNotationDigits(value_converted, (Core::ENotation)Format.Notation, Format.Precision);
+		number_value = Core::GetNotationMantissa(value_converted, notation_digits);
+		min_fractional_digits = max_fractional_digits = notation_digits.FractionalDigits;
+		if (notation_digits.Exponent != 0) exponent_string = FString::Printf(TEXT("e%d"), notation_digits.Exponent);
+	}
+
+	// Same options as UKismetTextLibrary::Conv_DoubleToText in the Format functions, without building an FText
+	FNumberFormattingOptions Options;
+	Options.SetAlwaysSign(Format.ForceSign)
+		.SetUseGrouping(Format.UseGrouping)
+		.SetRoundingMode(ERoundingMode::HalfToEven)
+		.SetMinimumIntegralDigits(1)
+		.SetMaximumIntegralDigits(324)
+		.SetMinimumFractionalDigits(min_fractional_digits)
+		.SetMaximumFractionalDigits(max_fractional_digits);
+
+	FString NewNumber = unit_string
+		? FastDecimalFormat::NumberToString(number_value, FInternationalization::Get().GetCurrentLocale()->GetDecimalNumberFormattingRules(), Options) + exponent_string
+		: FString();
+
+	// Figure spaces as in UTicTacToeUnitFormatBPLibrary::PadValue, the suffix slot of a speed holds both suffixes
+	if (unit_string && Format.StableWidth > 0)
+	{
+		const int32 suffix_slot = time_string
+			? Library::GetStableSuffixWidth(EUnitFamily::UF_LENGTH) + 1 + Library::GetStableSuffixWidth(EUnitFamily::UF_TIME)
+			: Library::GetStableSuffixWidth(Format.Family);
+
+		NewNumber = FString::ChrN(FMath::Max(Format.StableWidth - suffix_slot - NewNumber.Len(), 0), TEXT('\u2007')) + NewNumber;
+		NewSuffix += FString::ChrN(FMath::Max(suffix_slot - NewSuffix.Len(), 0), TEXT('\u2007'));
+	}
+
+	if (NewNumber == NumberString && NewSuffix == SuffixString) return false;
+
+	NumberString = MoveTemp(NewNumber);
+	SuffixString = MoveTemp(NewSuffix);
+	DisplayString = NumberString + SuffixString;
+	bSequenceDirty = true;
+	return true;
+}
+
+void STicTacToeUnitReadout::ResetGlyphCache()
+{
+	CharacterRuns.Reset();
+	SuffixRuns.Reset();
+	CachedScale = 0.0f;
+	Sequence.Reset();
+	bSequenceDirty = true;
+}
+
+void STicTacToeUnitReadout::ShapeGlyphCache(float Scale) const
+{
+	CharacterRuns.Reset();
+	SuffixRuns.Reset();
+	CachedScale = Scale;
+	TextBaseline = 0;
+	MaxTextHeight = 0;
+
+	const FDecimalNumberFormattingRules& Rules = FInternationalization::Get().GetCurrentLocale()->GetDecimalNumberFormattingRules();
+
+	for (TCHAR Digit : Rules.DigitCharacters)
+	{
+		FindOrShapeRun(Digit);
+	}
+	FindOrShapeRun(Rules.DecimalSeparatorCharacter);
+	FindOrShapeRun(Rules.GroupingSeparatorCharacter);
+	for (TCHAR Character : Rules.PlusString + Rules.MinusString)
+	{
+		FindOrShapeRun(Character);
+	}
+
+	// Exponents of the notations and the figure spaces of StableWidth
+	for (TCHAR Character : FString(TEXT("e-0123456789\u2007")))
+	{
+		FindOrShapeRun(Character);
+	}
+
+	// Every suffix the auto units can switch to
+	const FText* time_string = Format.PerTime ? FTicTacToeUnitDisplayStrings::Find(Format.ToTimeUnit) : nullptr;
+	for (int32 Unit = 0; Unit < (1 << FTicTacToeQuantity::UnitBits); ++Unit)
+	{
+		if (const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(Format.Family, (uint8)Unit))
+		{
+			FindOrShapeRun(time_string ? unit_string->ToString() + TEXT("/") + time_string->ToString() : unit_string->ToString());
+		}
+	}
+}
+
+STicTacToeUnitReadout::FGlyphRun STicTacToeUnitReadout::ShapeRun(const FString& Token) const
+{
+	const TSharedRef<FSlateFontCache> FontCache = FSlateApplication::Get().GetRenderer()->GetFontCache();
+	const FShapedGlyphSequenceRef Shaped = FontCache->ShapeBidirectionalText(Token, Font, CachedScale, TextBiDi::ETextDirection::LeftToRight, GetDefaultTextShapingMethod());
+
+	TextBaseline = FMath::Min(TextBaseline, Shaped->GetTextBaseline());
+	MaxTextHeight = FMath::Max(MaxTextHeight, Shaped->GetMaxTextHeight());
+
+	FGlyphRun Run;
+	Run.Glyphs = Shaped->GetGlyphsToRender();
+	Run.NumCharacters = Token.Len();
+	return Run;
+}
+
+const STicTacToeUnitReadout::FGlyphRun& STicTacToeUnitReadout::FindOrShapeRun(TCHAR Character) const
+{
+	if (const FGlyphRun* Run = CharacterRuns.Find(Character)) return *Run;
+	return CharacterRuns.Add(Character, ShapeRun(FString(1, &Character)));
+}
+
+const STicTacToeUnitReadout::FGlyphRun& STicTacToeUnitReadout::FindOrShapeRun(const FString& Suffix) const
+{
+	if (const FGlyphRun* Run = SuffixRuns.Find(Suffix)) return *Run;
+	return SuffixRuns.Add(Suffix, ShapeRun(Suffix));
+}
+
+void STicTacToeUnitReadout::BuildSequence() const
+{
+	bSequenceDirty = false;
+
+	TArray<FShapedGlyphEntry> Glyphs;
+	Glyphs.Reserve(DisplayString.Len());
+
+	int32 SourceIndex = 0;
+	auto AppendRun = [&Glyphs, &SourceIndex](const FGlyphRun& Run)
+	{
+		for (const FShapedGlyphEntry& Glyph : Run.Glyphs)
+		{
+			Glyphs.Add_GetRef(Glyph).SourceIndex += SourceIndex;
+		}
+		SourceIndex += Run.NumCharacters;
+	};
+
+	for (TCHAR Character : NumberString)
+	{
+		AppendRun(FindOrShapeRun(Character));
+	}
+	if (!SuffixString.IsEmpty())
+	{
+		AppendRun(FindOrShapeRun(SuffixString));
+	}
+
+	Sequence = MakeShared<FShapedGlyphSequence>(MoveTemp(Glyphs), TextBaseline, MaxTextHeight, Font.FontMaterial, Font.OutlineSettings, FShapedGlyphSequence::FSourceTextRange(0, SourceIndex));
+	SequenceSize = FVector2D(Sequence->GetMeasuredWidth(), MaxTextHeight);
+}
+
+void STicTacToeUnitReadout::InvalidateDisplay(bool bDisplayChanged)
+{
+	if (!bDisplayChanged) return;
+
+	// Nothing shaped yet, the next prepass measures
+	if (CachedScale <= 0.0f)
+	{
+		Invalidate(EInvalidateWidgetReason::Layout);
+		return;
+	}
+
+	const FVector2D PreviousSize = SequenceSize;
+	BuildSequence();
+	Invalidate(SequenceSize == PreviousSize ? EInvalidateWidgetReason::Paint : EInvalidateWidgetReason::Layout);
+}
+
+void STicTacToeUnitReadout::HandleCultureChanged()
+{
+	// Separators, digits and suffixes all depend on the culture
+	ResetGlyphCache();
+	NumberString.Reset();
+	SuffixString.Reset();
+	UpdateDisplayString();
+	Invalidate(EInvalidateWidgetReason::Layout);
+}
+
+FVector2D STicTacToeUnitReadout::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	if (!FSlateApplication::IsInitialized()) return FVector2D::ZeroVector;
+
+	if (CachedScale <= 0.0f) ShapeGlyphCache(1.0f);
+	if (bSequenceDirty) BuildSequence();
+
+	return SequenceSize / CachedScale;
+}
+
+int32 STicTacToeUnitReadout::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	// Glyphs are shaped at the render scale, as text blocks do, so they stay sharp under DPI scaling
+	const float Scale = AllottedGeometry.Scale;
+	if (Scale != CachedScale)
+	{
+		ShapeGlyphCache(Scale);
+		bSequenceDirty = true;
+	}
+	if (bSequenceDirty) BuildSequence();
+
+	if (!Sequence.IsValid() || DisplayString.IsEmpty()) return LayerId;
+
+	const ESlateDrawEffect DrawEffects = ShouldBeEnabled(bParentEnabled) ? ESlateDrawEffect::None : ESlateDrawEffect::DisabledEffect;
+	const FLinearColor Tint = InWidgetStyle.GetColorAndOpacityTint() * ColorAndOpacity.Get().GetColor(InWidgetStyle);
+
+	FSlateDrawElement::MakeShapedText(
+		OutDrawElements,
+		LayerId,
+		AllottedGeometry.ToPaintGeometry(SequenceSize / Scale, FSlateLayoutTransform()),
+		Sequence.ToSharedRef(),
+		DrawEffects,
+		Tint,
+		Font.OutlineSettings.OutlineColor
+	);
+
+	return LayerId;
+}
@@ -0,0 +1,1197 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitAffine.h"
+#include "TicTacToeUnitBatch.h"
+#include "TicTacToeUnitDisplayStrings.h"
+#include "TicTacToeUnitFixedPoint.h"
+#include "Internationalization/FastDecimalFormat.h"
+#include "Kismet/KismetTextLibrary.h"
+#include "Math/RandomStream.h"
+
+/*
+*	Differential accuracy check of the conversion and formatting paths, run in CI and before adopting a faster path.
+*
+*	Conversions: every unit pair is compared with the exact result rounded once, computed in big integer rationals
+*	from definitions that do not go through the double tables: the FTicTacToeFixedPoint ratios, the temperature and
+*	gauge offsets and the whole seconds of the time units. A pair may be at most MaxUlp away, on values from
+*	ClaimMin to ClaimMax where no intermediate product over- or underflows. Offset pairs are measured in ULPs of
+*	the larger of the scaled value and the offset, the sum cannot be closer than that. Angles and the derived
+*	families have no exact definition in the plugin and are not part of the accuracy claim.
+*
+*	The batch kernels (FTicTacToeAffine, FTicTacToeUnitBatch, the vector conversions) must give the same bits as
+*	the scalar functions for every family and every value, edge values included.
+*
+*	Formatting: the readout's FastDecimalFormat path and the Format functions must produce the same characters
+*	as Conv_DoubleToText of the value converted by ConvertUnit, for precisions 0 to 6 with and without sign and
+*	grouping, padded to a stable width and in significant and engineering notation. FormatUnit is checked in every
+*	unit pair and in the unit GetDisplayUnit picks for each auto unit, the Int64 data functions against the exact
+*	result where it is a double, FormatUnitToWidth against the texts of its ladder at every precision it may pick.
+*/
+namespace TicTacToeUnitAccuracy
+{
+	static constexpr uint64 MaxUlp = 4;
+	static constexpr double ClaimMin = 1e-280;
+	static constexpr double ClaimMax = 1e280;
+
+	static constexpr int32 Seed = 1;
+	static constexpr int32 NumSamples = 256;
+
+	// --- --- EXACT ARITHMETIC --- --- //
+
+	// Unsigned integer of any size, 32 bit limbs, least significant first and no leading zero limb
+	struct FBigUInt
+	{
+		TArray<uint32> Limbs;
+
+		static FBigUInt FromUInt64(uint64 Value)
+		{
+			FBigUInt Result;
+			if (Value) Result.Limbs.Add(uint32(Value));
+			if (Value >> 32) Result.Limbs.Add(uint32(Value >> 32));
+			return Result;
+		}
+
+		bool IsZero() const { return Limbs.Num() == 0; }
+
+		int32 BitLength() const
+		{
+			return IsZero() ? 0 : (Limbs.Num() - 1) * 32 + (32 - FMath::CountLeadingZeros(Limbs.Last()));
+		}
+
+		void Trim()
+		{
+			while (Limbs.Num() > 0 && Limbs.Last() == 0) Limbs.Pop();
+		}
+
+		FBigUInt Shifted(int32 Bits) const
+		{
+			if (IsZero()) return *this;
+
+			const int32 LimbShift = Bits / 32;
+			const int32 BitShift = Bits % 32;
+
+			FBigUInt Result;
+			Result.Limbs.SetNumZeroed(Limbs.Num() + LimbShift + 1);
+			for (int32 i = 0; i < Limbs.Num(); ++i)
+			{
+				const uint64 Value = uint64(Limbs[i]) << BitShift;
+				Result.Limbs[i + LimbShift] |= uint32(Value);
+				Result.Limbs[i + LimbShift + 1] |= uint32(Value >> 32);
+			}
+			Result.Trim();
+			return Result;
+		}
+
+		void ShiftRightOne()
+		{
+			for (int32 i = 0; i < Limbs.Num(); ++i)
+			{
+				Limbs[i] = (Limbs[i] >> 1) | (i + 1 < Limbs.Num() ? Limbs[i + 1] << 31 : 0);
+			}
+			Trim();
+		}
+
+		static int32 Compare(const FBigUInt& A, const FBigUInt& B)
+		{
+			if (A.Limbs.Num() != B.Limbs.Num()) return A.Limbs.Num() < B.Limbs.Num() ? -1 : 1;
+			for (int32 i = A.Limbs.Num() - 1; i >= 0; --i)
+			{
+				if (A.Limbs[i] != B.Limbs[i]) return A.Limbs[i] < B.Limbs[i] ? -1 : 1;
+			}
+			return 0;
+		}
+
+		static FBigUInt Add(const FBigUInt& A, const FBigUInt& B)
+		{
+			FBigUInt Result;
+			Result.Limbs.SetNumZeroed(FMath::Max(A.Limbs.Num(), B.Limbs.Num()) + 1);
+			uint64 Carry = 0;
+			for (int32 i = 0; i < Result.Limbs.Num(); ++i)
+			{
+				const uint64 Sum = Carry + (i < A.Limbs.Num() ? A.Limbs[i] : 0) + (i < B.Limbs.Num() ? B.Limbs[i] : 0);
+				Result.Limbs[i] = uint32(Sum);
+				Carry = Sum >> 32;
+			}
+			Result.Trim();
+			return Result;
+		}
+
+		// A - B, with A >= B
+		static FBigUInt Subtract(const FBigUInt& A, const FBigUInt& B)
+		{
+			FBigUInt Result = A;
+			Result.SubtractInPlace(B);
+			return Result;
+		}
+
+		void SubtractInPlace(const FBigUInt& B)
+		{
+			int64 Borrow = 0;
+			for (int32 i = 0; i < Limbs.Num(); ++i)
+			{
+				int64 Difference = int64(Limbs[i]) - (i < B.Limbs.Num() ? B.Limbs[i] : 0) - Borrow;
+				Borrow = Difference < 0 ? 1 : 0;
+				Limbs[i] = uint32(Difference + (Borrow << 32));
+			}
+			Trim();
+		}
+
+		static FBigUInt Multiply(const FBigUInt& A, const FBigUInt& B)
+		{
+			FBigUInt Result;
+			if (A.IsZero() || B.IsZero()) return Result;
+
+			Result.Limbs.SetNumZeroed(A.Limbs.Num() + B.Limbs.Num());
+			for (int32 i = 0; i < A.Limbs.Num(); ++i)
+			{
+				uint64 Carry = 0;
+				for (int32 j = 0; j < B.Limbs.Num(); ++j)
+				{
+					const uint64 Product = uint64(A.Limbs[i]) * B.Limbs[j] + Result.Limbs[i + j] + Carry;
+					Result.Limbs[i + j] = uint32(Product);
+					Carry = Product >> 32;
+				}
+				Result.Limbs[i + B.Limbs.Num()] = uint32(Carry);
+			}
+			Result.Trim();
+			return Result;
+		}
+	};
+
+	// Exact signed rational, not reduced
+	struct FExact
+	{
+		bool bNegative = false;
+		FBigUInt Num;
+		FBigUInt Den = FBigUInt::FromUInt64(1);
+
+		static FExact FromRatio(int64 Numerator, int64 Denominator)
+		{
+			FExact Result;
+			Result.bNegative = (Numerator < 0) != (Denominator < 0);
+			Result.Num = FBigUInt::FromUInt64(uint64(Numerator < 0 ? -Numerator : Numerator));
+			Result.Den = FBigUInt::FromUInt64(uint64(Denominator < 0 ? -Denominator : Denominator));
+			return Result;
+		}
+
+		// Every finite double is Mantissa * 2^Exponent
+		static FExact FromDouble(double Value)
+		{
+			uint64 Bits;
+			FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+
+			const int32 BiasedExponent = int32((Bits >> 52) & 0x7FF);
+			const uint64 Fraction = Bits & ((uint64(1) << 52) - 1);
+			const uint64 Mantissa = BiasedExponent ? Fraction | (uint64(1) << 52) : Fraction;
+			const int32 Exponent = (BiasedExponent ? BiasedExponent : 1) - 1075;
+
+			FExact Result;
+			Result.bNegative = (Bits >> 63) != 0;
+			Result.Num = FBigUInt::FromUInt64(Mantissa);
+			if (Exponent >= 0) Result.Num = Result.Num.Shifted(Exponent);
+			else Result.Den = Result.Den.Shifted(-Exponent);
+			return Result;
+		}
+
+		static FExact Multiply(const FExact& A, const FExact& B)
+		{
+			FExact Result;
+			Result.bNegative = A.bNegative != B.bNegative;
+			Result.Num = FBigUInt::Multiply(A.Num, B.Num);
+			Result.Den = FBigUInt::Multiply(A.Den, B.Den);
+			return Result;
+		}
+
+		static FExact Divide(const FExact& A, const FExact& B)
+		{
+			FExact Result;
+			Result.bNegative = A.bNegative != B.bNegative;
+			Result.Num = FBigUInt::Multiply(A.Num, B.Den);
+			Result.Den = FBigUInt::Multiply(A.Den, B.Num);
+			return Result;
+		}
+
+		static FExact Add(const FExact& A, const FExact& B)
+		{
+			const FBigUInt Left = FBigUInt::Multiply(A.Num, B.Den);
+			const FBigUInt Right = FBigUInt::Multiply(B.Num, A.Den);
+
+			FExact Result;
+			Result.Den = FBigUInt::Multiply(A.Den, B.Den);
+			if (A.bNegative == B.bNegative)
+			{
+				Result.bNegative = A.bNegative;
+				Result.Num = FBigUInt::Add(Left, Right);
+			}
+			else if (FBigUInt::Compare(Left, Right) >= 0)
+			{
+				Result.bNegative = A.bNegative;
+				Result.Num = FBigUInt::Subtract(Left, Right);
+			}
+			else
+			{
+				Result.bNegative = B.bNegative;
+				Result.Num = FBigUInt::Subtract(Right, Left);
+			}
+			return Result;
+		}
+
+		static FExact Negate(FExact Value)
+		{
+			Value.bNegative = !Value.bNegative;
+			return Value;
+		}
+
+		// Correctly rounded, ties to even, denormals and overflow included
+		double ToDouble() const
+		{
+			if (Num.IsZero()) return bNegative ? -0.0 : 0.0;
+
+			// Scale so the integer quotient has 55 or 56 bits
+			const int32 Scale = 55 - (Num.BitLength() - Den.BitLength());
+			FBigUInt Remainder = Scale >= 0 ? Num.Shifted(Scale) : Num;
+			FBigUInt Divisor = (Scale < 0 ? Den.Shifted(-Scale) : Den).Shifted(57);
+
+			uint64 Quotient = 0;
+			for (int32 Bit = 57; Bit >= 0; --Bit)
+			{
+				if (FBigUInt::Compare(Remainder, Divisor) >= 0)
+				{
+					Remainder.SubtractInPlace(Divisor);
+					Quotient |= uint64(1) << Bit;
+				}
+				Divisor.ShiftRightOne();
+			}
+			const bool bSticky = !Remainder.IsZero();
+
+			const int32 QuotientBits = 64 - FMath::CountLeadingZeros64(Quotient);
+			int32 Exponent = QuotientBits - 1 - Scale;
+			const uint64 SignBit = bNegative ? uint64(1) << 63 : 0;
+			const uint64 InfinityBits = uint64(0x7FF) << 52;
+
+			// Fewer significant bits below the normal range, none left under half the smallest denormal
+			const int32 Precision = Exponent < -1022 ? 53 - (-1022 - Exponent) : 53;
+			uint64 Bits = 0;
+			if (Exponent > 1023)
+			{
+				Bits = InfinityBits;
+			}
+			else if (Precision >= 0)
+			{
+				const int32 Dropped = QuotientBits - Precision;
+				uint64 Mantissa = Quotient >> Dropped;
+				const uint64 Rest = Quotient & ((uint64(1) << Dropped) - 1);
+				const uint64 Half = uint64(1) << (Dropped - 1);
+				if (Rest > Half || (Rest == Half && (bSticky || (Mantissa & 1)))) ++Mantissa;
+
+				if (Precision < 53)
+				{
+					// Denormal, rounding up to 2^52 gives the bits of the smallest normal
+					Bits = Mantissa;
+				}
+				else
+				{
+					if (Mantissa >> 53)
+					{
+						Mantissa >>= 1;
+						++Exponent;
+					}
+					Bits = Exponent > 1023 ? InfinityBits : (uint64(Exponent + 1023) << 52) | (Mantissa & ((uint64(1) << 52) - 1));
+				}
+			}
+
+			Bits |= SignBit;
+			double Result;
+			FMemory::Memcpy(&Result, &Bits, sizeof(Result));
+			return Result;
+		}
+	};
+
+	// --- --- REFERENCE --- --- //
+
+	// Canonical = Value * Scale + Offset
+	struct FUnitReference
+	{
+		FExact Scale;
+		FExact Offset = FExact::FromRatio(0, 1);
+	};
+
+	// To = Value * Scale + Offset
+	struct FPairReference
+	{
+		FExact Scale;
+		FExact Offset;
+		bool bHasOffset = false;
+
+		FPairReference() = default;
+
+		FPairReference(const FUnitReference& From, const FUnitReference& To)
+			: Scale(FExact::Divide(From.Scale, To.Scale))
+			, Offset(FExact::Divide(FExact::Add(From.Offset, FExact::Negate(To.Offset)), To.Scale))
+			, bHasOffset(!Offset.Num.IsZero())
+		{
+		}
+
+		// OutMagnitude is the larger of the two terms of an offset pair, 0 for a linear pair
+		double Evaluate(double Value, double& OutMagnitude) const
+		{
+			const FExact Scaled = FExact::Multiply(FExact::FromDouble(Value), Scale);
+			if (!bHasOffset)
+			{
+				OutMagnitude = 0.0;
+				return Scaled.ToDouble();
+			}
+
+			OutMagnitude = FMath::Max(FMath::Abs(Scaled.ToDouble()), FMath::Abs(Offset.ToDouble()));
+			return FExact::Add(Scaled, Offset).ToDouble();
+		}
+	};
+
+	template<typename UnitType>
+	static bool GetExactScale(uint8 Unit, UnitType CanonicalUnit, FExact& OutScale)
+	{
+		FTicTacToeUnitRatio Ratio;
+		if (!FTicTacToeFixedPoint::GetRatio((UnitType)Unit, CanonicalUnit, Ratio)) return false;
+		OutScale = FExact::FromRatio(Ratio.Numerator, Ratio.Denominator);
+		return true;
+	}
+
+	// False when the unit has no exact definition, the stored double factor is never taken as the reference
+	static bool GetUnitReference(EUnitFamily Family, uint8 Unit, FUnitReference& OutReference)
+	{
+		switch (Family)
+		{
+		case EUnitFamily::UF_LENGTH:	return GetExactScale(Unit, ELengthUnit::LU_MET_M, OutReference.Scale);
+		case EUnitFamily::UF_WEIGHT:	return GetExactScale(Unit, EWeightUnit::WU_MET_KG, OutReference.Scale);
+		case EUnitFamily::UF_VOLUME:	return GetExactScale(Unit, EVolumeUnit::VU_MET_M3, OutReference.Scale);
+		case EUnitFamily::UF_AREA:		return GetExactScale(Unit, EAreaUnit::AU_MET_M2, OutReference.Scale);
+		case EUnitFamily::UF_ENERGY:	return GetExactScale(Unit, EEnergyUnit::EU_J, OutReference.Scale);
+		case EUnitFamily::UF_DATA_SIZE:	return GetExactScale(Unit, EDataSizeUnit::DS_BYTE, OutReference.Scale);
+		case EUnitFamily::UF_DATA_RATE:	return GetExactScale(Unit, EDataRateUnit::DR_BYTE_S, OutReference.Scale);
+		case EUnitFamily::UF_TIME:
+		{
+			// Months are 30 days and years 365 days
+			static constexpr int64 Seconds[] = { 1, 60, 3600, 86400, 30 * 86400, 365 * 86400 };
+			if (Unit >= UE_ARRAY_COUNT(Seconds)) return false;
+			OutReference.Scale = FExact::FromRatio(Seconds[Unit], 1);
+			return true;
+		}
+		case EUnitFamily::UF_TEMPERATURE:
+			switch ((ETemperatureUnit)Unit)
+			{
+			case ETemperatureUnit::TU_KEL:	OutReference.Scale = FExact::FromRatio(1, 1); return true;
+			case ETemperatureUnit::TU_CEL:	OutReference.Scale = FExact::FromRatio(1, 1); OutReference.Offset = FExact::FromRatio(27315, 100); return true;
+			case ETemperatureUnit::TU_FAR:	OutReference.Scale = FExact::FromRatio(5, 9); OutReference.Offset = FExact::FromRatio(45967, 180); return true;
+			default:						return false;
+			}
+		case EUnitFamily::UF_PRESSURE:
+		{
+			// Gauge units are the absolute unit plus one standard atmosphere
+			EPressureUnit LinearUnit = (EPressureUnit)Unit;
+			if (LinearUnit == EPressureUnit::PU_MET_BARG) LinearUnit = EPressureUnit::PU_MET_BAR;
+			if (LinearUnit == EPressureUnit::PU_US_PSIG) LinearUnit = EPressureUnit::PU_MET_PSI;
+			if (LinearUnit != (EPressureUnit)Unit) OutReference.Offset = FExact::FromRatio(101325, 1);
+
+			return GetExactScale((uint8)LinearUnit, EPressureUnit::PU_MET_PA, OutReference.Scale);
+		}
+		default:
+			return false;
+		}
+	}
+
+	static uint64 GetUlpDistance(double A, double B)
+	{
+		const uint64 KeyA = FTicTacToeUnitBatch::GetSortKey(A);
+		const uint64 KeyB = FTicTacToeUnitBatch::GetSortKey(B);
+		return KeyA > KeyB ? KeyA - KeyB : KeyB - KeyA;
+	}
+
+	// ULPs between the result and the reference, counted at Magnitude when it is above the reference
+	static uint64 GetUlpError(double Result, double Reference, double Magnitude)
+	{
+		if (!(Magnitude > FMath::Abs(Reference)) || !FMath::IsFinite(Magnitude)) return GetUlpDistance(Result, Reference);
+		if (!FMath::IsFinite(Result)) return MAX_uint64;
+
+		const double Ulp = std::nextafter(Magnitude, INFINITY) - Magnitude;
+		return uint64(FMath::Min(FMath::Abs(Result - Reference) / Ulp, 1e18));
+	}
+
+	static bool IsSameBits(double A, double B)
+	{
+		return (FMath::IsNaN(A) && FMath::IsNaN(B)) || FMemory::Memcmp(&A, &B, sizeof(double)) == 0;
+	}
+
+	static bool IsInClaimRange(double Value)
+	{
+		const double Magnitude = FMath::Abs(Value);
+		return Magnitude == 0.0 || (Magnitude >= ClaimMin && Magnitude <= ClaimMax);
+	}
+
+	// --- --- SAMPLES --- --- //
+
+	static TArray<double> GetEdgeValues()
+	{
+		return {
+			0.0, -0.0, 1.0, -1.0, 0.5, -2.5, 0.1, 0.2, 0.3, 1e-5, 100.0, 212.0, -40.0, -273.15, 273.15, 101325.0, 123456.789,
+			9007199254740991.0, 1e15, 1e22, 1e-300, 1e300, -1e300,
+			DBL_MIN, -DBL_MIN, DBL_MAX, -DBL_MAX,
+			// Largest and smallest denormals
+			2.2250738585072009e-308, 4.9406564584124654e-324, -4.9406564584124654e-324,
+		};
+	}
+
+	// Half over the whole exponent range (denormals included), half at the magnitudes games use
+	static double MakeRandomValue(FRandomStream& Random)
+	{
+		if (Random.GetFraction() < 0.5)
+		{
+			uint64 Bits = (uint64(Random.GetUnsignedInt()) << 32) | Random.GetUnsignedInt();
+			if (((Bits >> 52) & 0x7FF) == 0x7FF) Bits &= ~(uint64(1) << 52);
+
+			double Value;
+			FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+			return Value;
+		}
+
+		const double Magnitude = FMath::Pow(10.0, (double)Random.FRandRange(-9.0f, 9.0f));
+		return Random.GetFraction() < 0.5 ? -Magnitude : Magnitude;
+	}
+
+	static TArray<double> GetConversionValues(FRandomStream& Random)
+	{
+		TArray<double> Values = GetEdgeValues();
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			Values.Add(MakeRandomValue(Random));
+		}
+		return Values;
+	}
+
+	// Decimal ties at every precision, exact binary ties and values that round up to the next power of ten
+	static TArray<double> GetFormattingValues(FRandomStream& Random, int32 NumRandom)
+	{
+		TArray<double> Values = GetEdgeValues();
+		Values.Append({ 1.5, 2.5, -0.5, 0.125, 0.375, 1.0625, 2.675, 1.005, 9.995, 99.95, 999.5, 0.0005, 1234567.125, 999999.9999999 });
+
+		for (int32 Index = 0; Index < NumRandom; ++Index)
+		{
+			const int32 Precision = Random.RandRange(0, 6);
+			const double Tie = (2.0 * Random.RandRange(0, 99999) + 1.0) / (2.0 * FMath::Pow(10.0, (double)Precision));
+			Values.Add(Random.GetFraction() < 0.5 ? Tie : -Tie);
+			Values.Add(MakeRandomValue(Random));
+		}
+		return Values;
+	}
+
+	// --- --- RESULTS --- --- //
+
+	struct FPairResult
+	{
+		const TCHAR* Path = TEXT("");
+		EUnitFamily Family = EUnitFamily::UF_LENGTH;
+		FString FromName;
+		FString ToName;
+		int32 Samples = 0;
+		uint64 WorstUlp = 0;
+		double WorstValue = 0.0;
+		double WorstResult = 0.0;
+		double WorstReference = 0.0;
+
+		void Record(double Value, double Result, double Reference, double Magnitude)
+		{
+			const uint64 Ulp = GetUlpError(Result, Reference, Magnitude);
+			if (Samples++ == 0 || Ulp > WorstUlp)
+			{
+				WorstUlp = Ulp;
+				WorstValue = Value;
+				WorstResult = Result;
+				WorstReference = Reference;
+			}
+		}
+
+		FString ToString() const
+		{
+			return FString::Printf(TEXT("%s %s %s -> %s: %llu ulp at %.17g, %.17g instead of %.17g"),
+				Path, *GetFamilyName(Family), *FromName, *ToName, WorstUlp, WorstValue, WorstResult, WorstReference);
+		}
+
+		// One row of the accuracy table, aligned under GetTableHeader
+		FString ToTableRow() const
+		{
+			return FString::Printf(TEXT("%-18s %-12s %-36s %6llu  %-24.17g %-24.17g %.17g"),
+				Path, *GetFamilyName(Family), *(FromName + TEXT(" -> ") + ToName), WorstUlp, WorstValue, WorstResult, WorstReference);
+		}
+
+		static FString GetTableHeader()
+		{
+			return FString::Printf(TEXT("%-18s %-12s %-36s %6s  %-24s %-24s %s"), TEXT("Path"), TEXT("Family"), TEXT("Pair"), TEXT("Ulp"), TEXT("Input"), TEXT("Result"), TEXT("Reference"));
+		}
+
+		static FString GetFamilyName(EUnitFamily Family)
+		{
+			return StaticEnum<EUnitFamily>()->GetNameStringByValue((int64)Family).RightChop(3).ToLower();
+		}
+	};
+
+	static const UEnum* GetUnitEnum(EUnitFamily Family)
+	{
+		switch (Family)
+		{
+		case EUnitFamily::UF_LENGTH:		return StaticEnum<ELengthUnit>();
+		case EUnitFamily::UF_WEIGHT:		return StaticEnum<EWeightUnit>();
+		case EUnitFamily::UF_VOLUME:		return StaticEnum<EVolumeUnit>();
+		case EUnitFamily::UF_AREA:			return StaticEnum<EAreaUnit>();
+		case EUnitFamily::UF_TEMPERATURE:	return StaticEnum<ETemperatureUnit>();
+		case EUnitFamily::UF_TIME:			return StaticEnum<ETimeUnit>();
+		case EUnitFamily::UF_PRESSURE:		return StaticEnum<EPressureUnit>();
+		case EUnitFamily::UF_ENERGY:		return StaticEnum<EEnergyUnit>();
+		case EUnitFamily::UF_ANGLE:			return StaticEnum<EAngleUnit>();
+		case EUnitFamily::UF_POWER:			return StaticEnum<EPowerUnit>();
+		case EUnitFamily::UF_FLOW:			return StaticEnum<EFlowUnit>();
+		case EUnitFamily::UF_DENSITY:		return StaticEnum<EDensityUnit>();
+		case EUnitFamily::UF_ACCELERATION:	return StaticEnum<EAccelerationUnit>();
+		case EUnitFamily::UF_TORQUE:		return StaticEnum<ETorqueUnit>();
+		case EUnitFamily::UF_DATA_SIZE:		return StaticEnum<EDataSizeUnit>();
+		case EUnitFamily::UF_DATA_RATE:		return StaticEnum<EDataRateUnit>();
+		default:							return nullptr;
+		}
+	}
+
+	// Fails the test when a batch path does not give the scalar bits, the first value is reported
+	static void CheckSameBits(FAutomationTestBase& Test, const TCHAR* Path, const FString& Pair, TArrayView<const double> Values, TArrayView<const double> Expected, TArrayView<const double> Actual)
+	{
+		for (int32 Index = 0; Index < Values.Num(); ++Index)
+		{
+			if (IsSameBits(Expected[Index], Actual[Index])) continue;
+
+			Test.AddError(FString::Printf(TEXT("%s %s: %.17g gives %.17g, the scalar function %.17g"),
+				Path, *Pair, Values[Index], Actual[Index], Expected[Index]));
+			return;
+		}
+	}
+
+	// --- --- CONVERSIONS --- --- //
+
+	// Batch paths for every unit pair, accuracy for the pairs of units with an exact definition
+	static void CheckFamily(FAutomationTestBase& Test, EUnitFamily Family, TArrayView<const double> Values, TArray<FPairResult>& OutResults)
+	{
+		using Library = UTicTacToeUnitFormatBPLibrary;
+
+		const UEnum* UnitEnum = GetUnitEnum(Family);
+		if (!UnitEnum) return;
+
+		const uint8 canonical_unit = FTicTacToeUnitBatch::GetCanonicalUnit(Family);
+
+		TArray<uint8> Units;
+		TArray<FUnitReference> References;
+		TBitArray<> Exact;
+		for (int32 unit = 0; unit < UnitEnum->NumEnums() - 1; ++unit)
+		{
+			if (!FTicTacToeAffine::Find(Family, (uint8)unit, (uint8)unit)) continue;
+
+			Units.Add((uint8)unit);
+			Exact.Add(GetUnitReference(Family, (uint8)unit, References.AddDefaulted_GetRef()));
+		}
+
+		TArray<double> Converted, Batch;
+		TArray<uint8> BatchUnits;
+		Converted.SetNumUninitialized(Values.Num());
+		Batch.SetNumUninitialized(Values.Num());
+
+		for (int32 FromIndex = 0; FromIndex < Units.Num(); ++FromIndex)
+		{
+			const uint8 from_unit = Units[FromIndex];
+
+			for (int32 ToIndex = 0; ToIndex < Units.Num(); ++ToIndex)
+			{
+				const uint8 to_unit = Units[ToIndex];
+				const FString Pair = UnitEnum->GetNameStringByValue(from_unit) + TEXT(" -> ") + UnitEnum->GetNameStringByValue(to_unit);
+
+				for (int32 Index = 0; Index < Values.Num(); ++Index)
+				{
+					Converted[Index] = Library::ConvertUnit(Values[Index], Family, from_unit, to_unit);
+				}
+
+				if (Exact[FromIndex] && Exact[ToIndex])
+				{
+					const FPairReference Reference(References[FromIndex], References[ToIndex]);
+
+					FPairResult& Result = OutResults.AddDefaulted_GetRef();
+					Result.Path = TEXT("ConvertUnit");
+					Result.Family = Family;
+					Result.FromName = UnitEnum->GetNameStringByValue(from_unit);
+					Result.ToName = UnitEnum->GetNameStringByValue(to_unit);
+
+					for (int32 Index = 0; Index < Values.Num(); ++Index)
+					{
+						if (!IsInClaimRange(Values[Index])) continue;
+
+						double Magnitude;
+						const double Expected = Reference.Evaluate(Values[Index], Magnitude);
+						Result.Record(Values[Index], Converted[Index], Expected, Magnitude);
+					}
+				}
+
+				FTicTacToeAffine::Apply(Values, *FTicTacToeAffine::Find(Family, from_unit, to_unit), Batch);
+				CheckSameBits(Test, TEXT("FTicTacToeAffine::Apply"), Pair, Values, Converted, Batch);
+
+				if (Family == EUnitFamily::UF_LENGTH)
+				{
+					for (int32 Index = 0; Index < Values.Num(); ++Index)
+					{
+						const FVector Vector = Library::ConvertLengthVector(FVector(Values[Index]), (ELengthUnit)from_unit, (ELengthUnit)to_unit);
+						Batch[Index] = IsSameBits(Vector.X, Vector.Y) && IsSameBits(Vector.X, Vector.Z) ? Vector.X : NAN;
+					}
+					CheckSameBits(Test, TEXT("ConvertLengthVector"), Pair, Values, Converted, Batch);
+				}
+			}
+
+			for (int32 Index = 0; Index < Values.Num(); ++Index)
+			{
+				Converted[Index] = Library::ConvertUnit(Values[Index], Family, from_unit, canonical_unit);
+			}
+			BatchUnits.Init(from_unit, Values.Num());
+			FTicTacToeUnitBatch::Canonicalize(Family, Values, BatchUnits, Batch);
+			CheckSameBits(Test, TEXT("FTicTacToeUnitBatch::Canonicalize"), UnitEnum->GetNameStringByValue(from_unit), Values, Converted, Batch);
+		}
+	}
+
+	// Length pairs over two time pairs, through the scalar and the vector speed conversions
+	static void CheckSpeed(TArrayView<const double> Values, TArray<FPairResult>& OutResults)
+	{
+		using Library = UTicTacToeUnitFormatBPLibrary;
+
+		const UEnum* LengthEnum = StaticEnum<ELengthUnit>();
+		const UEnum* TimeEnum = StaticEnum<ETimeUnit>();
+		const TPair<ETimeUnit, ETimeUnit> TimePairs[] = { { ETimeUnit::TU_SEC, ETimeUnit::TU_HR }, { ETimeUnit::TU_MIN, ETimeUnit::TU_SEC } };
+
+		for (int32 from_length = 0; from_length < LengthEnum->NumEnums() - 1; ++from_length)
+		{
+			FUnitReference FromReference;
+			if (!GetUnitReference(EUnitFamily::UF_LENGTH, (uint8)from_length, FromReference)) continue;
+
+			for (int32 to_length = 0; to_length < LengthEnum->NumEnums() - 1; ++to_length)
+			{
+				FUnitReference ToReference;
+				if (!GetUnitReference(EUnitFamily::UF_LENGTH, (uint8)to_length, ToReference)) continue;
+
+				for (const TPair<ETimeUnit, ETimeUnit>& TimePair : TimePairs)
+				{
+					// Per time unit the speed is divided by its length in seconds
+					FUnitReference FromTime, ToTime;
+					GetUnitReference(EUnitFamily::UF_TIME, (uint8)TimePair.Key, FromTime);
+					GetUnitReference(EUnitFamily::UF_TIME, (uint8)TimePair.Value, ToTime);
+
+					FUnitReference FromSpeed = FromReference, ToSpeed = ToReference;
+					FromSpeed.Scale = FExact::Divide(FromSpeed.Scale, FromTime.Scale);
+					ToSpeed.Scale = FExact::Divide(ToSpeed.Scale, ToTime.Scale);
+					const FPairReference Reference(FromSpeed, ToSpeed);
+
+					FPairResult Scalar;
+					Scalar.Path = TEXT("ConvertSpeed");
+					Scalar.Family = EUnitFamily::UF_LENGTH;
+					Scalar.FromName = LengthEnum->GetNameStringByValue(from_length) + TEXT("/") + TimeEnum->GetNameStringByValue((int64)TimePair.Key);
+					Scalar.ToName = LengthEnum->GetNameStringByValue(to_length) + TEXT("/") + TimeEnum->GetNameStringByValue((int64)TimePair.Value);
+
+					FPairResult Vector = Scalar;
+					Vector.Path = TEXT("ConvertSpeedVector");
+
+					for (double Value : Values)
+					{
+						if (!IsInClaimRange(Value)) continue;
+
+						double Magnitude;
+						const double Expected = Reference.Evaluate(Value, Magnitude);
+						Scalar.Record(Value, Library::ConvertSpeed(Value, (ELengthUnit)from_length, (ELengthUnit)to_length, TimePair.Key, TimePair.Value), Expected, Magnitude);
+						Vector.Record(Value, Library::ConvertSpeedVector(FVector(Value), (ELengthUnit)from_length, (ELengthUnit)to_length, TimePair.Key, TimePair.Value).X, Expected, Magnitude);
+					}
+					OutResults.Add(MoveTemp(Scalar));
+					OutResults.Add(MoveTemp(Vector));
+				}
+			}
+		}
+	}
+
+	// --- --- FORMATTING --- --- //
+
+	// One set of the Format parameters, Precision is the significant digits in the notations
+	struct FFormatCase
+	{
+		int32 Precision = 0;
+		bool bForceSign = false;
+		bool bUseGrouping = false;
+		int32 StableWidth = 0;
+		ENumberNotation Notation = ENumberNotation::NN_FIXED;
+
+		FString ToString() const
+		{
+			FString Result = FString::Printf(TEXT("precision %d"), Precision);
+			if (bForceSign) Result += TEXT(", sign");
+			if (bUseGrouping) Result += TEXT(", grouping");
+			if (StableWidth > 0) Result += FString::Printf(TEXT(", width %d"), StableWidth);
+			if (Notation == ENumberNotation::NN_SIGNIFICANT) Result += TEXT(", significant");
+			if (Notation == ENumberNotation::NN_ENGINEERING) Result += TEXT(", engineering");
+			return Result;
+		}
+	};
+
+	// Wide enough to pad most values, narrower than the longest so a value can also overflow it
+	static constexpr int32 PaddedWidth = 16;
+
+	// Precisions 0 to 6 with and without sign and grouping
+	static TArray<FFormatCase> GetFixedCases()
+	{
+		TArray<FFormatCase> Cases;
+		for (int32 Precision = 0; Precision <= 6; ++Precision)
+		{
+			for (int32 Flags = 0; Flags < 4; ++Flags)
+			{
+				Cases.Add({ Precision, (Flags & 1) != 0, (Flags & 2) != 0 });
+			}
+		}
+		return Cases;
+	}
+
+	// The fixed cases padded, then 1 to 6 significant digits in both notations, padded and not
+	static TArray<FFormatCase> GetFormatCases()
+	{
+		TArray<FFormatCase> Cases = GetFixedCases();
+		for (const FFormatCase& Fixed : GetFixedCases())
+		{
+			FFormatCase& Padded = Cases.Add_GetRef(Fixed);
+			Padded.StableWidth = PaddedWidth;
+		}
+
+		for (const ENumberNotation Notation : { ENumberNotation::NN_SIGNIFICANT, ENumberNotation::NN_ENGINEERING })
+		{
+			for (int32 Digits = 1; Digits <= 6; ++Digits)
+			{
+				for (int32 Flags = 0; Flags < 8; ++Flags)
+				{
+					Cases.Add({ Digits, (Flags & 1) != 0, (Flags & 2) != 0, (Flags & 4) ? PaddedWidth : 0, Notation });
+				}
+			}
+		}
+		return Cases;
+	}
+
+	// A few cases of each kind for the unit pairs and the auto units, which multiply the number of runs
+	static TArray<FFormatCase> GetPairCases()
+	{
+		return {
+			{ 2, false, false },
+			{ 0, true, true },
+			{ 3, false, true, PaddedWidth },
+			{ 3, false, false, 0, ENumberNotation::NN_SIGNIFICANT },
+			{ 4, true, false, PaddedWidth, ENumberNotation::NN_ENGINEERING },
+		};
+	}
+
+	static FNumberFormattingOptions MakeOptions(const FFormatCase& Case)
+	{
+		FNumberFormattingOptions Options;
+		Options.SetAlwaysSign(Case.bForceSign)
+			.SetUseGrouping(Case.bUseGrouping)
+			.SetRoundingMode(ERoundingMode::HalfToEven)
+			.SetMinimumIntegralDigits(1)
+			.SetMaximumIntegralDigits(324)
+			.SetMinimumFractionalDigits(0)
+			.SetMaximumFractionalDigits(Case.Precision);
+		return Options;
+	}
+
+	// Calls Check(Value, Case) for every value and case until one fails
+	template<typename CheckType>
+	static void ForEachFormat(TArrayView<const double> Values, TArrayView<const FFormatCase> Cases, CheckType&& Check)
+	{
+		for (double Value : Values)
+		{
+			for (const FFormatCase& Case : Cases)
+			{
+				if (!Check(Value, Case)) return;
+			}
+		}
+	}
+
+	static FString ConvDoubleToText(double Value, int32 Precision, bool bForceSign, bool bUseGrouping, int32 MinPrecision = 0)
+	{
+		return UKismetTextLibrary::Conv_DoubleToText(Value, ERoundingMode::HalfToEven, bForceSign, bUseGrouping, 1, 324, MinPrecision, Precision).ToString();
+	}
+
+	// The number as the Format functions print it: a padded fixed number keeps its trailing zeros, a notation prints
+	// the mantissa with the digits of the core (checked against literals in the core tests) and the exponent after it
+	static FString ReferenceNumber(double Value, const FFormatCase& Case)
+	{
+		if (Case.Notation == ENumberNotation::NN_FIXED || !FMath::IsFinite(Value))
+			return ConvDoubleToText(Value, Case.Precision, Case.bForceSign, Case.bUseGrouping, Case.StableWidth > 0 ? Case.Precision : 0);
+
+		const TicTacToeUnitCore::FNotationDigits Digits = TicTacToeUnitCore::GetNotationDigits(Value, (TicTacToeUnitCore::ENotation)Case.Notation, Case.Precision);
+		const double Mantissa = TicTacToeUnitCore::GetNotationMantissa(Value, Digits);
+
+		FString Number = ConvDoubleToText(Mantissa, Digits.FractionalDigits, Case.bForceSign, Case.bUseGrouping, Digits.FractionalDigits);
+		if (Digits.Exponent != 0) Number += FString::Printf(TEXT("e%d"), Digits.Exponent);
+		return Number;
+	}
+
+	// Figure spaces before the number and after the suffix fill the stable width, the suffix slot is the family's longest
+	static FString ReferenceText(double Value, const FFormatCase& Case, EUnitFamily Family, const FString& Suffix)
+	{
+		const FString Number = ReferenceNumber(Value, Case);
+		if (Case.StableWidth <= 0) return Number + Suffix;
+
+		const int32 SuffixSlot = UTicTacToeUnitFormatBPLibrary::GetStableSuffixWidth(Family);
+		return FString::ChrN(FMath::Max(Case.StableWidth - SuffixSlot - Number.Len(), 0), TEXT('\u2007'))
+			+ Number + Suffix
+			+ FString::ChrN(FMath::Max(SuffixSlot - Suffix.Len(), 0), TEXT('\u2007'));
+	}
+
+	static bool CompareFormat(FAutomationTestBase& Test, const FString& Path, double Value, const FFormatCase& Case, const FString& Actual, const FString& Expected)
+	{
+		if (Actual.Equals(Expected, ESearchCase::CaseSensitive)) return true;
+
+		Test.AddError(FString::Printf(TEXT("%s: %.17g (%s) gives '%s', reference '%s'"), *Path, Value, *Case.ToString(), *Actual, *Expected));
+		return false;
+	}
+
+	// Units of the family with a conversion and a display string
+	static TArray<uint8> GetFormattableUnits(EUnitFamily Family)
+	{
+		TArray<uint8> Units;
+		const UEnum* UnitEnum = GetUnitEnum(Family);
+		if (!UnitEnum) return Units;
+
+		for (int32 unit = 0; unit < UnitEnum->NumEnums() - 1; ++unit)
+		{
+			if (FTicTacToeAffine::Find(Family, (uint8)unit, (uint8)unit) && FTicTacToeUnitDisplayStrings::Find(Family, (uint8)unit)) Units.Add((uint8)unit);
+		}
+		return Units;
+	}
+
+	static FString GetSuffix(EUnitFamily Family, uint8 Unit)
+	{
+		const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(Family, Unit);
+		return unit_string ? unit_string->ToString() : FString();
+	}
+
+	static FString GetPairName(EUnitFamily Family, uint8 FromUnit, uint8 ToUnit)
+	{
+		const UEnum* UnitEnum = GetUnitEnum(Family);
+		return UnitEnum->GetNameStringByValue(FromUnit) + TEXT(" -> ") + UnitEnum->GetNameStringByValue(ToUnit);
+	}
+
+	static void CheckNumberFormatting(FAutomationTestBase& Test, TArrayView<const double> Values)
+	{
+		const FDecimalNumberFormattingRules& Rules = FInternationalization::Get().GetCurrentLocale()->GetDecimalNumberFormattingRules();
+
+		const TArray<FFormatCase> Cases = GetFixedCases();
+		ForEachFormat(Values, Cases, [&](double Value, const FFormatCase& Case)
+		{
+			const FString Expected = ConvDoubleToText(Value, Case.Precision, Case.bForceSign, Case.bUseGrouping);
+			const FString Actual = FastDecimalFormat::NumberToString(Value, Rules, MakeOptions(Case));
+			return CompareFormat(Test, TEXT("STicTacToeUnitReadout"), Value, Case, Actual, Expected);
+		});
+	}
+
+	// FormatUnit is the value converted by ConvertUnit and printed by the reference, in the canonical unit for every
+	// case, in every unit pair and in the unit GetDisplayUnit picks for every auto unit ladder on PairValues
+	static void CheckUnitFormatting(FAutomationTestBase& Test, EUnitFamily Family, TArrayView<const double> Values, TArrayView<const double> PairValues)
+	{
+		using Library = UTicTacToeUnitFormatBPLibrary;
+
+		const uint8 canonical_unit = FTicTacToeUnitBatch::GetCanonicalUnit(Family);
+		const TArray<uint8> Units = GetFormattableUnits(Family);
+		if (!Units.Contains(canonical_unit)) return;
+
+		const TArray<FFormatCase> Cases = GetFormatCases();
+		ForEachFormat(Values, Cases, [&](double Value, const FFormatCase& Case)
+		{
+			const FString Expected = ReferenceText(Library::ConvertUnit(Value, Family, canonical_unit, canonical_unit), Case, Family, GetSuffix(Family, canonical_unit));
+			const FString Actual = Library::FormatUnit(Value, Family, canonical_unit, canonical_unit, 0, Case.Precision, Case.bForceSign, Case.bUseGrouping, Case.StableWidth, Case.Notation).ToString();
+			return CompareFormat(Test, TEXT("FormatUnit"), Value, Case, Actual, Expected);
+		});
+
+		const TArray<FFormatCase> PairCases = GetPairCases();
+		for (const uint8 from_unit : Units)
+		{
+			for (const uint8 to_unit : Units)
+			{
+				const FString Path = TEXT("FormatUnit ") + GetPairName(Family, from_unit, to_unit);
+				ForEachFormat(PairValues, PairCases, [&](double Value, const FFormatCase& Case)
+				{
+					const FString Expected = ReferenceText(Library::ConvertUnit(Value, Family, from_unit, to_unit), Case, Family, GetSuffix(Family, to_unit));
+					const FString Actual = Library::FormatUnit(Value, Family, from_unit, to_unit, 0, Case.Precision, Case.bForceSign, Case.bUseGrouping, Case.StableWidth, Case.Notation).ToString();
+					return CompareFormat(Test, Path, Value, Case, Actual, Expected);
+				});
+			}
+
+			// Every auto unit type the family has, time only knows on and off
+			for (uint8 auto_unit = 1; auto_unit <= (Family == EUnitFamily::UF_TIME ? 1 : 4); ++auto_unit)
+			{
+				TArray<uint8, TInlineAllocator<8>> Ladder;
+				Library::GetAutoUnitLadder(Family, auto_unit, false, Ladder);
+				if (Ladder.IsEmpty()) continue;
+
+				const FString Path = FString::Printf(TEXT("FormatUnit %s auto %d"), *GetPairName(Family, from_unit, canonical_unit), auto_unit);
+				ForEachFormat(PairValues, PairCases, [&](double Value, const FFormatCase& Case)
+				{
+					const uint8 display_unit = Library::GetDisplayUnit(Value, Family, from_unit, canonical_unit, auto_unit, false);
+					const FString Expected = ReferenceText(Library::ConvertUnit(Value, Family, from_unit, display_unit), Case, Family, GetSuffix(Family, display_unit));
+					const FString Actual = Library::FormatUnit(Value, Family, from_unit, canonical_unit, auto_unit, Case.Precision, Case.bForceSign, Case.bUseGrouping, Case.StableWidth, Case.Notation).ToString();
+					return CompareFormat(Test, Path, Value, Case, Actual, Expected);
+				});
+			}
+		}
+	}
+
+	// FormatUnitToWidth prints one of the ladder units at a precision up to MaxPrecision, so its text must be one of those
+	// candidates. It fits when any candidate fits and then no more digits of the same unit would, when none fits it
+	// is the shortest candidate.
+	static void CheckWidthFormatting(FAutomationTestBase& Test, EUnitFamily Family, TArrayView<const double> Values)
+	{
+		using Library = UTicTacToeUnitFormatBPLibrary;
+
+		static constexpr int32 MaxPrecision = 3;
+
+		const uint8 canonical_unit = FTicTacToeUnitBatch::GetCanonicalUnit(Family);
+		if (!GetFormattableUnits(Family).Contains(canonical_unit)) return;
+
+		struct FCandidate
+		{
+			uint8 Unit;
+			int32 Precision;
+			FString Text;
+		};
+		TArray<FCandidate> Candidates;
+
+		for (uint8 auto_unit = 0; auto_unit <= (Family == EUnitFamily::UF_TIME ? 1 : 4); ++auto_unit)
+		{
+			TArray<uint8, TInlineAllocator<8>> Ladder;
+			Library::GetAutoUnitLadder(Family, auto_unit, false, Ladder);
+			if (auto_unit != 0 && Ladder.IsEmpty()) continue;
+			if (Ladder.IsEmpty()) Ladder.Add(canonical_unit);
+
+			for (double Value : Values)
+			{
+				if (!FMath::IsFinite(Value)) continue;
+
+				for (const int32 MaxCharacters : { 4, 6, 9, 12 })
+				{
+					for (int32 Flags = 0; Flags < 4; ++Flags)
+					{
+						const bool bForceSign = (Flags & 1) != 0;
+						const bool bUseGrouping = (Flags & 2) != 0;
+						const FString Actual = Library::FormatUnitToWidth(Value, Family, canonical_unit, canonical_unit, auto_unit, false, MaxCharacters, MaxPrecision, bForceSign, bUseGrouping).ToString();
+
+						Candidates.Reset();
+						int32 Shortest = MAX_int32;
+						bool bAnyFits = false;
+						for (const uint8 unit : Ladder)
+						{
+							const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(Family, unit);
+							if (!unit_string) continue;
+
+							const double value_converted = Library::ConvertUnit(Value, Family, canonical_unit, unit);
+							for (int32 Precision = 0; Precision <= MaxPrecision; ++Precision)
+							{
+								FCandidate& Candidate = Candidates.Add_GetRef({ unit, Precision, ConvDoubleToText(value_converted, Precision, bForceSign, bUseGrouping) + unit_string->ToString() });
+								Shortest = FMath::Min(Shortest, Candidate.Text.Len());
+								bAnyFits |= Candidate.Text.Len() <= MaxCharacters;
+							}
+						}
+
+						const FString Name = FString::Printf(TEXT("FormatUnitToWidth %s auto %d: %.17g in %d characters%s%s gives '%s'"),
+							*GetUnitEnum(Family)->GetNameStringByValue(canonical_unit), auto_unit, Value, MaxCharacters, bForceSign ? TEXT(", sign") : TEXT(""), bUseGrouping ? TEXT(", grouping") : TEXT(""), *Actual);
+
+						const FCandidate* Match = Candidates.FindByPredicate([&](const FCandidate& Candidate) { return Candidate.Text.Equals(Actual, ESearchCase::CaseSensitive); });
+						if (!Match)
+						{
+							Test.AddError(Name + TEXT(", not Conv_DoubleToText in a ladder unit"));
+							return;
+						}
+						if (!bAnyFits)
+						{
+							if (Actual.Len() == Shortest) continue;
+
+							Test.AddError(FString::Printf(TEXT("%s, nothing fits and the shortest text has %d characters"), *Name, Shortest));
+							return;
+						}
+						if (Actual.Len() > MaxCharacters)
+						{
+							Test.AddError(Name + TEXT(", which does not fit when another text does"));
+							return;
+						}
+
+						const FCandidate* MoreDigits = Candidates.FindByPredicate([&](const FCandidate& Candidate)
+						{
+							return Candidate.Unit == Match->Unit && Candidate.Precision > Match->Precision && Candidate.Text.Len() <= MaxCharacters && !Candidate.Text.Equals(Actual, ESearchCase::CaseSensitive);
+						});
+						if (MoreDigits)
+						{
+							Test.AddError(FString::Printf(TEXT("%s, '%s' has more digits and fits"), *Name, *MoreDigits->Text));
+							return;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Integer data sizes and rates that are not all doubles: small counts, ladder edges, 2^53 - 1 and random magnitudes
+	static TArray<int64> GetIntegerValues(FRandomStream& Random, int32 NumRandom)
+	{
+		TArray<int64> Values = { 0, 1, -1, 3, -3, 4, 12, -12, 999, 1000, 1023, 1024, 1536, -1536, 7999, 8000, 999999, 1000000, 1048575, 1048576,
+			123456789, (int64(1) << 40) + 12345, (int64(1) << 53) - 1, -((int64(1) << 53) - 1) };
+
+		for (int32 Index = 0; Index < NumRandom; ++Index)
+		{
+			const uint64 Bits = (uint64(Random.GetUnsignedInt()) << 32) | Random.GetUnsignedInt();
+			const int64 Magnitude = int64(Bits >> Random.RandRange(1, 63));
+			Values.Add(Random.GetFraction() < 0.5 ? -Magnitude : Magnitude);
+		}
+		return Values;
+	}
+
+	static bool GetDataRatio(EUnitFamily Family, uint8 FromUnit, uint8 ToUnit, FTicTacToeUnitRatio& OutRatio)
+	{
+		return Family == EUnitFamily::UF_DATA_SIZE
+			? FTicTacToeFixedPoint::GetRatio((EDataSizeUnit)FromUnit, (EDataSizeUnit)ToUnit, OutRatio)
+			: FTicTacToeFixedPoint::GetRatio((EDataRateUnit)FromUnit, (EDataRateUnit)ToUnit, OutRatio);
+	}
+
+	// The exact result as a double: the reduced ratio divides by a power of two and the product stays within 2^53
+	static bool GetExactDouble(int64 Value, const FTicTacToeUnitRatio& Ratio, double& OutValue)
+	{
+		if (Ratio.Denominator <= 0 || !FMath::IsPowerOfTwo(Ratio.Denominator)) return false;
+
+		const uint64 Magnitude = Value < 0 ? uint64(0) - uint64(Value) : uint64(Value);
+		if (Ratio.Numerator != 0 && Magnitude > (uint64(1) << 53) / uint64(FMath::Abs(Ratio.Numerator))) return false;
+
+		OutValue = (double)Value * (double)Ratio.Numerator / (double)Ratio.Denominator;
+		return true;
+	}
+
+	// FormatDataSizeInt64 and FormatDataRateInt64 against the reference of the exact result, in every unit pair and in
+	// the unit GetDisplayUnit picks for every auto unit, on values where the exact result is a double
+	static void CheckDataInt64Formatting(FAutomationTestBase& Test, EUnitFamily Family, TArrayView<const int64> Values)
+	{
+		using Library = UTicTacToeUnitFormatBPLibrary;
+
+		const auto Format = [Family](int64 Value, uint8 FromUnit, uint8 ToUnit, uint8 AutoUnit, const FFormatCase& Case)
+		{
+			return Family == EUnitFamily::UF_DATA_SIZE
+				? Library::FormatDataSizeInt64(Value, (EDataSizeUnit)FromUnit, (EDataSizeUnit)ToUnit, (EAutoDataUnitType)AutoUnit, false, Case.Precision, Case.bForceSign, Case.bUseGrouping, Case.StableWidth, Case.Notation).ToString()
+				: Library::FormatDataRateInt64(Value, (EDataRateUnit)FromUnit, (EDataRateUnit)ToUnit, (EAutoDataUnitType)AutoUnit, false, Case.Precision, Case.bForceSign, Case.bUseGrouping, Case.StableWidth, Case.Notation).ToString();
+		};
+
+		const TArray<uint8> Units = GetFormattableUnits(Family);
+		const TArray<FFormatCase> Cases = GetPairCases();
+
+		for (const uint8 from_unit : Units)
+		{
+			// Auto units 0 (off) to DECIMAL_BITS, the display unit is the fixed target with the auto unit off
+			for (uint8 auto_unit = 0; auto_unit <= (uint8)EAutoDataUnitType::AUT_DECIMAL_BITS; ++auto_unit)
+			{
+				for (const uint8 to_unit : Units)
+				{
+					// With an auto unit the fixed target does not matter, one is enough
+					if (auto_unit != 0 && to_unit != from_unit) continue;
+
+					const FString Path = FString::Printf(TEXT("FormatData%sInt64 %s auto %d"), Family == EUnitFamily::UF_DATA_SIZE ? TEXT("Size") : TEXT("Rate"), *GetPairName(Family, from_unit, to_unit), auto_unit);
+					for (const int64 Value : Values)
+					{
+						const uint8 display_unit = Library::GetDisplayUnit((double)Value, Family, from_unit, to_unit, auto_unit, false);
+
+						FTicTacToeUnitRatio Ratio;
+						double value_converted;
+						if (!GetDataRatio(Family, from_unit, display_unit, Ratio) || !GetExactDouble(Value, Ratio, value_converted)) continue;
+
+						const FString Suffix = GetSuffix(Family, display_unit);
+						for (const FFormatCase& Case : Cases)
+						{
+							if (!CompareFormat(Test, Path, (double)Value, Case, Format(Value, from_unit, to_unit, auto_unit, Case), ReferenceText(value_converted, Case, Family, Suffix))) return;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	template<typename VisitorType>
+	static void ForEachFamily(VisitorType&& Visitor)
+	{
+		const UEnum* FamilyEnum = StaticEnum<EUnitFamily>();
+		for (int32 FamilyIndex = 0; FamilyIndex < FamilyEnum->NumEnums() - 1; ++FamilyIndex)
+		{
+			Visitor((EUnitFamily)FamilyEnum->GetValueByIndex(FamilyIndex));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTicTacToeUnitConversionAccuracyTest, "TicTacToeUnitFormat.Accuracy.Conversions",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTicTacToeUnitConversionAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace TicTacToeUnitAccuracy;
+
+	FTicTacToeAffine::Initialize();
+
+	FRandomStream Random(Seed);
+	const TArray<double> Values = GetConversionValues(Random);
+
+	TArray<FPairResult> Results;
+	ForEachFamily([&](EUnitFamily Family) { CheckFamily(*this, Family, Values, Results); });
+	CheckSpeed(Values, Results);
+
+	if (!TestFalse(TEXT("Unit pairs with an exact reference"), Results.IsEmpty())) return false;
+
+	// Worst pairs first, every pair is reported with the input of its worst error
+	Results.StableSort([](const FPairResult& A, const FPairResult& B) { return A.WorstUlp > B.WorstUlp; });
+
+	AddInfo(FString::Printf(TEXT("%d unit pairs on %d values, worst %llu ulp, at most %llu allowed"), Results.Num(), Values.Num(), Results[0].WorstUlp, MaxUlp));
+	AddInfo(FPairResult::GetTableHeader());
+	for (const FPairResult& Result : Results)
+	{
+		if (Result.WorstUlp > MaxUlp) AddError(Result.ToString());
+		AddInfo(Result.ToTableRow());
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTicTacToeUnitFormattingAccuracyTest, "TicTacToeUnitFormat.Accuracy.Formatting",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTicTacToeUnitFormattingAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace TicTacToeUnitAccuracy;
+
+	FTicTacToeAffine::Initialize();
+
+	FRandomStream Random(Seed);
+	const TArray<double> Values = GetFormattingValues(Random, NumSamples / 4);
+	const TArray<int64> IntegerValues = GetIntegerValues(Random, NumSamples / 4);
+
+	// Unit pairs, auto units and widths multiply the runs, they take every 8th value
+	TArray<double> PairValues;
+	for (int32 Index = 0; Index < Values.Num(); Index += 8)
+	{
+		PairValues.Add(Values[Index]);
+	}
+
+	ForEachFamily([&](EUnitFamily Family)
+	{
+		CheckUnitFormatting(*this, Family, Values, PairValues);
+		CheckWidthFormatting(*this, Family, PairValues);
+	});
+	CheckDataInt64Formatting(*this, EUnitFamily::UF_DATA_SIZE, IntegerValues);
+	CheckDataInt64Formatting(*this, EUnitFamily::UF_DATA_RATE, IntegerValues);
+	CheckNumberFormatting(*this, Values);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitAffine.h"
+#include "TicTacToeUnitFixedPoint.h"
+
+namespace TicTacToeUnitAffineTest
+{
+	// From -> To -> From on Values [First, Last] / Divisor, every one must come back with the same bits
+	template<typename UnitType, typename ConvertType>
+	static void CheckRoundTrip(FAutomationTestBase& Test, const TCHAR* Name, UnitType FromUnit, UnitType ToUnit, int32 First, int32 Last, double Divisor, ConvertType&& Convert)
+	{
+		for (int32 Index = First; Index <= Last; ++Index)
+		{
+			const double Value = Index / Divisor;
+			const double Converted = Convert(Value, FromUnit, ToUnit);
+			const double Back = Convert(Converted, ToUnit, FromUnit);
+			if (Back != Value)
+			{
+				Test.AddError(FString::Printf(TEXT("%s: %.17g gives %.17g and back %.17g"), Name, Value, Converted, Back));
+				return;
+			}
+		}
+	}
+
+	static void CheckTemperatureRoundTrip(FAutomationTestBase& Test, const TCHAR* Name, ETemperatureUnit FromUnit, ETemperatureUnit ToUnit, int32 First, int32 Last, double Divisor)
+	{
+		CheckRoundTrip(Test, Name, FromUnit, ToUnit, First, Last, Divisor, &UTicTacToeUnitFormatBPLibrary::ConvertTemperature);
+	}
+
+	static void CheckPressureRoundTrip(FAutomationTestBase& Test, const TCHAR* Name, EPressureUnit FromUnit, EPressureUnit ToUnit, int32 First, int32 Last, double Divisor)
+	{
+		CheckRoundTrip(Test, Name, FromUnit, ToUnit, First, Last, Divisor, &UTicTacToeUnitFormatBPLibrary::ConvertPressure);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTicTacToeUnitAffineExactTest, "TicTacToeUnitFormat.Affine.Exact",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTicTacToeUnitAffineExactTest::RunTest(const FString& Parameters)
+{
+	using Library = UTicTacToeUnitFormatBPLibrary;
+
+	TestEqual(TEXT("100 C in F"), Library::ConvertTemperature(100.0, ETemperatureUnit::TU_CEL, ETemperatureUnit::TU_FAR), 212.0);
+	TestEqual(TEXT("-40 C in F"), Library::ConvertTemperature(-40.0, ETemperatureUnit::TU_CEL, ETemperatureUnit::TU_FAR), -40.0);
+	TestEqual(TEXT("0 C in K"), Library::ConvertTemperature(0.0, ETemperatureUnit::TU_CEL, ETemperatureUnit::TU_KEL), 273.15);
+	TestEqual(TEXT("0 K in F"), Library::ConvertTemperature(0.0, ETemperatureUnit::TU_KEL, ETemperatureUnit::TU_FAR), -459.67);
+
+	TestEqual(TEXT("0 barg in Pa"), Library::ConvertPressure(0.0, EPressureUnit::PU_MET_BARG, EPressureUnit::PU_MET_PA), 101325.0);
+	TestEqual(TEXT("0 psig in Pa"), Library::ConvertPressure(0.0, EPressureUnit::PU_US_PSIG, EPressureUnit::PU_MET_PA), 101325.0);
+	TestEqual(TEXT("101325 Pa in barg"), Library::ConvertPressure(101325.0, EPressureUnit::PU_MET_PA, EPressureUnit::PU_MET_BARG), 0.0);
+	TestEqual(TEXT("101325 Pa in psig"), Library::ConvertPressure(101325.0, EPressureUnit::PU_MET_PA, EPressureUnit::PU_US_PSIG), 0.0);
+
+	// Gauge units have no ratio, the fixed-point path refuses them instead of reporting an overflow
+	FTicTacToeUnitRatio Ratio;
+	TestFalse(TEXT("barg fixed-point ratio"), FTicTacToeFixedPoint::GetRatio(EPressureUnit::PU_MET_BARG, EPressureUnit::PU_MET_PA, Ratio));
+	TestFalse(TEXT("psig fixed-point ratio"), FTicTacToeFixedPoint::GetRatio(EPressureUnit::PU_MET_PA, EPressureUnit::PU_US_PSIG, Ratio));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTicTacToeUnitAffineRoundTripTest, "TicTacToeUnitFormat.Affine.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTicTacToeUnitAffineRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace TicTacToeUnitAffineTest;
+
+	// Whole degrees C, whole and tenth degrees F
+	CheckTemperatureRoundTrip(*this, TEXT("C -> F -> C"), ETemperatureUnit::TU_CEL, ETemperatureUnit::TU_FAR, -273, 5000, 1.0);
+	CheckTemperatureRoundTrip(*this, TEXT("F -> C -> F"), ETemperatureUnit::TU_FAR, ETemperatureUnit::TU_CEL, -4596, 50000, 10.0);
+
+	// Tenths of a degree both ways
+	CheckTemperatureRoundTrip(*this, TEXT("C -> K -> C"), ETemperatureUnit::TU_CEL, ETemperatureUnit::TU_KEL, -2731, 50000, 10.0);
+	CheckTemperatureRoundTrip(*this, TEXT("K -> C -> K"), ETemperatureUnit::TU_KEL, ETemperatureUnit::TU_CEL, 0, 50000, 10.0);
+
+	// Tenths of a bar gauge, vacuum included
+	CheckPressureRoundTrip(*this, TEXT("barg -> Pa -> barg"), EPressureUnit::PU_MET_BARG, EPressureUnit::PU_MET_PA, -10, 10000, 10.0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
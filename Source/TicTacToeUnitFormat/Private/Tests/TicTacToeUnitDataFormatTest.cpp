@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitDisplayStrings.h"
+#include "Internationalization/Internationalization.h"
+#include "Kismet/KismetTextLibrary.h"
+
+/*
+*	FormatDataSizeInt64 in fixed notation prints the exact quotient and remainder with FormatDecimal. Past 2^53 the digits
+*	are checked against literals in en-US, below it against Conv_DoubleToText of the exactly representable value, which
+*	also pins the sign rules: a negative that rounds to zero keeps its minus sign, ForceSign puts a plus on zero.
+*/
+namespace TicTacToeUnitDataFormatTest
+{
+	static FString Format(int64 Value, EDataSizeUnit FromUnit, EDataSizeUnit ToUnit, int32 Precision, bool bForceSign, bool bUseGrouping)
+	{
+		return UTicTacToeUnitFormatBPLibrary::FormatDataSizeInt64(Value, FromUnit, ToUnit, EAutoDataUnitType::AUT_OFF, false, Precision, bForceSign, bUseGrouping).ToString();
+	}
+
+	static FString GetSuffix(EDataSizeUnit Unit)
+	{
+		const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(EUnitFamily::UF_DATA_SIZE, (uint8)Unit);
+		return unit_string ? unit_string->ToString() : FString();
+	}
+
+	// Digits are the en-US text without and with grouping
+	static void CheckExact(FAutomationTestBase& Test, int64 Value, EDataSizeUnit FromUnit, EDataSizeUnit ToUnit, int32 Precision, const TCHAR* Digits, const TCHAR* GroupedDigits)
+	{
+		const FString Name = FString::Printf(TEXT("%lld at precision %d"), Value, Precision);
+		Test.TestEqual(Name, Format(Value, FromUnit, ToUnit, Precision, false, false), Digits + GetSuffix(ToUnit));
+		Test.TestEqual(Name + TEXT(" grouped"), Format(Value, FromUnit, ToUnit, Precision, false, true), GroupedDigits + GetSuffix(ToUnit));
+	}
+
+	// Converted is the exact result, representable as a double, so Conv_DoubleToText prints the reference digits
+	static void CheckAgainstDouble(FAutomationTestBase& Test, int64 Value, EDataSizeUnit FromUnit, EDataSizeUnit ToUnit, double Converted, int32 Precision)
+	{
+		for (int32 Flags = 0; Flags < 4; ++Flags)
+		{
+			const bool bForceSign = (Flags & 1) != 0;
+			const bool bUseGrouping = (Flags & 2) != 0;
+
+			const FString Expected = UKismetTextLibrary::Conv_DoubleToText(Converted, ERoundingMode::HalfToEven, bForceSign, bUseGrouping, 1, 324, 0, Precision).ToString() + GetSuffix(ToUnit);
+			Test.TestEqual(FString::Printf(TEXT("%lld as %.17g at precision %d%s%s"), Value, Converted, Precision, bForceSign ? TEXT(", sign") : TEXT(""), bUseGrouping ? TEXT(", grouping") : TEXT("")),
+				Format(Value, FromUnit, ToUnit, Precision, bForceSign, bUseGrouping), Expected);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTicTacToeUnitDataFormatInt64Test, "TicTacToeUnitFormat.Data.Int64",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTicTacToeUnitDataFormatInt64Test::RunTest(const FString& Parameters)
+{
+	using namespace TicTacToeUnitDataFormatTest;
+
+	FInternationalization::FCultureStateSnapshot CultureState;
+	FInternationalization::Get().BackupCultureState(CultureState);
+	FInternationalization::Get().SetCurrentCulture(TEXT("en-US"));
+
+	// Past 2^53 a double would print 9007199254740992
+	CheckExact(*this, 9007199254740993, EDataSizeUnit::DS_BYTE, EDataSizeUnit::DS_BYTE, 1, TEXT("9007199254740993"), TEXT("9,007,199,254,740,993"));
+	CheckExact(*this, MAX_int64, EDataSizeUnit::DS_BYTE, EDataSizeUnit::DS_BYTE, 1, TEXT("9223372036854775807"), TEXT("9,223,372,036,854,775,807"));
+	CheckExact(*this, MIN_int64, EDataSizeUnit::DS_BYTE, EDataSizeUnit::DS_BYTE, 1, TEXT("-9223372036854775808"), TEXT("-9,223,372,036,854,775,808"));
+
+	// Bits to bytes, ties past 2^53 go to the even last digit
+	CheckExact(*this, 9007199254740993, EDataSizeUnit::DS_BIT, EDataSizeUnit::DS_BYTE, 3, TEXT("1125899906842624.125"), TEXT("1,125,899,906,842,624.125"));
+	CheckExact(*this, 9007199254740993, EDataSizeUnit::DS_BIT, EDataSizeUnit::DS_BYTE, 2, TEXT("1125899906842624.12"), TEXT("1,125,899,906,842,624.12"));
+	CheckExact(*this, MAX_int64, EDataSizeUnit::DS_BIT, EDataSizeUnit::DS_BYTE, 2, TEXT("1152921504606846975.88"), TEXT("1,152,921,504,606,846,975.88"));
+	CheckExact(*this, MAX_int64, EDataSizeUnit::DS_BIT, EDataSizeUnit::DS_BYTE, 0, TEXT("1152921504606846976"), TEXT("1,152,921,504,606,846,976"));
+	CheckExact(*this, MIN_int64, EDataSizeUnit::DS_BIT, EDataSizeUnit::DS_BYTE, 2, TEXT("-1152921504606846976"), TEXT("-1,152,921,504,606,846,976"));
+
+	// Small ties and negatives that round to zero, in the current culture
+	FInternationalization::Get().RestoreCultureState(CultureState);
+
+	for (const int64 Bits : { 4, 12, 20, -4, -12, -1, 1, 0 })
+	{
+		CheckAgainstDouble(*this, Bits, EDataSizeUnit::DS_BIT, EDataSizeUnit::DS_BYTE, Bits / 8.0, 0);
+	}
+	for (const int64 Bits : { 1, 3, 5, -1, -3, 7 })
+	{
+		CheckAgainstDouble(*this, Bits, EDataSizeUnit::DS_BIT, EDataSizeUnit::DS_BYTE, Bits / 8.0, 2);
+	}
+	CheckAgainstDouble(*this, 1234567, EDataSizeUnit::DS_BIT, EDataSizeUnit::DS_BYTE, 1234567 / 8.0, 3);
+	CheckAgainstDouble(*this, -1, EDataSizeUnit::DS_KIB, EDataSizeUnit::DS_MIB, -1.0 / 1024.0, 2);
+	CheckAgainstDouble(*this, 1536, EDataSizeUnit::DS_KIB, EDataSizeUnit::DS_MIB, 1.5, 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
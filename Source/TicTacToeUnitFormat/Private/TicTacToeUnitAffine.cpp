@@ -0,0 +1,163 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitAffine.h"
+#include "TicTacToeUnitBatch.h"
+#include "TicTacToeUnitDerived.h"
+#include "TicTacToeUnitFixedPoint.h"
+
+namespace TicTacToeUnitAffine
+{
+	// Units are addressed by their uint8 value, only the first 2^UnitBits can exist
+	static constexpr int32 MaxUnits = 1 << FTicTacToeQuantity::UnitBits;
+
+	using TicTacToeUnitCore::FUnitDefinition;
+	using TicTacToeUnitCore::Compose;
+
+	static bool GetTemperatureDefinition(uint8 Unit, FUnitDefinition& OutDefinition)
+	{
+		if (Unit >= UE_ARRAY_COUNT(TicTacToeUnitCore::TemperatureToK)) return false;
+		OutDefinition = TicTacToeUnitCore::TemperatureToK[Unit];
+		return true;
+	}
+
+	static bool GetPressureDefinition(uint8 Unit, FUnitDefinition& OutDefinition)
+	{
+		EPressureUnit LinearUnit = (EPressureUnit)Unit;
+		int64 Offset = 0;
+		switch ((EPressureUnit)Unit)
+		{
+		case EPressureUnit::PU_MET_BARG:	LinearUnit = EPressureUnit::PU_MET_BAR; Offset = TicTacToeUnitCore::StandardAtmospherePa; break;
+		case EPressureUnit::PU_US_PSIG:		LinearUnit = EPressureUnit::PU_MET_PSI; Offset = TicTacToeUnitCore::StandardAtmospherePa; break;
+		default: break;
+		}
+
+		FTicTacToeUnitRatio Ratio;
+		if (!FTicTacToeFixedPoint::GetRatio(LinearUnit, EPressureUnit::PU_MET_PA, Ratio)) return false;
+
+		OutDefinition = { { Ratio.Numerator, Ratio.Denominator }, { Offset, 1 } };
+		return true;
+	}
+
+	struct FFamilyTable
+	{
+		int32 NumUnits = 0;
+		TArray<FTicTacToeAffineTransform> Transforms;
+		TBitArray<> Valid;
+
+		const FTicTacToeAffineTransform* Find(uint8 FromUnit, uint8 ToUnit) const
+		{
+			if (FromUnit >= NumUnits || ToUnit >= NumUnits) return nullptr;
+
+			const int32 Index = FromUnit * NumUnits + ToUnit;
+			return Valid[Index] ? &Transforms[Index] : nullptr;
+		}
+	};
+
+	static FFamilyTable BuildFamilyTable(EUnitFamily Family)
+	{
+		const bool bAffine = Family == EUnitFamily::UF_TEMPERATURE || Family == EUnitFamily::UF_PRESSURE;
+		const uint8 canonical_unit = FTicTacToeUnitBatch::GetCanonicalUnit(Family);
+
+		// Per unit: exact definition for the offset families, table factor for the others, composed from the base tables for the derived ones
+		FUnitDefinition Definitions[MaxUnits];
+		double Factors[MaxUnits] = {};
+		TBitArray<> Defined(false, MaxUnits);
+
+		for (int32 unit = 0; unit < MaxUnits; ++unit)
+		{
+			switch (Family)
+			{
+			case EUnitFamily::UF_TEMPERATURE:	Defined[unit] = GetTemperatureDefinition((uint8)unit, Definitions[unit]); break;
+			case EUnitFamily::UF_PRESSURE:		Defined[unit] = GetPressureDefinition((uint8)unit, Definitions[unit]); break;
+			default:
+				// Derived Convert functions read this table, their factors cannot come from ConvertUnit
+				Factors[unit] = FTicTacToeDerivedUnits::IsDerived(Family)
+					? FTicTacToeDerivedUnits::GetFactor(Family, (uint8)unit)
+					: UTicTacToeUnitFormatBPLibrary::ConvertUnit(1.0, Family, (uint8)unit, canonical_unit);
+				Defined[unit] = Factors[unit] != 0.0 && FMath::IsFinite(Factors[unit]);
+				break;
+			}
+		}
+
+		FFamilyTable Table;
+		Table.NumUnits = Defined.FindLast(true) + 1;
+		Table.Transforms.SetNum(Table.NumUnits * Table.NumUnits);
+		Table.Valid.Init(false, Table.NumUnits * Table.NumUnits);
+
+		for (int32 from = 0; from < Table.NumUnits; ++from)
+		{
+			for (int32 to = 0; to < Table.NumUnits; ++to)
+			{
+				if (!Defined[from] || !Defined[to]) continue;
+
+				const int32 Index = from * Table.NumUnits + to;
+				FTicTacToeAffineTransform& Transform = Table.Transforms[Index];
+				if (bAffine)
+				{
+					Transform = Compose(Definitions[from], Definitions[to]);
+				}
+				else
+				{
+					// Same (Value * FromFactor) / ToFactor as the Convert functions
+					Transform.Numerator = Factors[from];
+					Transform.Denominator = Factors[to];
+				}
+				Table.Valid[Index] = true;
+			}
+		}
+
+		return Table;
+	}
+
+	static const TArray<FFamilyTable>& GetTables()
+	{
+		// Every value the family bits can hold, families that do not exist end up with no unit
+		static const TArray<FFamilyTable> Tables = []()
+		{
+			TArray<FFamilyTable> Result;
+			Result.SetNum(1 << FTicTacToeQuantity::FamilyBits);
+			for (int32 Family = 0; Family < Result.Num(); ++Family)
+			{
+				Result[Family] = BuildFamilyTable((EUnitFamily)Family);
+			}
+			return Result;
+		}();
+		return Tables;
+	}
+}
+
+void FTicTacToeAffine::Initialize()
+{
+	TicTacToeUnitAffine::GetTables();
+}
+
+const FTicTacToeAffineTransform* FTicTacToeAffine::Find(EUnitFamily Family, uint8 FromUnit, uint8 ToUnit)
+{
+	const TArray<TicTacToeUnitAffine::FFamilyTable>& Tables = TicTacToeUnitAffine::GetTables();
+	return Tables.IsValidIndex((int32)Family) ? Tables[(int32)Family].Find(FromUnit, ToUnit) : nullptr;
+}
+
+void FTicTacToeAffine::Apply(TArrayView<const double> Values, const FTicTacToeAffineTransform& Transform, TArrayView<double> OutValues)
+{
+	check(Values.Num() == OutValues.Num());
+
+	const double* Source = Values.GetData();
+	double* Target = OutValues.GetData();
+	const int32 Count = Values.Num();
+
+	const VectorRegister4Double Numerator = VectorSetFloat1(Transform.Numerator);
+	const VectorRegister4Double Offset = VectorSetFloat1(Transform.Offset);
+	const VectorRegister4Double Denominator = VectorSetFloat1(Transform.Denominator);
+
+	// Multiply, add and divide as separate steps like the scalar path, a fused multiply-add would round differently
+	int32 Index = 0;
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		const VectorRegister4Double Scaled = VectorMultiply(VectorLoad(Source + Index), Numerator);
+		VectorStore(VectorDivide(VectorAdd(Scaled, Offset), Denominator), Target + Index);
+	}
+	for (; Index < Count; ++Index)
+	{
+		Target[Index] = Transform.Apply(Source[Index]);
+	}
+}
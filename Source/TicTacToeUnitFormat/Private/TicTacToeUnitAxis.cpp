@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitAxis.h"
+#include "TicTacToeUnitAffine.h"
+#include "TicTacToeUnitDisplayStrings.h"
+#include "TicTacToeUnitPreferenceSubsystem.h"
+#include "TicTacToeUnitSIPrefix.h"
+
+namespace TicTacToeUnitAxis
+{
+	// Tick indices are exact integers in a double up to 2^53
+	static constexpr double MaxTickIndex = 9007199254740992.0;
+
+	static constexpr int32 MaxTicksLimit = 1000;
+
+	// Index * Mantissa x 10^Exponent, divided by an exact power of ten when Exponent < 0 so the result is correctly rounded
+	static double GetTickValue(int64 Index, int32 Mantissa, int32 Exponent)
+	{
+		const double Multiple = double(Index * Mantissa);
+		return Exponent >= 0 ? Multiple * FTicTacToeSIPrefix::GetPowerOfTen(Exponent) : Multiple / FTicTacToeSIPrefix::GetPowerOfTen(-Exponent);
+	}
+}
+
+void FTicTacToeUnitAxis::GetNiceStep(double Range, int32 MaxTicks, int32& OutMantissa, int32& OutExponent)
+{
+	const double Raw = FMath::Abs(Range) / FMath::Max(MaxTicks - 1, 1);
+	const int32 Exponent = FTicTacToeSIPrefix::GetDecimalExponent(Raw);
+	if (Exponent == MIN_int32)
+	{
+		OutMantissa = 1;
+		OutExponent = 0;
+		return;
+	}
+
+	// Raw is in [1, 10) x 10^Exponent, the step is the first nice mantissa at or above it
+	const double Fraction = Raw / FTicTacToeSIPrefix::GetPowerOfTen(Exponent);
+	OutExponent = Exponent;
+	if (Fraction <= 1.0)		OutMantissa = 1;
+	else if (Fraction <= 2.0)	OutMantissa = 2;
+	else if (Fraction <= 5.0)	OutMantissa = 5;
+	else
+	{
+		OutMantissa = 1;
+		++OutExponent;
+	}
+}
+
+FTicTacToeAxisTicks FTicTacToeUnitAxis::MakeTicks(double Min, double Max, EUnitFamily Family, uint8 FromUnit, uint8 ToUnit, uint8 AutoUnit, bool UseExtendedAutoUnits,
+	int32 MaxTicks, bool ForceSign, bool UseGrouping)
+{
+	using namespace TicTacToeUnitAxis;
+
+	FTicTacToeAxisTicks Ticks;
+	if (!FMath::IsFinite(Min) || !FMath::IsFinite(Max)) return Ticks;
+	if (Min > Max) Swap(Min, Max);
+
+	// One unit for the whole axis, the one the largest magnitude would be displayed in
+	const double Largest = FMath::Abs(Min) > FMath::Abs(Max) ? Min : Max;
+	Ticks.DisplayUnit = UTicTacToeUnitFormatBPLibrary::GetDisplayUnit(Largest, Family, FromUnit, ToUnit, AutoUnit, UseExtendedAutoUnits);
+
+	const FTicTacToeAffineTransform* ToDisplay = FTicTacToeAffine::Find(Family, FromUnit, Ticks.DisplayUnit);
+	const FTicTacToeAffineTransform* ToSource = FTicTacToeAffine::Find(Family, Ticks.DisplayUnit, FromUnit);
+	const FText* UnitString = FTicTacToeUnitDisplayStrings::Find(Family, Ticks.DisplayUnit);
+	if (!ToDisplay || !ToSource || !UnitString) return Ticks;
+
+	double Low = ToDisplay->Apply(Min);
+	double High = ToDisplay->Apply(Max);
+
+	// A single value gets an axis around it
+	if (High - Low <= 0.0)
+	{
+		const double HalfRange = Low != 0.0 ? FMath::Abs(Low) * 0.5 : 0.5;
+		Low -= HalfRange;
+		High += HalfRange;
+	}
+
+	MaxTicks = FMath::Clamp(MaxTicks, 2, MaxTicksLimit);
+	int32 Mantissa, Exponent;
+	GetNiceStep(High - Low, MaxTicks, Mantissa, Exponent);
+
+	Ticks.Step = GetTickValue(1, Mantissa, Exponent);
+	Ticks.Precision = FMath::Max(-Exponent, 0);
+
+	// The range is too narrow for its magnitude to have distinct ticks
+	const double FirstIndex = FMath::CeilToDouble(Low / Ticks.Step);
+	const double LastIndex = FMath::FloorToDouble(High / Ticks.Step);
+	if (FMath::Abs(FirstIndex) > MaxTickIndex || FMath::Abs(LastIndex) > MaxTickIndex) return Ticks;
+
+	const int32 NumTicks = FMath::Clamp(int32(LastIndex - FirstIndex) + 1, 0, MaxTicksLimit);
+	Ticks.Values.Reserve(NumTicks);
+	Ticks.Labels.Reserve(NumTicks);
+
+	// Number options, pattern and unit string are shared by every label
+	FNumberFormattingOptions Options;
+	Options.SetAlwaysSign(ForceSign)
+		.SetUseGrouping(UseGrouping)
+		.SetRoundingMode(ERoundingMode::HalfToEven)
+		.SetMinimumFractionalDigits(Ticks.Precision)
+		.SetMaximumFractionalDigits(Ticks.Precision);
+	const FTextFormat Pattern(FText::FromString("{0}{1}"));
+
+	for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+	{
+		// + 0.0 turns -0 into 0, so the zero tick has no sign
+		const double Displayed = GetTickValue(int64(FirstIndex) + Tick, Mantissa, Exponent) + 0.0;
+		Ticks.Values.Add(ToSource->Apply(Displayed));
+		Ticks.Labels.Add(FText::Format(Pattern, FText::AsNumber(Displayed, &Options), *UnitString));
+	}
+	return Ticks;
+}
+
+FTicTacToeAxisTicks FTicTacToeUnitAxis::MakeTicks(double Min, double Max, EUnitFamily Family, uint8 FromUnit, const UTicTacToeUnitPreferenceSubsystem& Preferences,
+	int32 MaxTicks, bool ForceSign, bool UseGrouping)
+{
+	const FTicTacToeUnitOverride& Unit = Preferences.GetResolvedUnit(Family).Unit;
+	return MakeTicks(Min, Max, Family, FromUnit, Unit.ToUnit, Unit.AutoUnit, Unit.UseExtendedAutoUnits, MaxTicks, ForceSign, UseGrouping);
+}
+
+FTicTacToeAxisTicks UTicTacToeUnitAxisLibrary::MakeAxisTicks(double min, double max, EUnitFamily family, uint8 fromUnit, uint8 toUnit, uint8 AutoUnit, bool UseExtendedAutoUnits,
+	int32 MaxTicks, bool ForceSign, bool UseGrouping)
+{
+	return FTicTacToeUnitAxis::MakeTicks(min, max, family, fromUnit, toUnit, AutoUnit, UseExtendedAutoUnits, MaxTicks, ForceSign, UseGrouping);
+}
+
+FTicTacToeAxisTicks UTicTacToeUnitAxisLibrary::MakePreferredAxisTicks(const UObject* WorldContextObject, double min, double max, EUnitFamily family, uint8 fromUnit,
+	int32 MaxTicks, bool ForceSign, bool UseGrouping)
+{
+	if (const UTicTacToeUnitPreferenceSubsystem* Preferences = UTicTacToeUnitPreferenceSubsystem::Get(WorldContextObject))
+	{
+		return FTicTacToeUnitAxis::MakeTicks(min, max, family, fromUnit, *Preferences, MaxTicks, ForceSign, UseGrouping);
+	}
+
+	const FTicTacToeUnitOverride Unit = UTicTacToeUnitPreferenceSubsystem::GetSystemUnit(EUnitSystem::US_METRIC, family);
+	return FTicTacToeUnitAxis::MakeTicks(min, max, family, fromUnit, Unit.ToUnit, Unit.AutoUnit, Unit.UseExtendedAutoUnits, MaxTicks, ForceSign, UseGrouping);
+}
@@ -0,0 +1,309 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitBatch.h"
+#include "TicTacToeUnitAffine.h"
+
+// Compensated sums rely on the exact order of additions, which /fp:fast is allowed to rearrange
+#if defined(_MSC_VER) && !defined(__clang__)
+#pragma float_control(precise, on, push)
+#endif
+
+namespace TicTacToeUnitBatch
+{
+	// Units are addressed by their uint8 value, only the first 2^UnitBits can exist
+	static constexpr int32 NumUnits = 1 << FTicTacToeQuantity::UnitBits;
+	static constexpr uint8 InvalidUnit = MAX_uint8;
+
+	// Below this an insertion sort beats the histogram passes
+	static constexpr int32 SmallSortThreshold = 64;
+
+	struct FTransform
+	{
+		FTicTacToeAffineTransform Units[256];
+		bool Valid[256];
+	};
+
+	// Transform of every unit to the canonical one, looked up once per call. Unknown units give NaN.
+	static void BuildTransform(EUnitFamily Family, FTransform& OutTransform)
+	{
+		const uint8 canonical_unit = FTicTacToeUnitBatch::GetCanonicalUnit(Family);
+
+		for (int32 unit = 0; unit < 256; ++unit)
+		{
+			const FTicTacToeAffineTransform* Transform = unit < NumUnits ? FTicTacToeAffine::Find(Family, (uint8)unit, canonical_unit) : nullptr;
+			OutTransform.Units[unit] = Transform ? *Transform : FTicTacToeAffineTransform{ NAN, NAN, 1.0 };
+			OutTransform.Valid[unit] = Transform != nullptr;
+		}
+	}
+
+	struct FNeumaierSum
+	{
+		double Sum = 0.0;
+		double Compensation = 0.0;
+
+		void Add(double Value)
+		{
+			const double total = Sum + Value;
+			Compensation += FMath::Abs(Sum) >= FMath::Abs(Value) ? (Sum - total) + Value : (Value - total) + Sum;
+			Sum = total;
+		}
+
+		double Get() const { return Sum + Compensation; }
+	};
+}
+
+uint8 FTicTacToeUnitBatch::GetCanonicalUnit(EUnitFamily Family)
+{
+	switch (Family)
+	{
+	case EUnitFamily::UF_LENGTH:		return (uint8)ELengthUnit::LU_MET_M;
+	case EUnitFamily::UF_WEIGHT:		return (uint8)EWeightUnit::WU_MET_KG;
+	case EUnitFamily::UF_VOLUME:		return (uint8)EVolumeUnit::VU_MET_M3;
+	case EUnitFamily::UF_AREA:			return (uint8)EAreaUnit::AU_MET_M2;
+	case EUnitFamily::UF_TEMPERATURE:	return (uint8)ETemperatureUnit::TU_KEL;
+	case EUnitFamily::UF_TIME:			return (uint8)ETimeUnit::TU_SEC;
+	case EUnitFamily::UF_PRESSURE:		return (uint8)EPressureUnit::PU_MET_PA;
+	case EUnitFamily::UF_ENERGY:		return (uint8)EEnergyUnit::EU_J;
+	case EUnitFamily::UF_ANGLE:			return (uint8)EAngleUnit::AU_DEG;
+	case EUnitFamily::UF_POWER:			return (uint8)EPowerUnit::PW_MET_W;
+	case EUnitFamily::UF_FLOW:			return (uint8)EFlowUnit::FU_MET_M3_S;
+	case EUnitFamily::UF_DENSITY:		return (uint8)EDensityUnit::DU_MET_KG_M3;
+	case EUnitFamily::UF_ACCELERATION:	return (uint8)EAccelerationUnit::AC_MET_M_S2;
+	case EUnitFamily::UF_TORQUE:		return (uint8)ETorqueUnit::TQ_MET_N_M;
+	case EUnitFamily::UF_DATA_SIZE:		return (uint8)EDataSizeUnit::DS_BYTE;
+	case EUnitFamily::UF_DATA_RATE:		return (uint8)EDataRateUnit::DR_BYTE_S;
+	default: return 0;
+	}
+}
+
+bool FTicTacToeUnitBatch::Canonicalize(EUnitFamily Family, TArrayView<const double> Values, TArrayView<const uint8> Units, TArrayView<double> OutValues)
+{
+	using namespace TicTacToeUnitBatch;
+
+	if (Values.Num() != Units.Num() || Values.Num() != OutValues.Num()) return false;
+
+	FTransform Transform;
+	BuildTransform(Family, Transform);
+
+	bool bAllValid = true;
+	for (int32 i = 0; i < Values.Num(); ++i)
+	{
+		const uint8 unit = Units[i];
+		OutValues[i] = Transform.Units[unit].Apply(Values[i]);
+		bAllValid &= Transform.Valid[unit];
+	}
+	return bAllValid;
+}
+
+bool FTicTacToeUnitBatch::Canonicalize(EUnitFamily Family, TArrayView<const FTicTacToeQuantity> Quantities, TArrayView<double> OutValues)
+{
+	using namespace TicTacToeUnitBatch;
+
+	if (Quantities.Num() != OutValues.Num()) return false;
+
+	FTransform Transform;
+	BuildTransform(Family, Transform);
+
+	bool bAllValid = true;
+	for (int32 i = 0; i < Quantities.Num(); ++i)
+	{
+		const FTicTacToeQuantity& Quantity = Quantities[i];
+		const uint8 unit = Quantity.Family == Family ? Quantity.Unit : InvalidUnit;
+		OutValues[i] = Transform.Units[unit].Apply(Quantity.Value);
+		bAllValid &= Transform.Valid[unit];
+	}
+	return bAllValid;
+}
+
+uint64 FTicTacToeUnitBatch::GetSortKey(double Value)
+{
+	if (FMath::IsNaN(Value)) return MAX_uint64;
+
+	// -0 compares equal to +0, give them the same key
+	const double normalized = Value == 0.0 ? 0.0 : Value;
+
+	uint64 bits;
+	FMemory::Memcpy(&bits, &normalized, sizeof(bits));
+
+	// Negative values have their order reversed by flipping every bit, positive ones move above them
+	constexpr uint64 sign_bit = uint64(1) << 63;
+	return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+}
+
+void FTicTacToeUnitBatch::GetSortKeys(TArrayView<const double> Values, TArrayView<uint64> OutKeys)
+{
+	check(Values.Num() == OutKeys.Num());
+
+	for (int32 i = 0; i < Values.Num(); ++i)
+	{
+		OutKeys[i] = GetSortKey(Values[i]);
+	}
+}
+
+void FTicTacToeUnitBatch::SortIndices(TArrayView<const double> Values, TArray<int32>& OutOrder, bool bDescending)
+{
+	using namespace TicTacToeUnitBatch;
+
+	const int32 Num = Values.Num();
+
+	TArray<uint64> Keys;
+	Keys.SetNumUninitialized(Num);
+	GetSortKeys(Values, Keys);
+
+	// NaN stays last in both directions
+	if (bDescending)
+	{
+		for (uint64& Key : Keys)
+		{
+			if (Key != MAX_uint64) Key = ~Key;
+		}
+	}
+
+	OutOrder.SetNumUninitialized(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		OutOrder[i] = i;
+	}
+
+	if (Num < SmallSortThreshold)
+	{
+		for (int32 i = 1; i < Num; ++i)
+		{
+			const uint64 key = Keys[i];
+			const int32 index = OutOrder[i];
+
+			int32 j = i;
+			for (; j > 0 && Keys[j - 1] > key; --j)
+			{
+				Keys[j] = Keys[j - 1];
+				OutOrder[j] = OutOrder[j - 1];
+			}
+			Keys[j] = key;
+			OutOrder[j] = index;
+		}
+		return;
+	}
+
+	// Histograms of all eight bytes in one read of the keys
+	uint32 Counts[8][256] = {};
+	for (const uint64 Key : Keys)
+	{
+		for (int32 Pass = 0; Pass < 8; ++Pass)
+		{
+			++Counts[Pass][(Key >> (Pass * 8)) & 0xFF];
+		}
+	}
+
+	TArray<uint64> ScratchKeys;
+	TArray<int32> ScratchOrder;
+	ScratchKeys.SetNumUninitialized(Num);
+	ScratchOrder.SetNumUninitialized(Num);
+
+	uint64* SourceKeys = Keys.GetData();
+	int32* SourceOrder = OutOrder.GetData();
+	uint64* TargetKeys = ScratchKeys.GetData();
+	int32* TargetOrder = ScratchOrder.GetData();
+
+	for (int32 Pass = 0; Pass < 8; ++Pass)
+	{
+		uint32* Count = Counts[Pass];
+		const int32 Shift = Pass * 8;
+
+		// Every key has the same byte here, the pass would not move anything
+		if (Count[(SourceKeys[0] >> Shift) & 0xFF] == (uint32)Num) continue;
+
+		uint32 Offset = 0;
+		for (int32 Byte = 0; Byte < 256; ++Byte)
+		{
+			const uint32 ByteCount = Count[Byte];
+			Count[Byte] = Offset;
+			Offset += ByteCount;
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const uint32 Position = Count[(SourceKeys[i] >> Shift) & 0xFF]++;
+			TargetKeys[Position] = SourceKeys[i];
+			TargetOrder[Position] = SourceOrder[i];
+		}
+
+		Swap(SourceKeys, TargetKeys);
+		Swap(SourceOrder, TargetOrder);
+	}
+
+	if (SourceOrder != OutOrder.GetData())
+	{
+		FMemory::Memcpy(OutOrder.GetData(), SourceOrder, Num * sizeof(int32));
+	}
+}
+
+double FTicTacToeUnitBatch::Sum(TArrayView<const double> Values)
+{
+	TicTacToeUnitBatch::FNeumaierSum Total;
+	for (const double Value : Values)
+	{
+		if (!FMath::IsNaN(Value)) Total.Add(Value);
+	}
+	return Total.Get();
+}
+
+FTicTacToeUnitAggregate FTicTacToeUnitBatch::Aggregate(TArrayView<const double> Values)
+{
+	TicTacToeUnitBatch::FNeumaierSum Total;
+	double min = TNumericLimits<double>::Max();
+	double max = TNumericLimits<double>::Lowest();
+	int32 count = 0;
+
+	for (const double Value : Values)
+	{
+		if (FMath::IsNaN(Value)) continue;
+
+		Total.Add(Value);
+		min = FMath::Min(min, Value);
+		max = FMath::Max(max, Value);
+		++count;
+	}
+
+	FTicTacToeUnitAggregate Result;
+	if (count == 0) return Result;
+
+	Result.Sum = Total.Get();
+	Result.Min = min;
+	Result.Max = max;
+	Result.Mean = Result.Sum / count;
+	Result.Count = count;
+	return Result;
+}
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#pragma float_control(pop)
+#endif
+
+bool UTicTacToeUnitBatchLibrary::CanonicalizeQuantities(const TArray<FTicTacToeQuantity>& quantities, EUnitFamily family, TArray<double>& OutValues)
+{
+	OutValues.SetNumUninitialized(quantities.Num());
+	return FTicTacToeUnitBatch::Canonicalize(family, quantities, OutValues);
+}
+
+void UTicTacToeUnitBatchLibrary::SortQuantities(const TArray<FTicTacToeQuantity>& quantities, EUnitFamily family, bool Descending, TArray<int32>& OutOrder)
+{
+	TArray<double> values;
+	CanonicalizeQuantities(quantities, family, values);
+	FTicTacToeUnitBatch::SortIndices(values, OutOrder, Descending);
+}
+
+FTicTacToeUnitAggregate UTicTacToeUnitBatchLibrary::AggregateQuantities(const TArray<FTicTacToeQuantity>& quantities, EUnitFamily family, uint8 toUnit)
+{
+	TArray<double> values;
+	CanonicalizeQuantities(quantities, family, values);
+
+	FTicTacToeUnitAggregate Result = FTicTacToeUnitBatch::Aggregate(values);
+	if (Result.Count == 0) return Result;
+
+	const uint8 canonical_unit = FTicTacToeUnitBatch::GetCanonicalUnit(family);
+	Result.Sum = UTicTacToeUnitFormatBPLibrary::ConvertUnit(Result.Sum, family, canonical_unit, toUnit);
+	Result.Min = UTicTacToeUnitFormatBPLibrary::ConvertUnit(Result.Min, family, canonical_unit, toUnit);
+	Result.Max = UTicTacToeUnitFormatBPLibrary::ConvertUnit(Result.Max, family, canonical_unit, toUnit);
+	Result.Mean = UTicTacToeUnitFormatBPLibrary::ConvertUnit(Result.Mean, family, canonical_unit, toUnit);
+	return Result;
+}
@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitColumn.h"
+#include "TicTacToeUnitDisplayStrings.h"
+
+FTicTacToeUnitColumn::FTicTacToeUnitColumn(EUnitFamily InFamily, uint8 InSourceUnit)
+	: Family(InFamily), SourceUnit(InSourceUnit), ViewUnit(InSourceUnit)
+{
+	// The affine table has an identity entry for every unit of the family and none for anything else
+	checkf(FTicTacToeAffine::Find(Family, SourceUnit, SourceUnit), TEXT("Unit %d is not part of unit family %d"), SourceUnit, (int32)Family);
+}
+
+bool FTicTacToeUnitColumn::SetViewUnit(uint8 InViewUnit)
+{
+	const FTicTacToeAffineTransform* Forward = FTicTacToeAffine::Find(Family, SourceUnit, InViewUnit);
+	const FTicTacToeAffineTransform* Inverse = FTicTacToeAffine::Find(Family, InViewUnit, SourceUnit);
+	if (!Forward || !Inverse) return false;
+
+	ViewUnit = InViewUnit;
+	ToView = *Forward;
+	ToSource = *Inverse;
+	return true;
+}
+
+void FTicTacToeUnitColumn::SetSourceValues(TArrayView<const double> InValues)
+{
+	Values.Reset(InValues.Num());
+	Values.Append(InValues.GetData(), InValues.Num());
+}
+
+void FTicTacToeUnitColumn::CopyValues(int32 Start, TArrayView<double> OutValues) const
+{
+	check(Start >= 0 && Start + OutValues.Num() <= Values.Num());
+
+	FTicTacToeAffine::Apply(TArrayView<const double>(Values.GetData() + Start, OutValues.Num()), ToView, OutValues);
+}
+
+FText FTicTacToeUnitColumn::Format(int32 Index, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation) const
+{
+	if (!Values.IsValidIndex(Index)) return FText();
+
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(Family, ViewUnit);
+	if (!unit_string) return FText();
+
+	// Already in the view unit, only the suffix is added
+	return UTicTacToeUnitFormatBPLibrary::FormatValue(Get(Index), *unit_string, Family, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+void FTicTacToeUnitColumn::FormatValues(int32 Start, int32 Count, TArray<FText>& OutTexts, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation) const
+{
+	Start = FMath::Clamp(Start, 0, Values.Num());
+	const int32 End = FMath::Clamp((int64)Start + FMath::Max(Count, 0), (int64)Start, (int64)Values.Num());
+	OutTexts.Reserve(OutTexts.Num() + End - Start);
+
+	// One suffix for the whole run, FormatUnit would look it up and convert ViewUnit to ViewUnit for every value
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(Family, ViewUnit);
+	if (!unit_string)
+	{
+		OutTexts.AddDefaulted(End - Start);
+		return;
+	}
+
+	double Block[BlockSize];
+	for (int32 BlockStart = Start; BlockStart < End; BlockStart += BlockSize)
+	{
+		const TArrayView<double> View(Block, FMath::Min(BlockSize, End - BlockStart));
+		CopyValues(BlockStart, View);
+
+		for (const double Value : View)
+		{
+			OutTexts.Add(UTicTacToeUnitFormatBPLibrary::FormatValue(Value, *unit_string, Family, precision, ForceSign, UseGrouping, StableWidth, Notation));
+		}
+	}
+}
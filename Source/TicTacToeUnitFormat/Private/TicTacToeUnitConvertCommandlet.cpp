@@ -0,0 +1,566 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitConvertCommandlet.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitAffine.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTicTacToeUnitConvert, Log, All);
+
+namespace TicTacToeUnitConvert
+{
+	enum class EFileFormat : uint8
+	{
+		Csv,
+		Float64,
+		Float32,
+	};
+
+	struct FColumnConversion
+	{
+		int32 Column = INDEX_NONE;
+		FTicTacToeAffineTransform Transform;
+	};
+
+	template<typename EnumType>
+	static bool ParseUnit(const FString& Name, EnumType& OutUnit)
+	{
+		const int64 Value = StaticEnum<EnumType>()->GetValueByNameString(Name);
+		if (Value == INDEX_NONE) return false;
+		OutUnit = static_cast<EnumType>(Value);
+		return true;
+	}
+
+	template<typename EnumType>
+	static bool ParseUnitPair(const FString& From, const FString& To, EnumType& OutFrom, EnumType& OutTo)
+	{
+		return ParseUnit(From, OutFrom) && ParseUnit(To, OutTo);
+	}
+
+	template<typename EnumType>
+	static bool FindTransform(EUnitFamily Family, const FString& From, const FString& To, FTicTacToeAffineTransform& OutTransform)
+	{
+		EnumType F, T;
+		if (!ParseUnitPair(From, To, F, T)) return false;
+
+		const FTicTacToeAffineTransform* Transform = FTicTacToeAffine::Find(Family, (uint8)F, (uint8)T);
+		if (!Transform) return false;
+
+		OutTransform = *Transform;
+		return true;
+	}
+
+	// Transforms come from the same tables as the library's Convert* functions, so the commandlet and the Blueprint nodes always agree
+	static bool ComputeTransform(const FString& Family, const FString& From, const FString& To, FTicTacToeAffineTransform& OutTransform)
+	{
+		if (Family == TEXT("length"))				{ if (!FindTransform<ELengthUnit>(EUnitFamily::UF_LENGTH, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("weight"))			{ if (!FindTransform<EWeightUnit>(EUnitFamily::UF_WEIGHT, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("volume"))			{ if (!FindTransform<EVolumeUnit>(EUnitFamily::UF_VOLUME, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("area"))			{ if (!FindTransform<EAreaUnit>(EUnitFamily::UF_AREA, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("temperature"))		{ if (!FindTransform<ETemperatureUnit>(EUnitFamily::UF_TEMPERATURE, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("time"))			{ if (!FindTransform<ETimeUnit>(EUnitFamily::UF_TIME, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("pressure"))		{ if (!FindTransform<EPressureUnit>(EUnitFamily::UF_PRESSURE, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("energy"))			{ if (!FindTransform<EEnergyUnit>(EUnitFamily::UF_ENERGY, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("angle"))			{ if (!FindTransform<EAngleUnit>(EUnitFamily::UF_ANGLE, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("power"))			{ if (!FindTransform<EPowerUnit>(EUnitFamily::UF_POWER, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("flow"))			{ if (!FindTransform<EFlowUnit>(EUnitFamily::UF_FLOW, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("density"))			{ if (!FindTransform<EDensityUnit>(EUnitFamily::UF_DENSITY, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("acceleration"))	{ if (!FindTransform<EAccelerationUnit>(EUnitFamily::UF_ACCELERATION, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("torque"))			{ if (!FindTransform<ETorqueUnit>(EUnitFamily::UF_TORQUE, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("data_size"))		{ if (!FindTransform<EDataSizeUnit>(EUnitFamily::UF_DATA_SIZE, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("data_rate"))		{ if (!FindTransform<EDataRateUnit>(EUnitFamily::UF_DATA_RATE, From, To, OutTransform)) return false; }
+		else if (Family == TEXT("speed"))
+		{
+			FString FromLength, FromTime, ToLength, ToTime;
+			if (!From.Split(TEXT("/"), &FromLength, &FromTime) || !To.Split(TEXT("/"), &ToLength, &ToTime)) return false;
+
+			ELengthUnit FL, TL;
+			ETimeUnit FT, TT;
+			if (!ParseUnitPair(FromLength, ToLength, FL, TL) || !ParseUnitPair(FromTime, ToTime, FT, TT)) return false;
+			OutTransform = FTicTacToeAffineTransform();
+			OutTransform.Numerator = UTicTacToeUnitFormatBPLibrary::ConvertSpeed(1.0, FL, TL, FT, TT);
+		}
+		else
+		{
+			return false;
+		}
+
+		return FMath::IsFinite(OutTransform.Numerator) && OutTransform.Numerator != 0.0 && OutTransform.Denominator != 0.0;
+	}
+
+	static bool ParseColumns(const FString& Spec, TArray<FColumnConversion>& OutColumns)
+	{
+		TArray<FString> Entries;
+		Spec.ParseIntoArray(Entries, TEXT(","));
+
+		for (const FString& Entry : Entries)
+		{
+			TArray<FString> Parts;
+			Entry.ParseIntoArray(Parts, TEXT(":"));
+
+			FColumnConversion Conversion;
+			if (Parts.Num() != 4 || !LexTryParseString(Conversion.Column, *Parts[0]) || Conversion.Column < 0
+				|| !ComputeTransform(Parts[1].ToLower(), Parts[2], Parts[3], Conversion.Transform))
+			{
+				UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Invalid column spec '%s'"), *Entry);
+				return false;
+			}
+
+			// A repeated column would be converted twice in binary files and written twice in CSV lines
+			if (OutColumns.ContainsByPredicate([&Conversion](const FColumnConversion& C) { return C.Column == Conversion.Column; }))
+			{
+				UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Column %d is given more than once in -columns"), Conversion.Column);
+				return false;
+			}
+			OutColumns.Add(Conversion);
+		}
+
+		return OutColumns.Num() > 0;
+	}
+
+	// --- --- KERNELS --- --- //
+
+	static void ConvertValues(double* Values, int64 Count, const FTicTacToeAffineTransform& Transform)
+	{
+		// Views are int32 sized
+		for (int64 Index = 0; Index < Count; Index += MAX_int32)
+		{
+			FTicTacToeAffine::Apply(TArrayView<double>(Values + Index, int32(FMath::Min<int64>(Count - Index, MAX_int32))), Transform);
+		}
+	}
+
+	// Numerator and denominator can be far outside float range, fold them into a scale and offset in double first
+	static void ConvertValues(float* Values, int64 Count, const FTicTacToeAffineTransform& Transform)
+	{
+		const float Scale = static_cast<float>(Transform.Numerator / Transform.Denominator);
+		const float Offset = static_cast<float>(Transform.Offset / Transform.Denominator);
+		const VectorRegister4Float ScaleRegister = VectorSetFloat1(Scale);
+		const VectorRegister4Float OffsetRegister = VectorSetFloat1(Offset);
+
+		int64 Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			VectorStore(VectorAdd(VectorMultiply(VectorLoad(Values + Index), ScaleRegister), OffsetRegister), Values + Index);
+		}
+		for (; Index < Count; ++Index)
+		{
+			Values[Index] = Values[Index] * Scale + Offset;
+		}
+	}
+
+	// --- --- INPUT WINDOWS --- --- //
+
+	// Hands out read-only views of the input, mapped when the platform supports it and read into a reusable buffer otherwise
+	class FInputWindow
+	{
+	public:
+
+		bool Open(const FString& Path)
+		{
+			IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+			MappedFile.Reset(PlatformFile.OpenMapped(*Path));
+			if (MappedFile.IsValid())
+			{
+				FileSize = MappedFile->GetFileSize();
+				return true;
+			}
+
+			ReadFile.Reset(PlatformFile.OpenRead(*Path));
+			if (ReadFile.IsValid())
+			{
+				FileSize = ReadFile->Size();
+				return true;
+			}
+			return false;
+		}
+
+		bool IsMapped() const { return MappedFile.IsValid(); }
+
+		int64 GetFileSize() const { return FileSize; }
+
+		const uint8* View(int64 Offset, int64 Size)
+		{
+			if (MappedFile.IsValid())
+			{
+				// Only one region is kept alive so the mapped footprint stays at one chunk
+				MappedRegion.Reset();
+				MappedRegion.Reset(MappedFile->MapRegion(Offset, Size));
+				return MappedRegion.IsValid() ? MappedRegion->GetMappedPtr() : nullptr;
+			}
+
+			Buffer.SetNumUninitialized(Size, EAllowShrinking::No);
+			if (!ReadFile->Seek(Offset) || !ReadFile->Read(Buffer.GetData(), Size)) return nullptr;
+			return Buffer.GetData();
+		}
+
+	private:
+
+		TUniquePtr<IMappedFileHandle> MappedFile;
+		TUniquePtr<IMappedFileRegion> MappedRegion;
+		TUniquePtr<IFileHandle> ReadFile;
+		TArray<uint8> Buffer;
+		int64 FileSize = 0;
+	};
+
+	// --- --- OUTPUT --- --- //
+
+	// A failed write (full disk...) fails the commandlet rather than leaving a truncated file behind a success code
+	static bool WriteOutput(IFileHandle& Output, const uint8* Data, int64 Size)
+	{
+		if (Size <= 0 || Output.Write(Data, Size)) return true;
+
+		UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Write of %lld bytes failed at output offset %lld"), Size, Output.Tell());
+		return false;
+	}
+
+	// --- --- CSV --- --- //
+
+	static bool IsNumberStart(ANSICHAR Char)
+	{
+		return FCharAnsi::IsDigit(Char) || Char == '-' || Char == '+' || Char == '.';
+	}
+
+	static bool IsFieldEnd(ANSICHAR Char)
+	{
+		return Char == ',' || Char == '\r' || Char == '\n';
+	}
+
+	// Digits significant digits, or with 0 the fewest that read back as the same double: 1.1 rather than 1.1000000000000001
+	static int32 PrintNumber(ANSICHAR (&Number)[64], double Value, int32 Digits)
+	{
+		if (Digits > 0) return FCStringAnsi::Snprintf(Number, UE_ARRAY_COUNT(Number), "%.*g", Digits, Value);
+
+		int32 Length = 0;
+		for (int32 RoundTripDigits = 15; RoundTripDigits <= 17; ++RoundTripDigits)
+		{
+			Length = FCStringAnsi::Snprintf(Number, UE_ARRAY_COUNT(Number), "%.*g", RoundTripDigits, Value);
+			if (FCStringAnsi::Atod(Number) == Value) break;
+		}
+		return Length;
+	}
+
+	struct FCsvTask
+	{
+		TArray<ANSICHAR> Output;
+		TArray<TArray<double>> Values;
+	};
+
+	// Converts the complete lines in [Begin, End): values of each selected column are gathered into contiguous arrays,
+	// scaled with the vector kernel, then written back while every other byte of the line is copied verbatim
+	static void ConvertCsvLines(const ANSICHAR* Begin, const ANSICHAR* End, const TArray<FColumnConversion>& Columns, int32 Digits, FCsvTask& Task)
+	{
+		const int32 NumColumns = Columns.Num();
+		Task.Values.SetNum(NumColumns);
+		for (TArray<double>& ColumnValues : Task.Values) ColumnValues.Reset();
+
+		auto ForEachSelectedField = [&Columns, NumColumns](const ANSICHAR* Line, const ANSICHAR* LineEnd, auto&& Visitor)
+		{
+			int32 FieldIndex = 0;
+			for (const ANSICHAR* Field = Line; Field <= LineEnd; ++FieldIndex)
+			{
+				const ANSICHAR* FieldEnd = Field;
+				while (FieldEnd < LineEnd && !IsFieldEnd(*FieldEnd)) ++FieldEnd;
+
+				for (int32 ColumnIndex = 0; ColumnIndex < NumColumns; ++ColumnIndex)
+				{
+					if (Columns[ColumnIndex].Column == FieldIndex) Visitor(ColumnIndex, Field, FieldEnd);
+				}
+
+				if (FieldEnd >= LineEnd || *FieldEnd != ',') break;
+				Field = FieldEnd + 1;
+			}
+		};
+
+		auto NextLine = [End](const ANSICHAR* Line)
+		{
+			const ANSICHAR* LineEnd = Line;
+			while (LineEnd < End && *LineEnd != '\n') ++LineEnd;
+			return LineEnd;
+		};
+
+		// Gather
+		for (const ANSICHAR* Line = Begin; Line < End;)
+		{
+			const ANSICHAR* LineEnd = NextLine(Line);
+			ForEachSelectedField(Line, LineEnd, [&Task](int32 ColumnIndex, const ANSICHAR* Field, const ANSICHAR* FieldEnd)
+			{
+				ANSICHAR Number[64];
+				const int32 Length = FMath::Min<int32>(UE_PTRDIFF_TO_INT32(FieldEnd - Field), UE_ARRAY_COUNT(Number) - 1);
+				FMemory::Memcpy(Number, Field, Length);
+				Number[Length] = '\0';
+
+				Task.Values[ColumnIndex].Add(Length > 0 && IsNumberStart(Number[0]) ? FCStringAnsi::Atod(Number) : NAN);
+			});
+			Line = LineEnd < End ? LineEnd + 1 : End;
+		}
+
+		// Convert
+		for (int32 ColumnIndex = 0; ColumnIndex < NumColumns; ++ColumnIndex)
+		{
+			ConvertValues(Task.Values[ColumnIndex].GetData(), Task.Values[ColumnIndex].Num(), Columns[ColumnIndex].Transform);
+		}
+
+		// Scatter
+		TArray<int32, TInlineAllocator<8>> Cursors;
+		Cursors.SetNumZeroed(NumColumns);
+
+		Task.Output.Reset();
+		for (const ANSICHAR* Line = Begin; Line < End;)
+		{
+			const ANSICHAR* LineEnd = NextLine(Line);
+			const ANSICHAR* Copied = Line;
+
+			ForEachSelectedField(Line, LineEnd, [&](int32 ColumnIndex, const ANSICHAR* Field, const ANSICHAR* FieldEnd)
+			{
+				const double Value = Task.Values[ColumnIndex][Cursors[ColumnIndex]++];
+				if (FMath::IsNaN(Value)) return;
+
+				Task.Output.Append(Copied, UE_PTRDIFF_TO_INT32(Field - Copied));
+
+				ANSICHAR Number[64];
+				const int32 Length = PrintNumber(Number, Value, Digits);
+				Task.Output.Append(Number, FMath::Clamp(Length, 0, UE_ARRAY_COUNT(Number) - 1));
+				Copied = FieldEnd;
+			});
+
+			const ANSICHAR* Next = LineEnd < End ? LineEnd + 1 : End;
+			Task.Output.Append(Copied, UE_PTRDIFF_TO_INT32(Next - Copied));
+			Line = Next;
+		}
+	}
+
+	// --- --- BINARY --- --- //
+
+	template<typename ValueType>
+	static void ConvertRecords(ValueType* Records, int64 NumRecords, int32 Stride, const TArray<FColumnConversion>& Columns, TArray<ValueType>& Scratch)
+	{
+		for (const FColumnConversion& Conversion : Columns)
+		{
+			if (Stride == 1)
+			{
+				ConvertValues(Records, NumRecords, Conversion.Transform);
+				continue;
+			}
+
+			Scratch.SetNumUninitialized(NumRecords, EAllowShrinking::No);
+			for (int64 Index = 0; Index < NumRecords; ++Index) Scratch[Index] = Records[Index * Stride + Conversion.Column];
+			ConvertValues(Scratch.GetData(), NumRecords, Conversion.Transform);
+			for (int64 Index = 0; Index < NumRecords; ++Index) Records[Index * Stride + Conversion.Column] = Scratch[Index];
+		}
+	}
+}
+
+UTicTacToeUnitConvertCommandlet::UTicTacToeUnitConvertCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UTicTacToeUnitConvertCommandlet::Main(const FString& Params)
+{
+	using namespace TicTacToeUnitConvert;
+
+	FString InPath, OutPath, ColumnSpec, FormatName = TEXT("csv");
+	FParse::Value(*Params, TEXT("in="), InPath);
+	FParse::Value(*Params, TEXT("out="), OutPath);
+	FParse::Value(*Params, TEXT("columns="), ColumnSpec, false);
+	FParse::Value(*Params, TEXT("format="), FormatName);
+
+	int32 Stride = 1, Digits = 0, ChunkMB = 16;
+	int32 NumThreads = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	FParse::Value(*Params, TEXT("stride="), Stride);
+	FParse::Value(*Params, TEXT("digits="), Digits);
+	FParse::Value(*Params, TEXT("chunkmb="), ChunkMB);
+	FParse::Value(*Params, TEXT("threads="), NumThreads);
+	const bool bHasHeader = !FParse::Param(*Params, TEXT("noheader"));
+
+	EFileFormat Format;
+	if (FormatName == TEXT("csv")) Format = EFileFormat::Csv;
+	else if (FormatName == TEXT("f64")) Format = EFileFormat::Float64;
+	else if (FormatName == TEXT("f32")) Format = EFileFormat::Float32;
+	else
+	{
+		UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Unknown -format=%s, expected csv, f64 or f32"), *FormatName);
+		return 1;
+	}
+
+	TArray<FColumnConversion> Columns;
+	if (InPath.IsEmpty() || OutPath.IsEmpty() || !ParseColumns(ColumnSpec, Columns))
+	{
+		UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Usage: -run=TicTacToeUnitConvert -in=<file> -out=<file> -columns=<index>:<family>:<from>:<to>[,...]"));
+		return 1;
+	}
+
+	Stride = FMath::Max(Stride, 1);
+	Digits = FMath::Clamp(Digits, 0, 17);
+	NumThreads = FMath::Max(NumThreads, 1);
+	const int64 ChunkBytes = int64(FMath::Max(ChunkMB, 1)) * 1024 * 1024;
+
+	if (Format != EFileFormat::Csv && Columns.ContainsByPredicate([Stride](const FColumnConversion& C) { return C.Column >= Stride; }))
+	{
+		UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("A binary column index is outside the -stride=%d record"), Stride);
+		return 1;
+	}
+
+	FInputWindow Input;
+	if (!Input.Open(InPath))
+	{
+		UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Could not open '%s'"), *InPath);
+		return 1;
+	}
+
+	TUniquePtr<IFileHandle> Output(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*OutPath));
+	if (!Output.IsValid())
+	{
+		UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Could not create '%s'"), *OutPath);
+		return 1;
+	}
+
+	UE_LOG(LogTicTacToeUnitConvert, Display, TEXT("Converting %s (%.1f MB, %s) with %d threads and %d MB chunks"),
+		*InPath, Input.GetFileSize() / (1024.0 * 1024.0), Input.IsMapped() ? TEXT("mapped") : TEXT("streamed"), NumThreads, int32(ChunkBytes / (1024 * 1024)));
+
+	const double StartTime = FPlatformTime::Seconds();
+	const int64 FileSize = Input.GetFileSize();
+	int64 Offset = 0;
+
+	if (Format == EFileFormat::Csv)
+	{
+		TArray<FCsvTask> Tasks;
+		Tasks.SetNum(NumThreads);
+
+		bool bSkipHeader = bHasHeader;
+		while (Offset < FileSize)
+		{
+			const int64 WindowSize = FMath::Min(ChunkBytes, FileSize - Offset);
+			const ANSICHAR* Window = reinterpret_cast<const ANSICHAR*>(Input.View(Offset, WindowSize));
+			if (!Window)
+			{
+				UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Read failed at offset %lld"), Offset);
+				return 1;
+			}
+
+			// Only whole lines are converted, the partial tail is picked up again by the next window
+			int64 Consumed = WindowSize;
+			if (Offset + WindowSize < FileSize)
+			{
+				while (Consumed > 0 && Window[Consumed - 1] != '\n') --Consumed;
+				if (Consumed == 0)
+				{
+					UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Line at offset %lld is longer than -chunkmb"), Offset);
+					return 1;
+				}
+			}
+
+			const ANSICHAR* Begin = Window;
+			const ANSICHAR* End = Window + Consumed;
+			if (bSkipHeader)
+			{
+				while (Begin < End && *Begin++ != '\n');
+				if (!WriteOutput(*Output, reinterpret_cast<const uint8*>(Window), Begin - Window)) return 1;
+				bSkipHeader = false;
+			}
+
+			// Split on line boundaries, one slice per worker
+			TArray<const ANSICHAR*, TInlineAllocator<64>> Splits;
+			Splits.Add(Begin);
+			for (int32 TaskIndex = 1; TaskIndex < NumThreads; ++TaskIndex)
+			{
+				const ANSICHAR* Split = FMath::Max(Splits.Last(), Begin + (End - Begin) * TaskIndex / NumThreads);
+				while (Split < End && Split > Begin && Split[-1] != '\n') ++Split;
+				Splits.Add(Split);
+			}
+			Splits.Add(End);
+
+			ParallelFor(NumThreads, [&](int32 TaskIndex)
+			{
+				ConvertCsvLines(Splits[TaskIndex], Splits[TaskIndex + 1], Columns, Digits, Tasks[TaskIndex]);
+			});
+
+			for (const FCsvTask& Task : Tasks)
+			{
+				if (!WriteOutput(*Output, reinterpret_cast<const uint8*>(Task.Output.GetData()), Task.Output.Num())) return 1;
+			}
+
+			Offset += Consumed;
+		}
+	}
+	else
+	{
+		const int64 ValueSize = Format == EFileFormat::Float64 ? sizeof(double) : sizeof(float);
+		const int64 RecordSize = ValueSize * Stride;
+		const int64 WindowRecords = FMath::Max<int64>(ChunkBytes / RecordSize, 1);
+
+		TArray<uint8> Records;
+		TArray<TArray<double>> DoubleScratch;
+		TArray<TArray<float>> FloatScratch;
+		DoubleScratch.SetNum(NumThreads);
+		FloatScratch.SetNum(NumThreads);
+
+		const int64 TotalRecords = FileSize / RecordSize;
+		for (int64 Record = 0; Record < TotalRecords; Record += WindowRecords)
+		{
+			const int64 NumRecords = FMath::Min(WindowRecords, TotalRecords - Record);
+			const uint8* Window = Input.View(Offset, NumRecords * RecordSize);
+			if (!Window)
+			{
+				UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Read failed at offset %lld"), Offset);
+				return 1;
+			}
+
+			Records.SetNumUninitialized(NumRecords * RecordSize, EAllowShrinking::No);
+			FMemory::Memcpy(Records.GetData(), Window, NumRecords * RecordSize);
+
+			const int64 RecordsPerTask = FMath::DivideAndRoundUp<int64>(NumRecords, NumThreads);
+			ParallelFor(NumThreads, [&](int32 TaskIndex)
+			{
+				const int64 First = RecordsPerTask * TaskIndex;
+				const int64 Count = FMath::Min(RecordsPerTask, NumRecords - First);
+				if (Count <= 0) return;
+
+				if (Format == EFileFormat::Float64)
+				{
+					ConvertRecords(reinterpret_cast<double*>(Records.GetData()) + First * Stride, Count, Stride, Columns, DoubleScratch[TaskIndex]);
+				}
+				else
+				{
+					ConvertRecords(reinterpret_cast<float*>(Records.GetData()) + First * Stride, Count, Stride, Columns, FloatScratch[TaskIndex]);
+				}
+			});
+
+			if (!WriteOutput(*Output, Records.GetData(), Records.Num())) return 1;
+			Offset += NumRecords * RecordSize;
+		}
+
+		if (Offset < FileSize)
+		{
+			UE_LOG(LogTicTacToeUnitConvert, Warning, TEXT("Trailing %lld bytes do not form a whole record and were copied unchanged"), FileSize - Offset);
+			const uint8* Tail = Input.View(Offset, FileSize - Offset);
+			if (!Tail)
+			{
+				UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Read failed at offset %lld"), Offset);
+				return 1;
+			}
+			if (!WriteOutput(*Output, Tail, FileSize - Offset)) return 1;
+			Offset = FileSize;
+		}
+	}
+
+	if (!Output->Flush())
+	{
+		UE_LOG(LogTicTacToeUnitConvert, Error, TEXT("Could not flush '%s'"), *OutPath);
+		return 1;
+	}
+
+	const double Seconds = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+	const double MegaBytes = FileSize / (1024.0 * 1024.0);
+	UE_LOG(LogTicTacToeUnitConvert, Display, TEXT("Converted %.1f MB in %.2f s (%.1f MB/s) to %s"), MegaBytes, Seconds, MegaBytes / Seconds, *OutPath);
+
+	return 0;
+}
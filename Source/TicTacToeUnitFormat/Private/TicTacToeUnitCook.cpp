@@ -0,0 +1,251 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitCook.h"
+#include "TicTacToeUnitAffine.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/CurveTable.h"
+#include "Engine/DataTable.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTicTacToeUnitCook, Log, All);
+
+#if WITH_EDITOR
+namespace TicTacToeUnitCook
+{
+	// Authored data of an asset converted for the save in progress
+	struct FBackup
+	{
+		TWeakObjectPtr<UObject> Asset;
+		TArray<TPair<FName, TArray<double>>> Columns;
+		TArray<TPair<FName, FRichCurve>> RichCurves;
+		TArray<TPair<FName, FSimpleCurve>> SimpleCurves;
+	};
+
+	static TMap<TWeakObjectPtr<UPackage>, TArray<FBackup>> Backups;
+	static FDelegateHandle PreSaveHandle;
+	static FDelegateHandle PackageSavedHandle;
+
+	static const FTicTacToeAffineTransform* FindTransform(const FTicTacToeUnitCookRule& Rule, const UObject* Asset)
+	{
+		const FTicTacToeAffineTransform* Transform = FTicTacToeAffine::Find(Rule.Family, Rule.AuthoredUnit, Rule.RuntimeUnit);
+		if (!Transform)
+		{
+			UE_LOG(LogTicTacToeUnitCook, Warning, TEXT("%s: units %d and %d are not both part of family %s, '%s' is cooked as authored"),
+				*GetPathNameSafe(Asset), Rule.AuthoredUnit, Rule.RuntimeUnit, *UEnum::GetValueAsString(Rule.Family), *Rule.Column.ToString());
+		}
+		return Transform;
+	}
+
+	// Values are mapped by the transform, slopes only by its scale
+	template<typename CurveType>
+	static void ConvertCurve(CurveType& Curve, const FTicTacToeAffineTransform& Transform)
+	{
+		const double Slope = Transform.Numerator / Transform.Denominator;
+		for (auto It = Curve.GetKeyHandleIterator(); It; ++It)
+		{
+			auto& Key = Curve.GetKey(*It);
+			Key.Value = (float)Transform.Apply(Key.Value);
+			if constexpr (std::is_same_v<CurveType, FRichCurve>)
+			{
+				Key.ArriveTangent = (float)(Key.ArriveTangent * Slope);
+				Key.LeaveTangent = (float)(Key.LeaveTangent * Slope);
+			}
+		}
+
+		if (Curve.GetDefaultValue() != MAX_flt)
+		{
+			Curve.SetDefaultValue((float)Transform.Apply(Curve.GetDefaultValue()));
+		}
+	}
+
+	static void ConvertDataTable(UDataTable& Table, const FTicTacToeUnitCookRule& Rule, FBackup& Backup)
+	{
+		const FNumericProperty* Property = Table.RowStruct ? CastField<FNumericProperty>(Table.RowStruct->FindPropertyByName(Rule.Column)) : nullptr;
+		if (!Property || !Property->IsFloatingPoint())
+		{
+			UE_LOG(LogTicTacToeUnitCook, Warning, TEXT("%s: no float or double column '%s'"), *Table.GetPathName(), *Rule.Column.ToString());
+			return;
+		}
+
+		const FTicTacToeAffineTransform* Transform = FindTransform(Rule, &Table);
+		if (!Transform) return;
+
+		TArray<double>& Authored = Backup.Columns.Emplace_GetRef(Rule.Column, TArray<double>()).Value;
+		Authored.Reserve(Table.GetRowMap().Num());
+		for (const TPair<FName, uint8*>& Row : Table.GetRowMap())
+		{
+			void* Value = Property->ContainerPtrToValuePtr<void>(Row.Value);
+			const double AuthoredValue = Property->GetFloatingPointPropertyValue(Value);
+			Authored.Add(AuthoredValue);
+			Property->SetFloatingPointPropertyValue(Value, Transform->Apply(AuthoredValue));
+		}
+	}
+
+	static void ConvertCurveTable(UCurveTable& Table, const FTicTacToeUnitCookRule& Rule, FBackup& Backup)
+	{
+		const FTicTacToeAffineTransform* Transform = FindTransform(Rule, &Table);
+		if (!Transform) return;
+
+		// Rows with a rule of their own are converted by it, a table-wide rule takes the others
+		const UTicTacToeUnitCookSettings* Settings = GetDefault<UTicTacToeUnitCookSettings>();
+		auto Matches = [&Rule, &Table, Settings](FName RowName)
+		{
+			return Rule.Column.IsNone() ? Settings->FindRule(&Table, RowName) == &Rule : RowName == Rule.Column;
+		};
+
+		if (Table.GetCurveTableMode() == ECurveTableMode::SimpleCurves)
+		{
+			for (const TPair<FName, FSimpleCurve*>& Row : Table.GetSimpleCurveRowMap())
+			{
+				if (!Matches(Row.Key)) continue;
+				Backup.SimpleCurves.Emplace(Row.Key, *Row.Value);
+				ConvertCurve(*Row.Value, *Transform);
+			}
+		}
+		else
+		{
+			for (const TPair<FName, FRichCurve*>& Row : Table.GetRichCurveRowMap())
+			{
+				if (!Matches(Row.Key)) continue;
+				Backup.RichCurves.Emplace(Row.Key, *Row.Value);
+				ConvertCurve(*Row.Value, *Transform);
+			}
+		}
+	}
+
+	static void OnObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext)
+	{
+		if (!SaveContext.IsCooking() || !Object) return;
+
+		const UTicTacToeUnitCookSettings* Settings = GetDefault<UTicTacToeUnitCookSettings>();
+		if (Settings->Rules.IsEmpty()) return;
+
+		const FSoftObjectPath Path(Object);
+		FBackup Backup;
+		Backup.Asset = Object;
+
+		for (const FTicTacToeUnitCookRule& Rule : Settings->Rules)
+		{
+			if (Rule.Asset != Path) continue;
+
+			if (UDataTable* DataTable = Cast<UDataTable>(Object))
+			{
+				ConvertDataTable(*DataTable, Rule, Backup);
+			}
+			else if (UCurveTable* CurveTable = Cast<UCurveTable>(Object))
+			{
+				ConvertCurveTable(*CurveTable, Rule, Backup);
+			}
+			else if (UCurveFloat* CurveFloat = Cast<UCurveFloat>(Object))
+			{
+				if (const FTicTacToeAffineTransform* Transform = FindTransform(Rule, Object))
+				{
+					Backup.RichCurves.Emplace(NAME_None, CurveFloat->FloatCurve);
+					ConvertCurve(CurveFloat->FloatCurve, *Transform);
+				}
+			}
+		}
+
+		if (Backup.Columns.IsEmpty() && Backup.RichCurves.IsEmpty() && Backup.SimpleCurves.IsEmpty()) return;
+
+		UE_LOG(LogTicTacToeUnitCook, Verbose, TEXT("Cooking %s in runtime units"), *Object->GetPathName());
+		Backups.FindOrAdd(Object->GetPackage()).Add(MoveTemp(Backup));
+	}
+
+	static void Restore(FBackup& Backup)
+	{
+		UObject* Object = Backup.Asset.Get();
+		if (!Object) return;
+
+		if (UDataTable* DataTable = Cast<UDataTable>(Object))
+		{
+			for (const TPair<FName, TArray<double>>& Column : Backup.Columns)
+			{
+				const FNumericProperty* Property = CastField<FNumericProperty>(DataTable->RowStruct->FindPropertyByName(Column.Key));
+				int32 Index = 0;
+				for (const TPair<FName, uint8*>& Row : DataTable->GetRowMap())
+				{
+					Property->SetFloatingPointPropertyValue(Property->ContainerPtrToValuePtr<void>(Row.Value), Column.Value[Index++]);
+				}
+			}
+		}
+		else if (UCurveTable* CurveTable = Cast<UCurveTable>(Object))
+		{
+			for (TPair<FName, FRichCurve>& Curve : Backup.RichCurves)
+			{
+				if (FRichCurve* Row = CurveTable->FindRichCurve(Curve.Key, TEXT("TicTacToeUnitCook"), false)) *Row = MoveTemp(Curve.Value);
+			}
+			for (TPair<FName, FSimpleCurve>& Curve : Backup.SimpleCurves)
+			{
+				if (FSimpleCurve* Row = CurveTable->FindSimpleCurve(Curve.Key, TEXT("TicTacToeUnitCook"), false)) *Row = MoveTemp(Curve.Value);
+			}
+		}
+		else if (UCurveFloat* CurveFloat = Cast<UCurveFloat>(Object))
+		{
+			if (!Backup.RichCurves.IsEmpty()) CurveFloat->FloatCurve = MoveTemp(Backup.RichCurves[0].Value);
+		}
+	}
+
+	static void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+	{
+		TArray<FBackup> PackageBackups;
+		if (!Backups.RemoveAndCopyValue(Package, PackageBackups)) return;
+
+		// Restored in reverse so several rules on one asset undo in order
+		for (int32 Index = PackageBackups.Num() - 1; Index >= 0; --Index)
+		{
+			Restore(PackageBackups[Index]);
+		}
+	}
+}
+#endif
+
+const FTicTacToeUnitCookRule* UTicTacToeUnitCookSettings::FindRule(const UObject* Asset, FName Column) const
+{
+	if (!Asset) return nullptr;
+
+	const FSoftObjectPath Path(Asset);
+	const FTicTacToeUnitCookRule* TableRule = nullptr;
+	for (const FTicTacToeUnitCookRule& Rule : Rules)
+	{
+		if (Rule.Asset != Path) continue;
+		if (Rule.Column == Column) return &Rule;
+		if (Rule.Column.IsNone() && !TableRule) TableRule = &Rule;
+	}
+	return Asset->IsA<UCurveTable>() || Asset->IsA<UCurveFloat>() ? TableRule : nullptr;
+}
+
+double UTicTacToeUnitCookSettings::ToRuntimeUnit(const UObject* Asset, FName Column, double Value)
+{
+#if WITH_EDITOR
+	// Cooked data was converted when it was saved
+	if (!Asset || Asset->GetPackage()->HasAnyPackageFlags(PKG_Cooked)) return Value;
+
+	const FTicTacToeUnitCookRule* Rule = GetDefault<UTicTacToeUnitCookSettings>()->FindRule(Asset, Column);
+	return Rule ? UTicTacToeUnitFormatBPLibrary::ConvertUnit(Value, Rule->Family, Rule->AuthoredUnit, Rule->RuntimeUnit) : Value;
+#else
+	return Value;
+#endif
+}
+
+void UTicTacToeUnitCookSettings::Initialize()
+{
+#if WITH_EDITOR
+	using namespace TicTacToeUnitCook;
+
+	PreSaveHandle = FCoreUObjectDelegates::OnObjectPreSave.AddStatic(&OnObjectPreSave);
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddStatic(&OnPackageSaved);
+#endif
+}
+
+void UTicTacToeUnitCookSettings::Shutdown()
+{
+#if WITH_EDITOR
+	using namespace TicTacToeUnitCook;
+
+	FCoreUObjectDelegates::OnObjectPreSave.Remove(PreSaveHandle);
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+	Backups.Empty();
+#endif
+}
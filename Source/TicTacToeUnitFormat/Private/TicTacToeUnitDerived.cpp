@@ -0,0 +1,191 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitDerived.h"
+#include "TicTacToeUnitBatch.h"
+
+namespace TicTacToeUnitDerived
+{
+	static constexpr double G = FTicTacToeDerivedUnits::StandardGravity;
+
+	// Base unit raised to an integer power
+	struct FTerm
+	{
+		EUnitFamily Family = EUnitFamily::UF_LENGTH;
+		uint8 Unit = 0;
+		int32 Exponent = 1;
+	};
+
+	static FTerm Term(ELengthUnit Unit, int32 Exponent = 1)		{ return { EUnitFamily::UF_LENGTH, (uint8)Unit, Exponent }; }
+	static FTerm Term(EWeightUnit Unit, int32 Exponent = 1)		{ return { EUnitFamily::UF_WEIGHT, (uint8)Unit, Exponent }; }
+	static FTerm Term(EVolumeUnit Unit, int32 Exponent = 1)		{ return { EUnitFamily::UF_VOLUME, (uint8)Unit, Exponent }; }
+	static FTerm Term(ETimeUnit Unit, int32 Exponent = 1)		{ return { EUnitFamily::UF_TIME, (uint8)Unit, Exponent }; }
+	static FTerm Term(EEnergyUnit Unit, int32 Exponent = 1)		{ return { EUnitFamily::UF_ENERGY, (uint8)Unit, Exponent }; }
+
+	// Scale * product of the terms
+	struct FDefinition
+	{
+		double Scale = 1.0;
+		TArray<FTerm, TInlineAllocator<4>> Terms;
+	};
+
+	// Newton (kilogram meter per second squared) times the lever arm
+	static TArray<FTerm, TInlineAllocator<4>> NewtonArm(ELengthUnit Arm)
+	{
+		return { Term(EWeightUnit::WU_MET_KG), Term(ELengthUnit::LU_MET_M), Term(ETimeUnit::TU_SEC, -2), Term(Arm) };
+	}
+
+	static bool GetDefinition(EPowerUnit Unit, FDefinition& OutDefinition)
+	{
+		switch (Unit)
+		{
+		case EPowerUnit::PW_MET_MILIW:		OutDefinition = { 1.0, { Term(EEnergyUnit::EU_MILIJ), Term(ETimeUnit::TU_SEC, -1) } }; return true;
+		case EPowerUnit::PW_MET_W:			OutDefinition = { 1.0, { Term(EEnergyUnit::EU_J), Term(ETimeUnit::TU_SEC, -1) } }; return true;
+		case EPowerUnit::PW_MET_KW:			OutDefinition = { 1.0, { Term(EEnergyUnit::EU_KJ), Term(ETimeUnit::TU_SEC, -1) } }; return true;
+		case EPowerUnit::PW_MET_MW:			OutDefinition = { 1.0, { Term(EEnergyUnit::EU_MJ), Term(ETimeUnit::TU_SEC, -1) } }; return true;
+		case EPowerUnit::PW_MET_GW:			OutDefinition = { 1000.0, { Term(EEnergyUnit::EU_MJ), Term(ETimeUnit::TU_SEC, -1) } }; return true;
+		// 75 kgf m/s
+		case EPowerUnit::PW_MET_PS:			OutDefinition = { 75.0 * G, { Term(EWeightUnit::WU_MET_KG), Term(ELengthUnit::LU_MET_M), Term(ETimeUnit::TU_SEC, -1) } }; return true;
+		case EPowerUnit::PW_US_FTLBF_S:		OutDefinition = { G, { Term(EWeightUnit::WU_US_LB), Term(ELengthUnit::LU_US_FOOT), Term(ETimeUnit::TU_SEC, -1) } }; return true;
+		// 550 ft lbf/s
+		case EPowerUnit::PW_US_HP:			OutDefinition = { 550.0 * G, { Term(EWeightUnit::WU_US_LB), Term(ELengthUnit::LU_US_FOOT), Term(ETimeUnit::TU_SEC, -1) } }; return true;
+		default:							return false;
+		}
+	}
+
+	static bool GetDefinition(EFlowUnit Unit, FDefinition& OutDefinition)
+	{
+		auto Flow = [&OutDefinition](EVolumeUnit Volume, ETimeUnit Time)
+		{
+			OutDefinition = { 1.0, { Term(Volume), Term(Time, -1) } };
+			return true;
+		};
+
+		switch (Unit)
+		{
+		case EFlowUnit::FU_MET_ML_S:		return Flow(EVolumeUnit::VU_MET_ML, ETimeUnit::TU_SEC);
+		case EFlowUnit::FU_MET_L_S:			return Flow(EVolumeUnit::VU_MET_L, ETimeUnit::TU_SEC);
+		case EFlowUnit::FU_MET_L_MIN:		return Flow(EVolumeUnit::VU_MET_L, ETimeUnit::TU_MIN);
+		case EFlowUnit::FU_MET_L_H:			return Flow(EVolumeUnit::VU_MET_L, ETimeUnit::TU_HR);
+		case EFlowUnit::FU_MET_M3_S:		return Flow(EVolumeUnit::VU_MET_M3, ETimeUnit::TU_SEC);
+		case EFlowUnit::FU_MET_M3_H:		return Flow(EVolumeUnit::VU_MET_M3, ETimeUnit::TU_HR);
+		case EFlowUnit::FU_US_GAL_MIN:		return Flow(EVolumeUnit::VU_US_GAL, ETimeUnit::TU_MIN);
+		case EFlowUnit::FU_US_GAL_H:		return Flow(EVolumeUnit::VU_US_GAL, ETimeUnit::TU_HR);
+		case EFlowUnit::FU_US_FT3_S:		return Flow(EVolumeUnit::VU_US_FT3, ETimeUnit::TU_SEC);
+		case EFlowUnit::FU_US_FT3_MIN:		return Flow(EVolumeUnit::VU_US_FT3, ETimeUnit::TU_MIN);
+		default:							return false;
+		}
+	}
+
+	static bool GetDefinition(EDensityUnit Unit, FDefinition& OutDefinition)
+	{
+		auto Density = [&OutDefinition](EWeightUnit Weight, EVolumeUnit Volume)
+		{
+			OutDefinition = { 1.0, { Term(Weight), Term(Volume, -1) } };
+			return true;
+		};
+
+		switch (Unit)
+		{
+		case EDensityUnit::DU_MET_G_M3:		return Density(EWeightUnit::WU_MET_G, EVolumeUnit::VU_MET_M3);
+		case EDensityUnit::DU_MET_KG_M3:	return Density(EWeightUnit::WU_MET_KG, EVolumeUnit::VU_MET_M3);
+		case EDensityUnit::DU_MET_G_CM3:	return Density(EWeightUnit::WU_MET_G, EVolumeUnit::VU_MET_CM3);
+		case EDensityUnit::DU_MET_G_L:		return Density(EWeightUnit::WU_MET_G, EVolumeUnit::VU_MET_L);
+		case EDensityUnit::DU_MET_KG_L:		return Density(EWeightUnit::WU_MET_KG, EVolumeUnit::VU_MET_L);
+		case EDensityUnit::DU_US_LB_FT3:	return Density(EWeightUnit::WU_US_LB, EVolumeUnit::VU_US_FT3);
+		case EDensityUnit::DU_US_LB_IN3:	return Density(EWeightUnit::WU_US_LB, EVolumeUnit::VU_US_IN3);
+		case EDensityUnit::DU_US_LB_GAL:	return Density(EWeightUnit::WU_US_LB, EVolumeUnit::VU_US_GAL);
+		default:							return false;
+		}
+	}
+
+	static bool GetDefinition(EAccelerationUnit Unit, FDefinition& OutDefinition)
+	{
+		auto Acceleration = [&OutDefinition](double Scale, ELengthUnit Length)
+		{
+			OutDefinition = { Scale, { Term(Length), Term(ETimeUnit::TU_SEC, -2) } };
+			return true;
+		};
+
+		switch (Unit)
+		{
+		case EAccelerationUnit::AC_MET_MM_S2:	return Acceleration(1.0, ELengthUnit::LU_MET_MM);
+		case EAccelerationUnit::AC_MET_CM_S2:	return Acceleration(1.0, ELengthUnit::LU_MET_CM);
+		case EAccelerationUnit::AC_MET_M_S2:	return Acceleration(1.0, ELengthUnit::LU_MET_M);
+		case EAccelerationUnit::AC_G:			return Acceleration(G, ELengthUnit::LU_MET_M);
+		case EAccelerationUnit::AC_US_IN_S2:	return Acceleration(1.0, ELengthUnit::LU_US_INCH);
+		case EAccelerationUnit::AC_US_FT_S2:	return Acceleration(1.0, ELengthUnit::LU_US_FOOT);
+		default:								return false;
+		}
+	}
+
+	static bool GetDefinition(ETorqueUnit Unit, FDefinition& OutDefinition)
+	{
+		// Force times lever arm, kgf and lbf are the weight of the mass under standard gravity
+		auto Torque = [&OutDefinition](EWeightUnit Mass, ELengthUnit Arm)
+		{
+			OutDefinition = { G, { Term(Mass), Term(Arm) } };
+			return true;
+		};
+
+		switch (Unit)
+		{
+		case ETorqueUnit::TQ_MET_N_CM:		OutDefinition = { 1.0, NewtonArm(ELengthUnit::LU_MET_CM) }; return true;
+		case ETorqueUnit::TQ_MET_N_M:		OutDefinition = { 1.0, NewtonArm(ELengthUnit::LU_MET_M) }; return true;
+		case ETorqueUnit::TQ_MET_KN_M:		OutDefinition = { 1.0, NewtonArm(ELengthUnit::LU_MET_KM) }; return true;
+		case ETorqueUnit::TQ_MET_KGF_M:		return Torque(EWeightUnit::WU_MET_KG, ELengthUnit::LU_MET_M);
+		case ETorqueUnit::TQ_US_LBF_IN:		return Torque(EWeightUnit::WU_US_LB, ELengthUnit::LU_US_INCH);
+		case ETorqueUnit::TQ_US_LBF_FT:		return Torque(EWeightUnit::WU_US_LB, ELengthUnit::LU_US_FOOT);
+		default:							return false;
+		}
+	}
+
+	static bool GetDefinition(EUnitFamily Family, uint8 Unit, FDefinition& OutDefinition)
+	{
+		switch (Family)
+		{
+		case EUnitFamily::UF_POWER:			return GetDefinition((EPowerUnit)Unit, OutDefinition);
+		case EUnitFamily::UF_FLOW:			return GetDefinition((EFlowUnit)Unit, OutDefinition);
+		case EUnitFamily::UF_DENSITY:		return GetDefinition((EDensityUnit)Unit, OutDefinition);
+		case EUnitFamily::UF_ACCELERATION:	return GetDefinition((EAccelerationUnit)Unit, OutDefinition);
+		case EUnitFamily::UF_TORQUE:		return GetDefinition((ETorqueUnit)Unit, OutDefinition);
+		default:							return false;
+		}
+	}
+}
+
+bool FTicTacToeDerivedUnits::IsDerived(EUnitFamily Family)
+{
+	switch (Family)
+	{
+	case EUnitFamily::UF_POWER:
+	case EUnitFamily::UF_FLOW:
+	case EUnitFamily::UF_DENSITY:
+	case EUnitFamily::UF_ACCELERATION:
+	case EUnitFamily::UF_TORQUE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+double FTicTacToeDerivedUnits::GetFactor(EUnitFamily Family, uint8 Unit)
+{
+	using namespace TicTacToeUnitDerived;
+
+	FDefinition Definition;
+	if (!GetDefinition(Family, Unit, Definition)) return 0.0;
+
+	// Terms are base families only, whose Convert functions do not depend on the derived tables
+	double Factor = Definition.Scale;
+	for (const FTerm& Term : Definition.Terms)
+	{
+		const double TermFactor = UTicTacToeUnitFormatBPLibrary::ConvertUnit(1.0, Term.Family, Term.Unit, FTicTacToeUnitBatch::GetCanonicalUnit(Term.Family));
+		if (TermFactor == 0.0) return 0.0;
+
+		for (int32 Power = 0; Power < FMath::Abs(Term.Exponent); ++Power)
+		{
+			Factor = Term.Exponent > 0 ? Factor * TermFactor : Factor / TermFactor;
+		}
+	}
+	return Factor;
+}
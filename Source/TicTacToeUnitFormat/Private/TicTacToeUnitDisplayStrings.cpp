@@ -0,0 +1,456 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitDisplayStrings.h"
+#include "Internationalization/Internationalization.h"
+
+#define LOCTEXT_NAMESPACE "FTicTacToeUnitFormatModule"
+
+const FText* FTicTacToeUnitDisplayStrings::Find(EUnitFamily Family, uint8 Unit)
+{
+	const TArray<TArray<FText>>& Tables = Get().Tables;
+	if (!Tables.IsValidIndex((int32)Family) || !Tables[(int32)Family].IsValidIndex(Unit)) return nullptr;
+
+	const FText& DisplayString = Tables[(int32)Family][Unit];
+	return DisplayString.IsEmpty() ? nullptr : &DisplayString;
+}
+
+int32 FTicTacToeUnitDisplayStrings::GetLength(EUnitFamily Family, uint8 Unit)
+{
+	const FTicTacToeUnitDisplayStrings& Instance = Get();
+	if ((int32)Family >= EngineSpeedSlot || Unit >= MaxUnits) return 0;
+
+	std::atomic<int32>& CachedLength = Instance.Lengths[(int32)Family][Unit];
+	int32 Length = CachedLength.load(std::memory_order_relaxed);
+	if (Length >= 0) return Length;
+
+	const FText* DisplayString = Find(Family, Unit);
+	Length = DisplayString ? DisplayString->ToString().Len() : 0;
+	CachedLength.store(Length, std::memory_order_relaxed);
+	return Length;
+}
+
+int32 FTicTacToeUnitDisplayStrings::GetMaxLength(EUnitFamily Family)
+{
+	const FTicTacToeUnitDisplayStrings& Instance = Get();
+	if (!Instance.Tables.IsValidIndex((int32)Family)) return 0;
+
+	return Instance.GetCachedMaxLength((int32)Family, Instance.Tables[(int32)Family]);
+}
+
+const FText* FTicTacToeUnitDisplayStrings::Find(EEngineSpeedUnit Unit)
+{
+	const TArray<FText>& EngineSpeeds = Get().EngineSpeeds;
+	return EngineSpeeds.IsValidIndex((int32)Unit) ? &EngineSpeeds[(int32)Unit] : nullptr;
+}
+
+int32 FTicTacToeUnitDisplayStrings::GetMaxEngineSpeedLength()
+{
+	const FTicTacToeUnitDisplayStrings& Instance = Get();
+	return Instance.GetCachedMaxLength(EngineSpeedSlot, Instance.EngineSpeeds);
+}
+
+const FTicTacToeUnitDisplayStrings& FTicTacToeUnitDisplayStrings::Get()
+{
+	static const FTicTacToeUnitDisplayStrings Instance;
+	return Instance;
+}
+
+int32 FTicTacToeUnitDisplayStrings::GetCachedMaxLength(int32 Slot, const TArray<FText>& Strings) const
+{
+	int32 MaxLength = MaxLengths[Slot].load(std::memory_order_relaxed);
+	if (MaxLength >= 0) return MaxLength;
+
+	MaxLength = 0;
+	for (const FText& DisplayString : Strings)
+	{
+		MaxLength = FMath::Max(MaxLength, DisplayString.ToString().Len());
+	}
+	MaxLengths[Slot].store(MaxLength, std::memory_order_relaxed);
+	return MaxLength;
+}
+
+void FTicTacToeUnitDisplayStrings::InvalidateLengths()
+{
+	for (std::atomic<int32>& MaxLength : MaxLengths)
+	{
+		MaxLength.store(-1, std::memory_order_relaxed);
+	}
+	for (std::atomic<int32> (&FamilyLengths)[MaxUnits] : Lengths)
+	{
+		for (std::atomic<int32>& Length : FamilyLengths)
+		{
+			Length.store(-1, std::memory_order_relaxed);
+		}
+	}
+}
+
+template<typename UnitType>
+void FTicTacToeUnitDisplayStrings::Add(EUnitFamily Family, const TMap<UnitType, FText>& Strings)
+{
+	if (Tables.Num() <= (int32)Family) Tables.SetNum((int32)Family + 1);
+
+	TArray<FText>& Table = Tables[(int32)Family];
+	for (const TPair<UnitType, FText>& Pair : Strings)
+	{
+		if (Table.Num() <= (int32)Pair.Key) Table.SetNum((int32)Pair.Key + 1);
+		Table[(int32)Pair.Key] = Pair.Value;
+	}
+	Table.Shrink();
+}
+
+FTicTacToeUnitDisplayStrings::~FTicTacToeUnitDisplayStrings()
+{
+	if (FInternationalization::IsAvailable())
+	{
+		FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+	}
+}
+
+FTicTacToeUnitDisplayStrings::FTicTacToeUnitDisplayStrings()
+{
+	// Translated suffixes have other lengths, they are measured again on first use in the new culture
+	InvalidateLengths();
+	CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddRaw(this, &FTicTacToeUnitDisplayStrings::InvalidateLengths);
+
+	const TMap<ELengthUnit, FText> LengthUnitDisplayStrings =
+	{
+		// Metric
+		{ ELengthUnit::LU_MET_MM			, LOCTEXT("mm"		,	"mm")	},
+		{ ELengthUnit::LU_MET_CM			, LOCTEXT("cm"		,	"cm")	},
+		{ ELengthUnit::LU_MET_DM			, LOCTEXT("dm"		,	"dm")	},
+		{ ELengthUnit::LU_MET_M				, LOCTEXT("m"		,	"m")	},
+		{ ELengthUnit::LU_MET_DAM			, LOCTEXT("dam"		,	"dam")	},
+		{ ELengthUnit::LU_MET_HM			, LOCTEXT("Hm"		,	"Hm")	},
+		{ ELengthUnit::LU_MET_KM			, LOCTEXT("Km"		,	"Km")	},
+		// Imperial USA
+		{ ELengthUnit::LU_US_TWIP			, LOCTEXT("LU_US_TWIP"		,	"twip")		},
+		{ ELengthUnit::LU_US_MIL			, LOCTEXT("LU_US_MIL"		,	"mil")		},
+		{ ELengthUnit::LU_US_POINT			, LOCTEXT("LU_US_POINT"		,	"p")		},
+		{ ELengthUnit::LU_US_PICA			, LOCTEXT("LU_US_PICA"		,	"P")		},
+		{ ELengthUnit::LU_US_INCH			, LOCTEXT("LU_US_INCH"		,	"in")		},
+		{ ELengthUnit::LU_US_FOOT			, LOCTEXT("LU_US_FOOT"		,	"ft")		},
+		{ ELengthUnit::LU_US_YARD			, LOCTEXT("LU_US_YARD"		,	"yd")		},
+		{ ELengthUnit::LU_US_MILE			, LOCTEXT("LU_US_MILE"		,	"mi")		},
+		{ ELengthUnit::LU_US_LEAGUE			, LOCTEXT("LU_US_LEAGUE"	,	"le")		},
+		// Imperial British
+		{ ELengthUnit::LU_BRIT_THOU			, LOCTEXT("th"		,	"th")	},
+		{ ELengthUnit::LU_BRIT_BARLEYCORN	, LOCTEXT("BCorn"	,	"BCorn")	},
+		{ ELengthUnit::LU_BRIT_IN			, LOCTEXT("in"		,	"in")	},
+		{ ELengthUnit::LU_BRIT_HH			, LOCTEXT("hh"		,	"hh")	},
+		{ ELengthUnit::LU_BRIT_FT			, LOCTEXT("ft"		,	"ft")	},
+		{ ELengthUnit::LU_BRIT_YD			, LOCTEXT("yd"		,	"yd")	},
+		{ ELengthUnit::LU_BRIT_CH			, LOCTEXT("ch"		,	"ch")	},
+		{ ELengthUnit::LU_BRIT_FUR			, LOCTEXT("fur"		,	"fur")	},
+		{ ELengthUnit::LU_BRIT_MI			, LOCTEXT("mi"		,	"mi")	},
+		{ ELengthUnit::LU_BRIT_LEA			, LOCTEXT("lea"		,	"lea")	},
+		// Maritime
+		{ ELengthUnit::LU_BRIT_FTM			, LOCTEXT("ftm"		,	"ftm")	},
+		{ ELengthUnit::LU_BRIT_CABLE		, LOCTEXT("cable"	,	"cable")	},
+		{ ELengthUnit::LU_BRIT_NMI			, LOCTEXT("nmi"		,	"nmi")	},
+	};
+	Add(EUnitFamily::UF_LENGTH, LengthUnitDisplayStrings);
+
+	const TMap<EWeightUnit, FText> WeightUnitDisplayStrings =
+	{
+		// Metric
+		{ EWeightUnit::WU_MET_MG			, LOCTEXT("mg"		,	"mg")		},
+		{ EWeightUnit::WU_MET_CG			, LOCTEXT("cg"		,	"cg")		},
+		{ EWeightUnit::WU_MET_G				, LOCTEXT("g"		,	"g")		},
+		{ EWeightUnit::WU_MET_DG			, LOCTEXT("dg"		,	"dg")		},
+		{ EWeightUnit::WU_MET_HG			, LOCTEXT("hg"		,	"hg")		},
+		{ EWeightUnit::WU_MET_KG			, LOCTEXT("kg"		,	"kg")		},
+		{ EWeightUnit::WU_MET_TON			, LOCTEXT("t"		,	"t")		},
+		// Imperial US
+		{ EWeightUnit::WU_US_GR				, LOCTEXT("gr"		,	"gr")		},
+		{ EWeightUnit::WU_US_DR				, LOCTEXT("dr"		,	"dr")		},
+		{ EWeightUnit::WU_US_OZ				, LOCTEXT("oz"		,	"oz")		},
+		{ EWeightUnit::WU_US_LB				, LOCTEXT("lb"		,	"lb")		},
+		{ EWeightUnit::WU_US_CWT_S			, LOCTEXT("cwt"		,	"cwt")		},
+		{ EWeightUnit::WU_US_CWT_L			, LOCTEXT("cwt"		,	"cwt")		},
+		{ EWeightUnit::WU_US_TON_S			, LOCTEXT("ton"		,	"ton")		},
+		{ EWeightUnit::WU_US_TON_L			, LOCTEXT("ton"		,	"ton")		},
+		// Imperial British
+		{ EWeightUnit::WU_BRIT_GR			, LOCTEXT("gr"		,	"gr")		},
+		{ EWeightUnit::WU_BRIT_DR			, LOCTEXT("dr"		,	"dr")		},
+		{ EWeightUnit::WU_BRIT_OZ			, LOCTEXT("oz"		,	"oz")		},
+		{ EWeightUnit::WU_BRIT_LB			, LOCTEXT("lb"		,	"lb")		},
+		{ EWeightUnit::WU_BRIT_ST			, LOCTEXT("st"		,	"st")		},
+		{ EWeightUnit::WU_BRIT_QR			, LOCTEXT("qr"		,	"qr")		},
+		{ EWeightUnit::WU_BRIT_CWT			, LOCTEXT("cwt"		,	"cwt")		},
+		{ EWeightUnit::WU_BRIT_TON			, LOCTEXT("ton"		,	"ton")		},
+		// Other
+		{ EWeightUnit::WU_BRIT_SLUG			, LOCTEXT("slug"	,	"slug")		},
+	};
+	Add(EUnitFamily::UF_WEIGHT, WeightUnitDisplayStrings);
+
+	const TMap<EVolumeUnit, FText> VolumeUnitDisplayStrings =
+	{
+		// Metric liters
+		{ EVolumeUnit::VU_MET_ML			, LOCTEXT("met_mL"		, "mL")			},
+		{ EVolumeUnit::VU_MET_CL			, LOCTEXT("met_cL"		, "cL")			},
+		{ EVolumeUnit::VU_MET_DL			, LOCTEXT("met_dL"		, "dL")			},
+		{ EVolumeUnit::VU_MET_L				, LOCTEXT("met_L"		, "L")			},
+		{ EVolumeUnit::VU_MET_DAL			, LOCTEXT("met_DaL"		, "DaL")		},
+		{ EVolumeUnit::VU_MET_HL			, LOCTEXT("met_hL"		, "hL")			},
+		{ EVolumeUnit::VU_MET_KL			, LOCTEXT("met_kL"		, "kL")			},
+		// Metric											
+		{ EVolumeUnit::VU_MET_MM3			, LOCTEXT("met_mm3"		, "mm3")		},
+		{ EVolumeUnit::VU_MET_CM3			, LOCTEXT("met_cm3"		, "cm3")		},
+		{ EVolumeUnit::VU_MET_DM3			, LOCTEXT("met_dm3"		, "dm3")		},
+		{ EVolumeUnit::VU_MET_M3			, LOCTEXT("met_m3"		, "m3")			},
+		{ EVolumeUnit::VU_MET_DAM3			, LOCTEXT("met_Dam3"	, "Dam3")		},
+		{ EVolumeUnit::VU_MET_HM3			, LOCTEXT("met_hm3"		, "hm3")		},
+		{ EVolumeUnit::VU_MET_KM3			, LOCTEXT("met_km3"		, "km3")		},
+		// Imperial	
+		{ EVolumeUnit::VU_BRIT_FLOZ			, LOCTEXT("brit_fl oz"	, "fl oz")		},
+		{ EVolumeUnit::VU_BRIT_GI			, LOCTEXT("brit_gi"		, "gi")			},
+		{ EVolumeUnit::VU_BRIT_PT			, LOCTEXT("brit_pt"		, "pt")			},
+		{ EVolumeUnit::VU_BRIT_QT			, LOCTEXT("brit_qt"		, "qt")			},
+		{ EVolumeUnit::VU_BRIT_GAL			, LOCTEXT("brit_gal"	, "gal")		},
+		// Imperial US fluid
+		{ EVolumeUnit::VU_US_MIN			, LOCTEXT("us_min"		, "min")	},
+		{ EVolumeUnit::VU_US_FLDR			, LOCTEXT("us_fl dr"	, "fl dr")	},
+		{ EVolumeUnit::VU_US_TSP			, LOCTEXT("us_tsp"		, "tsp")	},
+		{ EVolumeUnit::VU_US_TBSP			, LOCTEXT("us_tbsp"		, "tbsp")	},
+		{ EVolumeUnit::VU_US_FLOZ			, LOCTEXT("us_fl oz"	, "fl oz")	},
+		{ EVolumeUnit::VU_US_JIG			, LOCTEXT("us_jig"		, "jig")	},
+		{ EVolumeUnit::VU_US_GI				, LOCTEXT("us_gi"		, "gi")	},
+		{ EVolumeUnit::VU_US_C				, LOCTEXT("us_c"		, "c")	},
+		{ EVolumeUnit::VU_US_PT				, LOCTEXT("us_pint"		, "pint")	},
+		{ EVolumeUnit::VU_US_QT				, LOCTEXT("us_qt"		, "qt")	},
+		{ EVolumeUnit::VU_US_POT			, LOCTEXT("us_pot"		, "pot")	},
+		{ EVolumeUnit::VU_US_GAL			, LOCTEXT("us_gal"		, "gal")	},
+		{ EVolumeUnit::VU_US_BBL			, LOCTEXT("us_bbl"		, "bbl")	},
+		{ EVolumeUnit::VU_US_OILBBL			, LOCTEXT("us_oilbbl"	, "bbl")	},
+		{ EVolumeUnit::VU_US_HOGSHEAD		, LOCTEXT("us_hogshead"	, "hogshead")	},
+		// Imperial US	
+		{ EVolumeUnit::VU_US_IN3			, LOCTEXT("us_in3"		, "in3")		},
+		{ EVolumeUnit::VU_US_FT3			, LOCTEXT("us_ft3"		, "ft3")		},
+		{ EVolumeUnit::VU_US_YD3			, LOCTEXT("us_yd3"		, "yd3")		},
+		{ EVolumeUnit::VU_US_ACREFT			, LOCTEXT("us_acrefoot"	, "acre-foot")	},
+	};
+	Add(EUnitFamily::UF_VOLUME, VolumeUnitDisplayStrings);
+
+	const TMap<EAreaUnit, FText> AreaUnitDisplayStrings =
+	{
+		// Metric
+		{ EAreaUnit::AU_MET_MM2				, LOCTEXT("met_mm2",	"mm2")	},
+		{ EAreaUnit::AU_MET_CM2				, LOCTEXT("met_cm2",	"cm2")	},
+		{ EAreaUnit::AU_MET_DM2				, LOCTEXT("met_dm2",	"dm2")	},
+		{ EAreaUnit::AU_MET_M2				, LOCTEXT("met_m2",	"m2")	},
+		{ EAreaUnit::AU_MET_DAM2			, LOCTEXT("met_dam2",	"Dam2")	},
+		{ EAreaUnit::AU_MET_HM2				, LOCTEXT("met_hm2",	"hm2")	},
+		{ EAreaUnit::AU_MET_HA				, LOCTEXT("met_ha",	"ha")	},
+		{ EAreaUnit::AU_MET_KM2				, LOCTEXT("met_km2",	"km2")	},
+		// Imperial US						  
+		{ EAreaUnit::AU_US_SQIN				, LOCTEXT("us_sqin",	"sq in")	},
+		{ EAreaUnit::AU_US_SQFT				, LOCTEXT("us_sqft",	"sq ft")	},
+		{ EAreaUnit::AU_US_SQYD				, LOCTEXT("us_sqyd",	"sq yd")	},
+		{ EAreaUnit::AU_US_SQCH				, LOCTEXT("us_sq ch",	"sq ch")	},
+		{ EAreaUnit::AU_US_ACRE				, LOCTEXT("us_acre",	"acre")		},
+		{ EAreaUnit::AU_US_SEC				, LOCTEXT("us_sec",	"sec")		},
+		{ EAreaUnit::AU_US_TWP				, LOCTEXT("us_twp",	"twp")		},
+	};
+	Add(EUnitFamily::UF_AREA, AreaUnitDisplayStrings);
+
+	const TMap<ETemperatureUnit, FText> TemperatureUnitDisplayStrings =
+	{
+		{ ETemperatureUnit::TU_CEL			, LOCTEXT("cel",		"°C")		},
+		{ ETemperatureUnit::TU_FAR			, LOCTEXT("far",		"°F")		},
+		{ ETemperatureUnit::TU_KEL			, LOCTEXT("kel",		"K")		},
+	};
+	Add(EUnitFamily::UF_TEMPERATURE, TemperatureUnitDisplayStrings);
+
+	const TMap<ETimeUnit, FText> TimeUnitDisplayStrings =
+	{
+		// Metric
+		{ ETimeUnit::TU_SEC	,	LOCTEXT("second"	, "s")			},
+		{ ETimeUnit::TU_MIN	,	LOCTEXT("minute"	, "m")			},
+		{ ETimeUnit::TU_HR	,	LOCTEXT("hour"		, "h")			},
+		{ ETimeUnit::TU_DAY	,	LOCTEXT("day"		, "d")			},
+		{ ETimeUnit::TU_MO	,	LOCTEXT("month"	, "m")			},
+		{ ETimeUnit::TU_YR	,	LOCTEXT("year"		, "y")			},
+	};
+	Add(EUnitFamily::UF_TIME, TimeUnitDisplayStrings);
+
+	const TMap<EPressureUnit, FText> PressureUnitDisplayStrings =
+	{
+		{ EPressureUnit::PU_MET_MILIPA		, LOCTEXT("met_miliPa", "mPa")	},
+		{ EPressureUnit::PU_MET_CPA			, LOCTEXT("met_cPa", "cPa")		},
+		{ EPressureUnit::PU_MET_DPA			, LOCTEXT("met_dPa", "dPa")		},
+		{ EPressureUnit::PU_MET_PA			, LOCTEXT("met_Pa", "Pa")		},
+		{ EPressureUnit::PU_MET_DAPA		, LOCTEXT("met_daPa", "daPa")	},
+		{ EPressureUnit::PU_MET_HPA			, LOCTEXT("met_hPa", "hPa")		},
+		{ EPressureUnit::PU_MET_KPA			, LOCTEXT("met_kPa", "kPa")		},
+		{ EPressureUnit::PU_MET_BAR			, LOCTEXT("met_bar", "bar")		},
+		{ EPressureUnit::PU_MET_MPA			, LOCTEXT("met_MPa", "MPa")		},
+		{ EPressureUnit::PU_MET_GPA			, LOCTEXT("met_GPa", "GPa")		},
+		// Imperial (US)
+		{ EPressureUnit::PU_MET_PSI			, LOCTEXT("us_psi", "PSI")		},
+		// Gauge
+		{ EPressureUnit::PU_MET_BARG		, LOCTEXT("met_barg", "barg")	},
+		{ EPressureUnit::PU_US_PSIG			, LOCTEXT("us_psig", "psig")	},
+	};
+	Add(EUnitFamily::UF_PRESSURE, PressureUnitDisplayStrings);
+
+	const TMap<EEnergyUnit, FText> EnergyUnitDisplayStrings =
+	{
+		// Joules
+		{ EEnergyUnit::EU_UJ			, LOCTEXT("EU_UJ" ,		"µJ")				},
+		{ EEnergyUnit::EU_MILIJ			, LOCTEXT("EU_MILIJ" ,	"mJ")				},
+		{ EEnergyUnit::EU_J				, LOCTEXT("EU_J" ,		"J")				},
+		{ EEnergyUnit::EU_KJ			, LOCTEXT("EU_KJ" ,		"kJ")				},
+		{ EEnergyUnit::EU_MJ			, LOCTEXT("EU_MJ" ,		"MJ")				},
+		// Watt-hour
+		{ EEnergyUnit::EU_WH			, LOCTEXT("EU_WH" ,	"Wh")				},
+		{ EEnergyUnit::EU_KWH			, LOCTEXT("EU_KWH" ,	"kWh")				},
+		{ EEnergyUnit::EU_MWH			, LOCTEXT("EU_MWH" ,	"MWh")				},
+		// Calorie
+		{ EEnergyUnit::EU_CAL			, LOCTEXT("EU_CAL" ,	"cal")				},
+		{ EEnergyUnit::EU_KCAL			, LOCTEXT("EU_KCAL" ,	"kCal")			},
+	};
+	Add(EUnitFamily::UF_ENERGY, EnergyUnitDisplayStrings);
+
+	const TMap<EAngleUnit, FText> AngleUnitDisplayStrings =
+	{
+		{ EAngleUnit::AU_DEG			, LOCTEXT("au_deg",			"°")	},
+		{ EAngleUnit::AU_RAD			, LOCTEXT("au_rad",			"rad")	},
+		{ EAngleUnit::AU_MOA			, LOCTEXT("au_moa",			"MOA")	},
+		{ EAngleUnit::AU_MILIR			, LOCTEXT("au_milir",		"milirad")	},
+		{ EAngleUnit::AU_MIL_OTAN		, LOCTEXT("au_milotan",		"mil")	},
+		{ EAngleUnit::AU_MIL_RU			, LOCTEXT("au_milru",		"mil")	},
+		{ EAngleUnit::AU_MIL_SU			, LOCTEXT("au_milsu",		"mil")	},
+	};
+	Add(EUnitFamily::UF_ANGLE, AngleUnitDisplayStrings);
+
+	const TMap<EPowerUnit, FText> PowerUnitDisplayStrings =
+	{
+		// Metric
+		{ EPowerUnit::PW_MET_MILIW		, LOCTEXT("pw_miliw",		"mW")		},
+		{ EPowerUnit::PW_MET_W			, LOCTEXT("pw_w",			"W")		},
+		{ EPowerUnit::PW_MET_KW			, LOCTEXT("pw_kw",			"kW")		},
+		{ EPowerUnit::PW_MET_MW			, LOCTEXT("pw_mw",			"MW")		},
+		{ EPowerUnit::PW_MET_GW			, LOCTEXT("pw_gw",			"GW")		},
+		{ EPowerUnit::PW_MET_PS			, LOCTEXT("pw_ps",			"PS")		},
+		// Imperial (US)
+		{ EPowerUnit::PW_US_FTLBF_S		, LOCTEXT("pw_ftlbf_s",		"ft·lbf/s")	},
+		{ EPowerUnit::PW_US_HP			, LOCTEXT("pw_hp",			"hp")		},
+	};
+	Add(EUnitFamily::UF_POWER, PowerUnitDisplayStrings);
+
+	const TMap<EFlowUnit, FText> FlowUnitDisplayStrings =
+	{
+		// Metric
+		{ EFlowUnit::FU_MET_ML_S		, LOCTEXT("fu_ml_s",		"mL/s")		},
+		{ EFlowUnit::FU_MET_L_S			, LOCTEXT("fu_l_s",			"L/s")		},
+		{ EFlowUnit::FU_MET_L_MIN		, LOCTEXT("fu_l_min",		"L/min")	},
+		{ EFlowUnit::FU_MET_L_H			, LOCTEXT("fu_l_h",			"L/h")		},
+		{ EFlowUnit::FU_MET_M3_S		, LOCTEXT("fu_m3_s",		"m3/s")		},
+		{ EFlowUnit::FU_MET_M3_H		, LOCTEXT("fu_m3_h",		"m3/h")		},
+		// Imperial (US)
+		{ EFlowUnit::FU_US_GAL_MIN		, LOCTEXT("fu_gal_min",		"gal/min")	},
+		{ EFlowUnit::FU_US_GAL_H		, LOCTEXT("fu_gal_h",		"gal/h")	},
+		{ EFlowUnit::FU_US_FT3_S		, LOCTEXT("fu_ft3_s",		"ft3/s")	},
+		{ EFlowUnit::FU_US_FT3_MIN		, LOCTEXT("fu_ft3_min",		"ft3/min")	},
+	};
+	Add(EUnitFamily::UF_FLOW, FlowUnitDisplayStrings);
+
+	const TMap<EDensityUnit, FText> DensityUnitDisplayStrings =
+	{
+		// Metric
+		{ EDensityUnit::DU_MET_G_M3		, LOCTEXT("du_g_m3",		"g/m3")		},
+		{ EDensityUnit::DU_MET_KG_M3	, LOCTEXT("du_kg_m3",		"kg/m3")	},
+		{ EDensityUnit::DU_MET_G_CM3	, LOCTEXT("du_g_cm3",		"g/cm3")	},
+		{ EDensityUnit::DU_MET_G_L		, LOCTEXT("du_g_l",			"g/L")		},
+		{ EDensityUnit::DU_MET_KG_L		, LOCTEXT("du_kg_l",		"kg/L")		},
+		// Imperial (US)
+		{ EDensityUnit::DU_US_LB_FT3	, LOCTEXT("du_lb_ft3",		"lb/ft3")	},
+		{ EDensityUnit::DU_US_LB_IN3	, LOCTEXT("du_lb_in3",		"lb/in3")	},
+		{ EDensityUnit::DU_US_LB_GAL	, LOCTEXT("du_lb_gal",		"lb/gal")	},
+	};
+	Add(EUnitFamily::UF_DENSITY, DensityUnitDisplayStrings);
+
+	const TMap<EAccelerationUnit, FText> AccelerationUnitDisplayStrings =
+	{
+		// Metric
+		{ EAccelerationUnit::AC_MET_MM_S2	, LOCTEXT("ac_mm_s2",	"mm/s2")	},
+		{ EAccelerationUnit::AC_MET_CM_S2	, LOCTEXT("ac_cm_s2",	"cm/s2")	},
+		{ EAccelerationUnit::AC_MET_M_S2	, LOCTEXT("ac_m_s2",	"m/s2")		},
+		{ EAccelerationUnit::AC_G			, LOCTEXT("ac_g",		"g")		},
+		// Imperial (US)
+		{ EAccelerationUnit::AC_US_IN_S2	, LOCTEXT("ac_in_s2",	"in/s2")	},
+		{ EAccelerationUnit::AC_US_FT_S2	, LOCTEXT("ac_ft_s2",	"ft/s2")	},
+	};
+	Add(EUnitFamily::UF_ACCELERATION, AccelerationUnitDisplayStrings);
+
+	const TMap<ETorqueUnit, FText> TorqueUnitDisplayStrings =
+	{
+		// Metric
+		{ ETorqueUnit::TQ_MET_N_CM		, LOCTEXT("tq_n_cm",		"N·cm")		},
+		{ ETorqueUnit::TQ_MET_N_M		, LOCTEXT("tq_n_m",			"N·m")		},
+		{ ETorqueUnit::TQ_MET_KN_M		, LOCTEXT("tq_kn_m",		"kN·m")		},
+		{ ETorqueUnit::TQ_MET_KGF_M		, LOCTEXT("tq_kgf_m",		"kgf·m")	},
+		// Imperial (US)
+		{ ETorqueUnit::TQ_US_LBF_IN		, LOCTEXT("tq_lbf_in",		"lbf·in")	},
+		{ ETorqueUnit::TQ_US_LBF_FT		, LOCTEXT("tq_lbf_ft",		"lbf·ft")	},
+	};
+	Add(EUnitFamily::UF_TORQUE, TorqueUnitDisplayStrings);
+
+	const TMap<EDataSizeUnit, FText> DataSizeUnitDisplayStrings =
+	{
+		// Bits
+		{ EDataSizeUnit::DS_BIT			, LOCTEXT("ds_bit",			"bit")		},
+		{ EDataSizeUnit::DS_KBIT		, LOCTEXT("ds_kbit",		"kbit")		},
+		{ EDataSizeUnit::DS_MBIT		, LOCTEXT("ds_mbit",		"Mbit")		},
+		{ EDataSizeUnit::DS_GBIT		, LOCTEXT("ds_gbit",		"Gbit")		},
+		{ EDataSizeUnit::DS_TBIT		, LOCTEXT("ds_tbit",		"Tbit")		},
+		// Bytes, SI
+		{ EDataSizeUnit::DS_BYTE		, LOCTEXT("ds_b",			"B")		},
+		{ EDataSizeUnit::DS_KB			, LOCTEXT("ds_kb",			"kB")		},
+		{ EDataSizeUnit::DS_MB			, LOCTEXT("ds_mb",			"MB")		},
+		{ EDataSizeUnit::DS_GB			, LOCTEXT("ds_gb",			"GB")		},
+		{ EDataSizeUnit::DS_TB			, LOCTEXT("ds_tb",			"TB")		},
+		{ EDataSizeUnit::DS_PB			, LOCTEXT("ds_pb",			"PB")		},
+		// Bytes, IEC
+		{ EDataSizeUnit::DS_KIB			, LOCTEXT("ds_kib",			"KiB")		},
+		{ EDataSizeUnit::DS_MIB			, LOCTEXT("ds_mib",			"MiB")		},
+		{ EDataSizeUnit::DS_GIB			, LOCTEXT("ds_gib",			"GiB")		},
+		{ EDataSizeUnit::DS_TIB			, LOCTEXT("ds_tib",			"TiB")		},
+		{ EDataSizeUnit::DS_PIB			, LOCTEXT("ds_pib",			"PiB")		},
+	};
+	Add(EUnitFamily::UF_DATA_SIZE, DataSizeUnitDisplayStrings);
+
+	const TMap<EDataRateUnit, FText> DataRateUnitDisplayStrings =
+	{
+		// Bits
+		{ EDataRateUnit::DR_BIT_S		, LOCTEXT("dr_bit_s",		"bit/s")	},
+		{ EDataRateUnit::DR_KBIT_S		, LOCTEXT("dr_kbit_s",		"kbit/s")	},
+		{ EDataRateUnit::DR_MBIT_S		, LOCTEXT("dr_mbit_s",		"Mbit/s")	},
+		{ EDataRateUnit::DR_GBIT_S		, LOCTEXT("dr_gbit_s",		"Gbit/s")	},
+		{ EDataRateUnit::DR_TBIT_S		, LOCTEXT("dr_tbit_s",		"Tbit/s")	},
+		// Bytes, SI
+		{ EDataRateUnit::DR_BYTE_S		, LOCTEXT("dr_b_s",			"B/s")		},
+		{ EDataRateUnit::DR_KB_S		, LOCTEXT("dr_kb_s",		"kB/s")		},
+		{ EDataRateUnit::DR_MB_S		, LOCTEXT("dr_mb_s",		"MB/s")		},
+		{ EDataRateUnit::DR_GB_S		, LOCTEXT("dr_gb_s",		"GB/s")		},
+		{ EDataRateUnit::DR_TB_S		, LOCTEXT("dr_tb_s",		"TB/s")		},
+		{ EDataRateUnit::DR_PB_S		, LOCTEXT("dr_pb_s",		"PB/s")		},
+		// Bytes, IEC
+		{ EDataRateUnit::DR_KIB_S		, LOCTEXT("dr_kib_s",		"KiB/s")	},
+		{ EDataRateUnit::DR_MIB_S		, LOCTEXT("dr_mib_s",		"MiB/s")	},
+		{ EDataRateUnit::DR_GIB_S		, LOCTEXT("dr_gib_s",		"GiB/s")	},
+		{ EDataRateUnit::DR_TIB_S		, LOCTEXT("dr_tib_s",		"TiB/s")	},
+		{ EDataRateUnit::DR_PIB_S		, LOCTEXT("dr_pib_s",		"PiB/s")	},
+	};
+	Add(EUnitFamily::UF_DATA_RATE, DataRateUnitDisplayStrings);
+
+	EngineSpeeds =
+	{
+		LOCTEXT("ESU_KM_H"	,	"km/h"),
+		LOCTEXT("ESU_MI_H"	,	"mph"),
+		LOCTEXT("ESU_KN"	,	"kn"),
+		LOCTEXT("ESU_M_S"	,	"m/s"),
+	};
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,457 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitFixedPoint.h"
+
+namespace TicTacToeFixedPoint
+{
+	// --- --- LENGTH --- --- //
+
+	static const TMap<ELengthUnit, FTicTacToeUnitRatio> LengthRatiosToM =
+	{
+		// Metric
+		{ ELengthUnit::LU_MET_MM				, { 1, 1000 }				},
+		{ ELengthUnit::LU_MET_CM				, { 1, 100 }				},
+		{ ELengthUnit::LU_MET_DM				, { 1, 10 }					},
+		{ ELengthUnit::LU_MET_M					, { 1, 1 }					},
+		{ ELengthUnit::LU_MET_DAM				, { 10, 1 }					},
+		{ ELengthUnit::LU_MET_HM				, { 100, 1 }				},
+		{ ELengthUnit::LU_MET_KM				, { 1000, 1 }				},
+		// Imperial USA
+		{ ELengthUnit::LU_US_TWIP				, { 8819, 5000000000 }		},
+		{ ELengthUnit::LU_US_MIL				, { 127, 50000000 }			},
+		{ ELengthUnit::LU_US_POINT				, { 3527, 100000000 }		},
+		{ ELengthUnit::LU_US_PICA				, { 423, 100000 }			},
+		{ ELengthUnit::LU_US_INCH				, { 127, 5000 }				},
+		{ ELengthUnit::LU_US_FOOT				, { 381, 1250 }				},
+		{ ELengthUnit::LU_US_YARD				, { 1143, 1250 }			},
+		{ ELengthUnit::LU_US_MILE				, { 201168, 125 }			},
+		{ ELengthUnit::LU_US_LEAGUE				, { 603504, 125 }			},
+		// Imperial British
+		{ ELengthUnit::LU_BRIT_THOU				, { 127, 50000000 }			},
+		{ ELengthUnit::LU_BRIT_BARLEYCORN		, { 423, 50000 }			},
+		{ ELengthUnit::LU_BRIT_IN				, { 127, 5000 }				},
+		{ ELengthUnit::LU_BRIT_HH				, { 127, 1250 }				},
+		{ ELengthUnit::LU_BRIT_FT				, { 381, 1250 }				},
+		{ ELengthUnit::LU_BRIT_YD				, { 1143, 1250 }			},
+		{ ELengthUnit::LU_BRIT_CH				, { 12573, 625 }			},
+		{ ELengthUnit::LU_BRIT_FUR				, { 25146, 125 }			},
+		{ ELengthUnit::LU_BRIT_MI				, { 201168, 125 }			},
+		{ ELengthUnit::LU_BRIT_LEA				, { 603504, 125 }			},
+		// Maritime British
+		{ ELengthUnit::LU_BRIT_FTM				, { 463, 250 }				},
+		{ ELengthUnit::LU_BRIT_CABLE			, { 926, 5 }				},
+		{ ELengthUnit::LU_BRIT_NMI				, { 1852, 1 }				},
+	};
+
+	// --- --- WEIGHT --- --- //
+
+	static const TMap<EWeightUnit, FTicTacToeUnitRatio> WeightRatiosToKG =
+	{
+		// Metric
+		{ EWeightUnit::WU_MET_MG				, { 1, 100000 }				},
+		{ EWeightUnit::WU_MET_CG				, { 1, 10000 }				},
+		{ EWeightUnit::WU_MET_G					, { 1, 1000 }				},
+		{ EWeightUnit::WU_MET_DG				, { 1, 100 }				},
+		{ EWeightUnit::WU_MET_HG				, { 1, 10 }					},
+		{ EWeightUnit::WU_MET_KG				, { 1, 1 }					},
+		{ EWeightUnit::WU_MET_TON				, { 1000, 1 }				},
+		// Imperial US
+		{ EWeightUnit::WU_US_GR					, { 6479891, 100000000000 }	},
+		{ EWeightUnit::WU_US_DR					, { 45359237, 25600000000 }	},
+		{ EWeightUnit::WU_US_OZ					, { 45359237, 1600000000 }	},
+		{ EWeightUnit::WU_US_LB					, { 45359237, 100000000 }	},
+		{ EWeightUnit::WU_US_CWT_S				, { 45359237, 1000000 }		},
+		{ EWeightUnit::WU_US_CWT_L				, { 317514659, 6250000 }	},
+		{ EWeightUnit::WU_US_TON_S				, { 45359237, 50000 }		},
+		{ EWeightUnit::WU_US_TON_L				, { 317514659, 312500 }		},
+		// Imperial British
+		{ EWeightUnit::WU_BRIT_GR				, { 6479891, 100000000000 }	},
+		{ EWeightUnit::WU_BRIT_DR				, { 45359237, 25600000000 }	},
+		{ EWeightUnit::WU_BRIT_OZ				, { 45359237, 1600000000 }	},
+		{ EWeightUnit::WU_BRIT_LB				, { 45359237, 100000000 }	},
+		{ EWeightUnit::WU_BRIT_ST				, { 317514659, 50000000 }	},
+		{ EWeightUnit::WU_BRIT_QR				, { 317514659, 25000000 }	},
+		{ EWeightUnit::WU_BRIT_CWT				, { 317514659, 6250000 }	},
+		{ EWeightUnit::WU_BRIT_TON				, { 317514659, 312500 }		},
+		// Other
+		{ EWeightUnit::WU_BRIT_SLUG				, { 729695147, 50000000 }	},
+	};
+
+	// --- --- VOLUME --- --- //
+
+	static const TMap<EVolumeUnit, FTicTacToeUnitRatio> VolumeRatiosToM3 =
+	{
+		// Metric fluid
+		{ EVolumeUnit::VU_MET_ML				, { 1, 1000000 }			},
+		{ EVolumeUnit::VU_MET_CL				, { 1, 100000 }				},
+		{ EVolumeUnit::VU_MET_DL				, { 1, 10000 }				},
+		{ EVolumeUnit::VU_MET_L					, { 1, 1000 }				},
+		{ EVolumeUnit::VU_MET_DAL				, { 1, 100 }				},
+		{ EVolumeUnit::VU_MET_HL				, { 1, 10 }					},
+		{ EVolumeUnit::VU_MET_KL				, { 1, 1 }					},
+		// Metric
+		{ EVolumeUnit::VU_MET_MM3				, { 1, 1000000000 }			},
+		{ EVolumeUnit::VU_MET_CM3				, { 1, 1000000 }			},
+		{ EVolumeUnit::VU_MET_DM3				, { 1, 1000 }				},
+		{ EVolumeUnit::VU_MET_M3				, { 1, 1 }					},
+		{ EVolumeUnit::VU_MET_DAM3				, { 1000, 1 }				},
+		{ EVolumeUnit::VU_MET_HM3				, { 1000000, 1 }			},
+		{ EVolumeUnit::VU_MET_KM3				, { 1000000000, 1 }			},
+		// Imperial british fluid
+		{ EVolumeUnit::VU_BRIT_FLOZ				, { 14787, 500000000 }		},
+		{ EVolumeUnit::VU_BRIT_GI				, { 59147, 500000000 }		},
+		{ EVolumeUnit::VU_BRIT_PT				, { 59147, 125000000 }		},
+		{ EVolumeUnit::VU_BRIT_QT				, { 454609, 400000000 }		},
+		{ EVolumeUnit::VU_BRIT_GAL				, { 454609, 100000000 }		},
+		// Imperial US fluid
+		{ EVolumeUnit::VU_US_MIN				, { 157725491, 2560000000000000 }	},
+		{ EVolumeUnit::VU_US_FLDR				, { 473176473, 128000000000000 }	},
+		{ EVolumeUnit::VU_US_TSP				, { 157725491, 32000000000000 }	},
+		{ EVolumeUnit::VU_US_TBSP				, { 473176473, 32000000000000 }	},
+		{ EVolumeUnit::VU_US_FLOZ				, { 473176473, 16000000000000 }	},
+		{ EVolumeUnit::VU_US_JIG				, { 1419529419, 32000000000000 }	},
+		{ EVolumeUnit::VU_US_GI					, { 473176473, 4000000000000 }	},
+		{ EVolumeUnit::VU_US_C					, { 473176473, 2000000000000 }	},
+		{ EVolumeUnit::VU_US_PT					, { 4731764773, 10000000000000 }	},
+		{ EVolumeUnit::VU_US_QT					, { 473176473, 500000000000 }	},
+		{ EVolumeUnit::VU_US_POT				, { 473176473, 250000000000 }	},
+		{ EVolumeUnit::VU_US_GAL				, { 473176473, 125000000000 }	},
+		{ EVolumeUnit::VU_US_BBL				, { 29810117799, 250000000000 }	},
+		{ EVolumeUnit::VU_US_OILBBL				, { 9936705933, 62500000000 }	},
+		{ EVolumeUnit::VU_US_HOGSHEAD			, { 29810117799, 125000000000 }	},
+		// Imperial US
+		{ EVolumeUnit::VU_US_IN3				, { 2048383, 125000000000 }	},
+		{ EVolumeUnit::VU_US_FT3				, { 55306341, 1953125000 }	},
+		{ EVolumeUnit::VU_US_YD3				, { 1493271207, 1953125000 }	},
+		{ EVolumeUnit::VU_US_ACREFT				, { 616741, 500 }			},
+	};
+
+	// --- --- AREA --- --- //
+
+	static const TMap<EAreaUnit, FTicTacToeUnitRatio> AreaRatiosToM2 =
+	{
+		// Metric
+		{ EAreaUnit::AU_MET_MM2					, { 1, 1000000 }			},
+		{ EAreaUnit::AU_MET_CM2					, { 1, 10000 }				},
+		{ EAreaUnit::AU_MET_DM2					, { 1, 100 }				},
+		{ EAreaUnit::AU_MET_M2					, { 1, 1 }					},
+		{ EAreaUnit::AU_MET_DAM2				, { 100, 1 }				},
+		{ EAreaUnit::AU_MET_HM2					, { 10000, 1 }				},
+		{ EAreaUnit::AU_MET_HA					, { 1000000, 1 }			},
+		{ EAreaUnit::AU_MET_KM2					, { 100000000, 1 }			},
+		// Imperial US
+		{ EAreaUnit::AU_US_SQIN					, { 16129, 25000000 }		},
+		{ EAreaUnit::AU_US_SQFT					, { 145161, 1562500 }		},
+		{ EAreaUnit::AU_US_SQYD					, { 1306449, 1562500 }		},
+		{ EAreaUnit::AU_US_SQCH					, { 158080329, 390625 }		},
+		{ EAreaUnit::AU_US_ACRE					, { 316160658, 78125 }		},
+		{ EAreaUnit::AU_US_SEC					, { 258999800, 1 }			},
+		{ EAreaUnit::AU_US_TWP					, { 9323993000, 1 }			},
+	};
+
+	// --- --- PRESSURE --- --- //
+
+	static const TMap<EPressureUnit, FTicTacToeUnitRatio> PressureRatiosToPa =
+	{
+		// Metric
+		{ EPressureUnit::PU_MET_MILIPA			, { 1, 1000 }				},
+		{ EPressureUnit::PU_MET_CPA				, { 1, 100 }				},
+		{ EPressureUnit::PU_MET_DPA				, { 1, 10 }					},
+		{ EPressureUnit::PU_MET_PA				, { 1, 1 }					},
+		{ EPressureUnit::PU_MET_DAPA			, { 10, 1 }					},
+		{ EPressureUnit::PU_MET_HPA				, { 100, 1 }				},
+		{ EPressureUnit::PU_MET_KPA				, { 1000, 1 }				},
+		{ EPressureUnit::PU_MET_BAR				, { 100000, 1 }				},
+		{ EPressureUnit::PU_MET_MPA				, { 1000000, 1 }			},
+		{ EPressureUnit::PU_MET_GPA				, { 1000000000, 1 }			},
+		// Imperial (US)
+		{ EPressureUnit::PU_MET_PSI				, { 8896443230521, 1290320000 }	},
+	};
+
+	// --- --- ENERGY --- --- //
+
+	static const TMap<EEnergyUnit, FTicTacToeUnitRatio> EnergyRatiosToJ =
+	{
+		// Joules
+		{ EEnergyUnit::EU_UJ					, { 1, 1000000 }			},
+		{ EEnergyUnit::EU_MILIJ					, { 1, 1000 }				},
+		{ EEnergyUnit::EU_J						, { 1, 1 }					},
+		{ EEnergyUnit::EU_KJ					, { 1000, 1 }				},
+		{ EEnergyUnit::EU_MJ					, { 1000000, 1 }			},
+		// Watt-hour
+		{ EEnergyUnit::EU_WH					, { 3600, 1 }				},
+		{ EEnergyUnit::EU_KWH					, { 3600000, 1 }			},
+		{ EEnergyUnit::EU_MWH					, { 3600000000, 1 }			},
+	};
+
+	// --- --- DATA --- --- //
+
+	// Rates share the layout, see EDataRateUnit
+	static const TMap<EDataSizeUnit, FTicTacToeUnitRatio> DataSizeRatiosToByte =
+	{
+		// Bits
+		{ EDataSizeUnit::DS_BIT					, { 1, 8 }					},
+		{ EDataSizeUnit::DS_KBIT				, { 125, 1 }				},
+		{ EDataSizeUnit::DS_MBIT				, { 125000, 1 }				},
+		{ EDataSizeUnit::DS_GBIT				, { 125000000, 1 }			},
+		{ EDataSizeUnit::DS_TBIT				, { 125000000000, 1 }		},
+		// Bytes, SI
+		{ EDataSizeUnit::DS_BYTE				, { 1, 1 }					},
+		{ EDataSizeUnit::DS_KB					, { 1000, 1 }				},
+		{ EDataSizeUnit::DS_MB					, { 1000000, 1 }			},
+		{ EDataSizeUnit::DS_GB					, { 1000000000, 1 }			},
+		{ EDataSizeUnit::DS_TB					, { 1000000000000, 1 }		},
+		{ EDataSizeUnit::DS_PB					, { 1000000000000000, 1 }	},
+		// Bytes, IEC
+		{ EDataSizeUnit::DS_KIB					, { 1024, 1 }				},
+		{ EDataSizeUnit::DS_MIB					, { 1048576, 1 }			},
+		{ EDataSizeUnit::DS_GIB					, { 1073741824, 1 }			},
+		{ EDataSizeUnit::DS_TIB					, { 1099511627776, 1 }		},
+		{ EDataSizeUnit::DS_PIB					, { 1125899906842624, 1 }	},
+	};
+
+	// --- --- 128-BIT HELPERS --- --- //
+
+	// Portable on purpose: compiler intrinsics differ per platform, plain 64-bit limbs give the same bits everywhere
+	struct FUInt128
+	{
+		uint64 Hi = 0;
+		uint64 Lo = 0;
+	};
+
+	static FUInt128 Multiply(uint64 A, uint64 B)
+	{
+		const uint64 ALo = A & 0xFFFFFFFFull, AHi = A >> 32;
+		const uint64 BLo = B & 0xFFFFFFFFull, BHi = B >> 32;
+
+		const uint64 LoLo = ALo * BLo;
+		const uint64 HiLo = AHi * BLo;
+		const uint64 LoHi = ALo * BHi;
+		const uint64 HiHi = AHi * BHi;
+
+		const uint64 Cross = (LoLo >> 32) + (HiLo & 0xFFFFFFFFull) + LoHi;
+
+		FUInt128 Result;
+		Result.Lo = (Cross << 32) | (LoLo & 0xFFFFFFFFull);
+		Result.Hi = HiHi + (HiLo >> 32) + (Cross >> 32);
+		return Result;
+	}
+
+	// Restoring long division, the quotient must fit in 64 bits (Hi < Divisor)
+	static bool Divide(const FUInt128& Dividend, uint64 Divisor, uint64& OutQuotient, uint64& OutRemainder)
+	{
+		if (Divisor == 0 || Dividend.Hi >= Divisor) return false;
+
+		uint64 Remainder = Dividend.Hi;
+		uint64 Quotient = 0;
+		for (int32 Bit = 63; Bit >= 0; --Bit)
+		{
+			const bool bCarry = (Remainder >> 63) != 0;
+			Remainder = (Remainder << 1) | ((Dividend.Lo >> Bit) & 1);
+			Quotient <<= 1;
+			if (bCarry || Remainder >= Divisor)
+			{
+				Remainder -= Divisor;
+				Quotient |= 1;
+			}
+		}
+
+		OutQuotient = Quotient;
+		OutRemainder = Remainder;
+		return true;
+	}
+
+	static uint64 GreatestCommonDivisor(uint64 A, uint64 B)
+	{
+		while (B != 0)
+		{
+			const uint64 Remainder = A % B;
+			A = B;
+			B = Remainder;
+		}
+		return A;
+	}
+
+	static bool MultiplyToInt64(uint64 A, uint64 B, int64& OutValue)
+	{
+		const FUInt128 Product = Multiply(A, B);
+		if (Product.Hi != 0 || Product.Lo > uint64(MAX_int64)) return false;
+		OutValue = int64(Product.Lo);
+		return true;
+	}
+
+	// (FromNum / FromDen) / (ToNum / ToDen), cross-cancelled so the result is already in lowest terms
+	static bool ComposeRatio(const FTicTacToeUnitRatio& From, const FTicTacToeUnitRatio& To, FTicTacToeUnitRatio& OutRatio)
+	{
+		const uint64 NumeratorGcd = GreatestCommonDivisor(From.Numerator, To.Numerator);
+		const uint64 DenominatorGcd = GreatestCommonDivisor(From.Denominator, To.Denominator);
+
+		FTicTacToeUnitRatio Ratio;
+		if (!MultiplyToInt64(From.Numerator / NumeratorGcd, To.Denominator / DenominatorGcd, Ratio.Numerator)) return false;
+		if (!MultiplyToInt64(From.Denominator / DenominatorGcd, To.Numerator / NumeratorGcd, Ratio.Denominator)) return false;
+
+		OutRatio = Ratio;
+		return true;
+	}
+
+	template<typename UnitType>
+	static bool GetRatio(const TMap<UnitType, FTicTacToeUnitRatio>& Table, UnitType FromUnit, UnitType ToUnit, FTicTacToeUnitRatio& OutRatio)
+	{
+		const FTicTacToeUnitRatio* From = Table.Find(FromUnit);
+		const FTicTacToeUnitRatio* To = Table.Find(ToUnit);
+		if (!From || !To) return false;
+		return ComposeRatio(*From, *To, OutRatio);
+	}
+
+	static bool RoundUp(uint64 Quotient, uint64 Remainder, uint64 Divisor, bool bNegative, ERoundingMode RoundingMode)
+	{
+		if (Remainder == 0) return false;
+
+		// Divisor <= MAX_int64, so twice the remainder cannot wrap
+		const uint64 TwiceRemainder = Remainder << 1;
+		switch (RoundingMode)
+		{
+		case ERoundingMode::HalfToEven:			return TwiceRemainder > Divisor || (TwiceRemainder == Divisor && (Quotient & 1) != 0);
+		case ERoundingMode::HalfFromZero:		return TwiceRemainder >= Divisor;
+		case ERoundingMode::HalfToZero:			return TwiceRemainder > Divisor;
+		case ERoundingMode::FromZero:			return true;
+		case ERoundingMode::ToZero:				return false;
+		case ERoundingMode::ToNegativeInfinity:	return bNegative;
+		case ERoundingMode::ToPositiveInfinity:	return !bNegative;
+		default:								return TwiceRemainder > Divisor || (TwiceRemainder == Divisor && (Quotient & 1) != 0);
+		}
+	}
+}
+
+bool FTicTacToeFixedPoint::GetRatio(ELengthUnit FromUnit, ELengthUnit ToUnit, FTicTacToeUnitRatio& OutRatio)
+{
+	return TicTacToeFixedPoint::GetRatio(TicTacToeFixedPoint::LengthRatiosToM, FromUnit, ToUnit, OutRatio);
+}
+
+bool FTicTacToeFixedPoint::GetRatio(EWeightUnit FromUnit, EWeightUnit ToUnit, FTicTacToeUnitRatio& OutRatio)
+{
+	return TicTacToeFixedPoint::GetRatio(TicTacToeFixedPoint::WeightRatiosToKG, FromUnit, ToUnit, OutRatio);
+}
+
+bool FTicTacToeFixedPoint::GetRatio(EVolumeUnit FromUnit, EVolumeUnit ToUnit, FTicTacToeUnitRatio& OutRatio)
+{
+	return TicTacToeFixedPoint::GetRatio(TicTacToeFixedPoint::VolumeRatiosToM3, FromUnit, ToUnit, OutRatio);
+}
+
+bool FTicTacToeFixedPoint::GetRatio(EAreaUnit FromUnit, EAreaUnit ToUnit, FTicTacToeUnitRatio& OutRatio)
+{
+	return TicTacToeFixedPoint::GetRatio(TicTacToeFixedPoint::AreaRatiosToM2, FromUnit, ToUnit, OutRatio);
+}
+
+bool FTicTacToeFixedPoint::GetRatio(EPressureUnit FromUnit, EPressureUnit ToUnit, FTicTacToeUnitRatio& OutRatio)
+{
+	// Gauge units are offset by one atmosphere, no ratio can convert them
+	if (IsOffsetUnit(FromUnit) || IsOffsetUnit(ToUnit)) return false;
+
+	return TicTacToeFixedPoint::GetRatio(TicTacToeFixedPoint::PressureRatiosToPa, FromUnit, ToUnit, OutRatio);
+}
+
+bool FTicTacToeFixedPoint::GetRatio(EEnergyUnit FromUnit, EEnergyUnit ToUnit, FTicTacToeUnitRatio& OutRatio)
+{
+	return TicTacToeFixedPoint::GetRatio(TicTacToeFixedPoint::EnergyRatiosToJ, FromUnit, ToUnit, OutRatio);
+}
+
+bool FTicTacToeFixedPoint::GetRatio(EDataSizeUnit FromUnit, EDataSizeUnit ToUnit, FTicTacToeUnitRatio& OutRatio)
+{
+	return TicTacToeFixedPoint::GetRatio(TicTacToeFixedPoint::DataSizeRatiosToByte, FromUnit, ToUnit, OutRatio);
+}
+
+bool FTicTacToeFixedPoint::GetRatio(EDataRateUnit FromUnit, EDataRateUnit ToUnit, FTicTacToeUnitRatio& OutRatio)
+{
+	return GetRatio((EDataSizeUnit)FromUnit, (EDataSizeUnit)ToUnit, OutRatio);
+}
+
+bool FTicTacToeFixedPoint::Apply(int64 Value, const FTicTacToeUnitRatio& Ratio, ERoundingMode RoundingMode, int64& OutValue)
+{
+	using namespace TicTacToeFixedPoint;
+
+	if (Ratio.Numerator <= 0 || Ratio.Denominator <= 0) return false;
+
+	// Work on the magnitude so rounding is symmetric and MIN_int64 needs no special case
+	const bool bNegative = Value < 0;
+	const uint64 Magnitude = bNegative ? uint64(0) - uint64(Value) : uint64(Value);
+
+	uint64 Quotient, Remainder;
+	if (!Divide(Multiply(Magnitude, uint64(Ratio.Numerator)), uint64(Ratio.Denominator), Quotient, Remainder)) return false;
+
+	if (RoundUp(Quotient, Remainder, uint64(Ratio.Denominator), bNegative, RoundingMode))
+	{
+		if (Quotient == MAX_uint64) return false;
+		++Quotient;
+	}
+
+	const uint64 Limit = bNegative ? uint64(MAX_int64) + 1 : uint64(MAX_int64);
+	if (Quotient > Limit) return false;
+
+	OutValue = bNegative ? int64(uint64(0) - Quotient) : int64(Quotient);
+	return true;
+}
+
+bool FTicTacToeFixedPoint::Apply(TArrayView<int64> Values, const FTicTacToeUnitRatio& Ratio, ERoundingMode RoundingMode)
+{
+	bool bAllConverted = true;
+	for (int64& Value : Values)
+	{
+		bAllConverted &= Apply(Value, Ratio, RoundingMode, Value);
+	}
+	return bAllConverted;
+}
+
+bool FTicTacToeFixedPoint::ApplyToDouble(int64 Value, const FTicTacToeUnitRatio& Ratio, double& OutValue)
+{
+	using namespace TicTacToeFixedPoint;
+
+	if (Ratio.Numerator <= 0 || Ratio.Denominator <= 0) return false;
+
+	const bool bNegative = Value < 0;
+	const uint64 Magnitude = bNegative ? uint64(0) - uint64(Value) : uint64(Value);
+
+	uint64 Quotient, Remainder;
+	if (!Divide(Multiply(Magnitude, uint64(Ratio.Numerator)), uint64(Ratio.Denominator), Quotient, Remainder)) return false;
+
+	// The whole part is exact up to 2^53, the fraction only rounds once
+	const double Result = double(Quotient) + double(Remainder) / double(Ratio.Denominator);
+	OutValue = bNegative ? -Result : Result;
+	return true;
+}
+
+bool FTicTacToeFixedPoint::ApplyToDecimal(int64 Value, const FTicTacToeUnitRatio& Ratio, int32 FractionalDigits, bool& bOutNegative, uint64& OutWhole, uint64& OutFraction)
+{
+	using namespace TicTacToeFixedPoint;
+
+	if (Ratio.Numerator <= 0 || Ratio.Denominator <= 0 || FractionalDigits < 0 || FractionalDigits > MaxDecimalDigits) return false;
+
+	const bool bNegative = Value < 0;
+	const uint64 Magnitude = bNegative ? uint64(0) - uint64(Value) : uint64(Value);
+
+	uint64 Whole, Remainder;
+	if (!Divide(Multiply(Magnitude, uint64(Ratio.Numerator)), uint64(Ratio.Denominator), Whole, Remainder)) return false;
+
+	uint64 Scale = 1;
+	for (int32 Digit = 0; Digit < FractionalDigits; ++Digit)
+	{
+		Scale *= 10;
+	}
+
+	// Remainder < Denominator, so the fraction is below Scale and the division cannot fail
+	uint64 Fraction, FractionRemainder;
+	Divide(Multiply(Remainder, Scale), uint64(Ratio.Denominator), Fraction, FractionRemainder);
+
+	// A tie goes to the even last digit shown, which is the last digit of the whole part without fractional digits
+	if (RoundUp(FractionalDigits > 0 ? Fraction : Whole, FractionRemainder, uint64(Ratio.Denominator), bNegative, ERoundingMode::HalfToEven) && ++Fraction == Scale)
+	{
+		if (Whole == MAX_uint64) return false;
+		++Whole;
+		Fraction = 0;
+	}
+
+	bOutNegative = bNegative;
+	OutWhole = Whole;
+	OutFraction = Fraction;
+	return true;
+}
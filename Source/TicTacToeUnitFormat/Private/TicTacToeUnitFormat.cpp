@@ -1,20 +1,23 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "TicTacToeUnitFormat.h"
+#include "TicTacToeUnitAffine.h"
+#include "TicTacToeUnitCook.h"
 
 #define LOCTEXT_NAMESPACE "FTicTacToeUnitFormatModule"
 
 void FTicTacToeUnitFormatModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
-	
+	FTicTacToeAffine::Initialize();
+	UTicTacToeUnitCookSettings::Initialize();
 }
 
 void FTicTacToeUnitFormatModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
-	
+	UTicTacToeUnitCookSettings::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -3,65 +3,228 @@
 #include "TicTacToeUnitFormatBPLibrary.h"
 #include "Kismet/KismetTextLibrary.h"
 #include "TicTacToeUnitFormat.h"
+#include "TicTacToeUnitAffine.h"
+#include "TicTacToeUnitFixedPoint.h"
+#include "TicTacToeUnitDisplayStrings.h"
+#include "TicTacToeUnitRaceTimer.h"
+#include "Internationalization/FastDecimalFormat.h"
+#include <atomic>
+
+
+
+namespace Core = TicTacToeUnitCore;
+
+// The core mirrors the UENUMs by value, the module casts between them
+static_assert(int32(EUnitFamily::UF_DATA_RATE) + 1 == int32(Core::EFamily::Count));
+static_assert(int32(ELengthUnit::LU_BRIT_NMI) + 1 == int32(Core::ELength::Count));
+static_assert(int32(EWeightUnit::WU_BRIT_SLUG) + 1 == int32(Core::EWeight::Count));
+static_assert(int32(EVolumeUnit::VU_US_ACREFT) + 1 == int32(Core::EVolume::Count));
+static_assert(int32(EAreaUnit::AU_US_TWP) + 1 == int32(Core::EArea::Count));
+static_assert(int32(ETemperatureUnit::TU_KEL) + 1 == int32(Core::ETemperature::Count));
+static_assert(int32(ETimeUnit::TU_YR) + 1 == int32(Core::ETime::Count));
+static_assert(int32(EPressureUnit::PU_US_PSIG) + 1 == int32(Core::EPressure::Count));
+static_assert(int32(EEnergyUnit::EU_KCAL) + 1 == int32(Core::EEnergy::Count));
+static_assert(int32(EAngleUnit::AU_MIL_SU) + 1 == int32(Core::EAngle::Count));
+static_assert(int32(ENumberNotation::NN_ENGINEERING) + 1 == int32(Core::ENotation::Count));
+static_assert(int32(EPowerUnit::PW_US_HP) + 1 == int32(Core::EPower::Count));
+static_assert(int32(EFlowUnit::FU_US_FT3_MIN) + 1 == int32(Core::EFlow::Count));
+static_assert(int32(EDensityUnit::DU_US_LB_GAL) + 1 == int32(Core::EDensity::Count));
+static_assert(int32(EAccelerationUnit::AC_US_FT_S2) + 1 == int32(Core::EAcceleration::Count));
+static_assert(int32(ETorqueUnit::TQ_US_LBF_FT) + 1 == int32(Core::ETorque::Count));
+static_assert(int32(EDataSizeUnit::DS_PIB) + 1 == int32(Core::EDataSize::Count));
+static_assert(int32(EDataRateUnit::DR_PIB_S) + 1 == int32(Core::EDataRate::Count));
+static_assert(int32(EEngineSpeedUnit::ESU_M_S) + 1 == int32(Core::EEngineSpeed::Count));
+static_assert(int32(EAutoUnitType::AUT_IMP_US_AUTO) == int32(Core::EAutoSystem::ImperialUS));
+static_assert(int32(EAutoPressureUnitType::AUT_MET_AUTO) == int32(Core::EAutoSystem::Metric));
+static_assert(int32(EAutoVolumeUnitType::AUT_IMP_FLUID_AUTO) == int32(Core::EAutoVolume::ImperialFluid));
+static_assert(int32(EAutoEnergyUnitType::AUT_WATTH) == int32(Core::EAutoEnergy::WattHour));
+static_assert(int32(EAutoDataUnitType::AUT_DECIMAL_BITS) == int32(Core::EAutoData::DecimalBits));
+
+// Prefixes a family has metric units for
+static int32 GetMetricPrefixes(EUnitFamily family)
+{
+	return (int32)Core::GetMetricPrefixes((Core::EFamily)family);
+}
+
+// Prefixes the metric auto units pick from, nullptr for families without metric auto units
+static std::atomic<int32>* FindAutoPrefixes(EUnitFamily family)
+{
+	static std::atomic<int32> LengthPrefixes{ (int32)Core::GetDefaultAutoPrefixes(Core::EFamily::Length) };
+	static std::atomic<int32> PressurePrefixes{ (int32)Core::GetDefaultAutoPrefixes(Core::EFamily::Pressure) };
+	static std::atomic<int32> EnergyPrefixes{ (int32)Core::GetDefaultAutoPrefixes(Core::EFamily::Energy) };
+	static std::atomic<int32> PowerPrefixes{ (int32)Core::GetDefaultAutoPrefixes(Core::EFamily::Power) };
 
+	switch (family)
+	{
+	case EUnitFamily::UF_LENGTH:	return &LengthPrefixes;
+	case EUnitFamily::UF_PRESSURE:	return &PressurePrefixes;
+	case EUnitFamily::UF_ENERGY:	return &EnergyPrefixes;
+	case EUnitFamily::UF_POWER:		return &PowerPrefixes;
+	default:						return nullptr;
+	}
+}
 
+// Ladders live in TicTacToeUnitCore
 
 ELengthUnit UTicTacToeUnitFormatBPLibrary::GetAutoLength(double length_meters, EAutoUnitType AutoUnit)
 {
-	switch (AutoUnit)
-	{
-	case EAutoUnitType::AUT_OFF: break;
-	case EAutoUnitType::AUT_MET_AUTO:
-		if (length_meters < 0.01)	return ELengthUnit::LU_MET_MM;
-		if (length_meters < 1.0)	return ELengthUnit::LU_MET_CM;
-		if (length_meters < 1000.0)	return ELengthUnit::LU_MET_M;
-		return ELengthUnit::LU_MET_KM;
-	
-	case EAutoUnitType::AUT_IMP_US_AUTO:
-		if (length_meters < 0.5)	return ELengthUnit::LU_US_INCH;
-		if (length_meters < 2.0)	return ELengthUnit::LU_US_FOOT;
-		if (length_meters < 500)	return ELengthUnit::LU_US_YARD;
-		return ELengthUnit::LU_US_MILE;
-
-	default: return ELengthUnit::LU_MET_M;
-	}
-	return ELengthUnit::LU_MET_M;
+	return (ELengthUnit)Core::GetAutoLength(length_meters, (Core::EAutoSystem)AutoUnit, (uint32)GetAutoUnitPrefixes(EUnitFamily::UF_LENGTH));
 }
 
 EPressureUnit UTicTacToeUnitFormatBPLibrary::GetAutoPressure(double pressure_pascals, EAutoPressureUnitType AutoUnit)
 {
-	if (AutoUnit == EAutoPressureUnitType::AUT_MET_AUTO)
+	return (EPressureUnit)Core::GetAutoPressure(pressure_pascals, (Core::EAutoSystem)AutoUnit, (uint32)GetAutoUnitPrefixes(EUnitFamily::UF_PRESSURE));
+}
+
+EEnergyUnit UTicTacToeUnitFormatBPLibrary::GetAutoEnergy(double energy_joules, EAutoEnergyUnitType AutoUnit)
+{
+	return (EEnergyUnit)Core::GetAutoEnergy(energy_joules, (Core::EAutoEnergy)AutoUnit, (uint32)GetAutoUnitPrefixes(EUnitFamily::UF_ENERGY));
+}
+
+EWeightUnit UTicTacToeUnitFormatBPLibrary::GetAutoWeight(double weight_kg, EAutoUnitType AutoUnit)
+{
+	return (EWeightUnit)Core::GetAutoWeight(weight_kg, (Core::EAutoSystem)AutoUnit);
+}
+
+EVolumeUnit UTicTacToeUnitFormatBPLibrary::GetAutoVolume(double volume_m3, EAutoVolumeUnitType AutoUnit, bool UseExtendedAutoUnits)
+{
+	return (EVolumeUnit)Core::GetAutoVolume(volume_m3, (Core::EAutoVolume)AutoUnit, UseExtendedAutoUnits);
+}
+
+EAreaUnit UTicTacToeUnitFormatBPLibrary::GetAutoArea(double area_m2, EAutoUnitType AutoUnit)
+{
+	return (EAreaUnit)Core::GetAutoArea(area_m2, (Core::EAutoSystem)AutoUnit);
+}
+
+ETimeUnit UTicTacToeUnitFormatBPLibrary::GetAutoTime(double time_s)
+{
+	return (ETimeUnit)Core::GetAutoTime(time_s);
+}
+
+EPowerUnit UTicTacToeUnitFormatBPLibrary::GetAutoPower(double power_watts, EAutoUnitType AutoUnit)
+{
+	return (EPowerUnit)Core::GetAutoPower(power_watts, (Core::EAutoSystem)AutoUnit, (uint32)GetAutoUnitPrefixes(EUnitFamily::UF_POWER));
+}
+
+EFlowUnit UTicTacToeUnitFormatBPLibrary::GetAutoFlow(double flow_m3_s, EAutoUnitType AutoUnit)
+{
+	return (EFlowUnit)Core::GetAutoFlow(flow_m3_s, (Core::EAutoSystem)AutoUnit);
+}
+
+EDensityUnit UTicTacToeUnitFormatBPLibrary::GetAutoDensity(double density_kg_m3, EAutoUnitType AutoUnit)
+{
+	return (EDensityUnit)Core::GetAutoDensity(density_kg_m3, (Core::EAutoSystem)AutoUnit);
+}
+
+EAccelerationUnit UTicTacToeUnitFormatBPLibrary::GetAutoAcceleration(double acceleration_m_s2, EAutoUnitType AutoUnit)
+{
+	return (EAccelerationUnit)Core::GetAutoAcceleration(acceleration_m_s2, (Core::EAutoSystem)AutoUnit);
+}
+
+ETorqueUnit UTicTacToeUnitFormatBPLibrary::GetAutoTorque(double torque_n_m, EAutoUnitType AutoUnit)
+{
+	return (ETorqueUnit)Core::GetAutoTorque(torque_n_m, (Core::EAutoSystem)AutoUnit);
+}
+
+EDataSizeUnit UTicTacToeUnitFormatBPLibrary::GetAutoDataSize(double size_bytes, EAutoDataUnitType AutoUnit, bool UseExtendedAutoUnits)
+{
+	return (EDataSizeUnit)Core::GetAutoDataSize(size_bytes, (Core::EAutoData)AutoUnit, UseExtendedAutoUnits);
+}
+
+EDataRateUnit UTicTacToeUnitFormatBPLibrary::GetAutoDataRate(double rate_bytes_s, EAutoDataUnitType AutoUnit, bool UseExtendedAutoUnits)
+{
+	return (EDataRateUnit)Core::GetAutoDataRate(rate_bytes_s, (Core::EAutoData)AutoUnit, UseExtendedAutoUnits);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatValue(double value, const FText& suffix, int32 suffixSlot, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	if (Notation != ENumberNotation::NN_FIXED && FMath::IsFinite(value))
+		return FormatNotation(value, suffix, suffixSlot, precision, ForceSign, UseGrouping, StableWidth, Notation);
+
+	if (StableWidth <= 0)
 	{
-		if (pressure_pascals < 0.1) return EPressureUnit::PU_MET_MPA;
-		if (pressure_pascals < 1000.0) return EPressureUnit::PU_MET_PA;
-		if (pressure_pascals < 1000000.0) return EPressureUnit::PU_MET_KPA;
-		if (pressure_pascals < 1000000000.0) return EPressureUnit::PU_MET_MPA;
-		return EPressureUnit::PU_MET_GPA;
+		return FText::Format(
+			FText::FromString("{0}{1}"),
+			UKismetTextLibrary::Conv_DoubleToText(value, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
+			suffix
+		);
 	}
-	return EPressureUnit::PU_MET_PA;
+
+	// Fixed fractional digits so 9.9 -> 10.0 only swaps a figure space for a digit.
+	// U+2007 FIGURE SPACE has the width of a digit in fonts with tabular digits.
+	const FText number = UKismetTextLibrary::Conv_DoubleToText(value, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, precision, precision);
+	return PadValue(number, suffix, suffixSlot, StableWidth);
 }
 
-EEnergyUnit UTicTacToeUnitFormatBPLibrary::GetAutoEnergy(double energy_joules, EAutoEnergyUnitType AutoUnit)
+FText UTicTacToeUnitFormatBPLibrary::FormatNotation(double value, const FText& suffix, int32 suffixSlot, int digits, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
-	switch (AutoUnit)
+	// Fractional digits and exponent from the decimal exponent, the text is formatted once
+	const Core::FNotationDigits notation_digits = Core::GetNotationDigits(value, (Core::ENotation)Notation, digits);
+	const double mantissa = Core::GetNotationMantissa(value, notation_digits);
+
+	// Significant trailing zeros are kept, 1.20 km at 3 digits
+	FText number = UKismetTextLibrary::Conv_DoubleToText(mantissa, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, notation_digits.FractionalDigits, notation_digits.FractionalDigits);
+	if (notation_digits.Exponent != 0)
+		number = FText::Format(FText::FromString("{0}{1}"), number, FText::AsCultureInvariant(FString::Printf(TEXT("e%d"), notation_digits.Exponent)));
+
+	if (StableWidth <= 0)
+		return FText::Format(FText::FromString("{0}{1}"), number, suffix);
+
+	return PadValue(number, suffix, suffixSlot, StableWidth);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::PadValue(const FText& number, const FText& suffix, int32 suffixSlot, int StableWidth)
+{
+	const int32 number_padding = FMath::Max(StableWidth - suffixSlot - number.ToString().Len(), 0);
+	const int32 suffix_padding = FMath::Max(suffixSlot - suffix.ToString().Len(), 0);
+
+	return FText::Format(
+		FText::FromString("{0}{1}{2}{3}"),
+		FText::AsCultureInvariant(FString::ChrN(number_padding, TEXT('\u2007'))),
+		number,
+		suffix,
+		FText::AsCultureInvariant(FString::ChrN(suffix_padding, TEXT('\u2007')))
+	);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatDecimal(bool negative, uint64 whole, uint64 fraction, int32 fractionalDigits, int32 minFractionalDigits, bool ForceSign, bool UseGrouping)
+{
+	const FDecimalNumberFormattingRules& rules = FInternationalization::Get().GetCurrentLocale()->GetDecimalNumberFormattingRules();
+
+	// Trailing zeros are dropped down to the minimum, as Conv_DoubleToText does
+	while (fractionalDigits > minFractionalDigits && fraction % 10 == 0)
 	{
-	default: return EEnergyUnit::EU_J;
-		case EAutoEnergyUnitType::AUT_OFF: return EEnergyUnit::EU_J;
-		case EAutoEnergyUnitType::AUT_WATTH:
-		{
-			if (energy_joules < 3600000.0) return EEnergyUnit::EU_WH;
-			if (energy_joules < 3600000000.0) return EEnergyUnit::EU_KWH;
-			return EEnergyUnit::EU_MWH;
-		}
-		case EAutoEnergyUnitType::AUT_JOULES:
+		fraction /= 10;
+		--fractionalDigits;
+	}
+
+	// The whole part as an integer, the culture's grouping and digits without any double conversion
+	FNumberFormattingOptions options;
+	options.SetUseGrouping(UseGrouping);
+
+	// The sign is the source value's as in FastDecimalFormat, a negative that rounds to zero keeps its minus sign
+	FString number = negative ? rules.NegativePrefixString : (ForceSign ? rules.PlusString : rules.PositivePrefixString);
+	number += FastDecimalFormat::NumberToString(whole, rules, options);
+
+	if (fractionalDigits > 0)
+	{
+		TCHAR digits[FTicTacToeFixedPoint::MaxDecimalDigits];
+		for (int32 digit = fractionalDigits - 1; digit >= 0; --digit)
 		{
-			if (energy_joules < 0.001) return EEnergyUnit::EU_UJ;
-			if (energy_joules < 0.01) return EEnergyUnit::EU_MILIJ;
-			if (energy_joules < 1000.0) return EEnergyUnit::EU_J;
-			if (energy_joules < 1000000) return EEnergyUnit::EU_KJ;
-			return EEnergyUnit::EU_MJ;
+			digits[digit] = rules.DigitCharacters[fraction % 10];
+			fraction /= 10;
 		}
+		number.AppendChar(rules.DecimalSeparatorCharacter);
+		number.AppendChars(digits, fractionalDigits);
 	}
+
+	number += negative ? rules.NegativeSuffixString : rules.PositiveSuffixString;
+	return FText::AsCultureInvariant(MoveTemp(number));
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatValue(double value, const FText& suffix, EUnitFamily family, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	return FormatValue(value, suffix, StableWidth > 0 ? GetStableSuffixWidth(family) : 0, precision, ForceSign, UseGrouping, StableWidth, Notation);
 }
 
 double UTicTacToeUnitFormatBPLibrary::ConvertLength(double length, ELengthUnit fromUnit, ELengthUnit toUnit)
@@ -71,24 +234,21 @@ double UTicTacToeUnitFormatBPLibrary::ConvertLength(double length, ELengthUnit f
 	return ( length * LengthConversionsToM[fromUnit] ) / LengthConversionsToM[toUnit];
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatLength(double length, ELengthUnit fromUnit, ELengthUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatLength(double length, ELengthUnit fromUnit, ELengthUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
 	double length_meters = ConvertLength(length, fromUnit, ELengthUnit::LU_MET_M);
 
 	ELengthUnit target_unit = toUnit;
 
-	if (AutoUnit == EAutoUnitType::AUT_MET_AUTO || AutoUnit == EAutoUnitType::AUT_MET_AUTO)
+	if (AutoUnit == EAutoUnitType::AUT_MET_AUTO || AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
 		target_unit = GetAutoLength(length_meters, AutoUnit);
 
-	double length_converted = ConvertLength(length_meters, ELengthUnit::LU_MET_M, toUnit);
+	double length_converted = ConvertLength(length_meters, ELengthUnit::LU_MET_M, target_unit);
 	
-	if ( !LengthUnitDisplayStrings.Contains(target_unit) ) return FText();
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	if (!unit_string) return FText();
 
-	return FText::Format(
-		FText::FromString("{0}{1}"),
-		UKismetTextLibrary::Conv_DoubleToText(length_converted, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
-		LengthUnitDisplayStrings[target_unit]
-	);
+	return FormatValue(length_converted, *unit_string, EUnitFamily::UF_LENGTH, precision, ForceSign, UseGrouping, StableWidth, Notation);
 }
 
 double UTicTacToeUnitFormatBPLibrary::ConvertWeight(double weight, EWeightUnit fromUnit, EWeightUnit toUnit)
@@ -98,7 +258,7 @@ double UTicTacToeUnitFormatBPLibrary::ConvertWeight(double weight, EWeightUnit f
 	return ( weight * WeightConversionToKG[fromUnit] ) / WeightConversionToKG[toUnit];
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatWeight(double weight, EWeightUnit fromUnit, EWeightUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatWeight(double weight, EWeightUnit fromUnit, EWeightUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
 	if (!WeightConversionToKG.Contains(fromUnit)) return FText();
 
@@ -108,54 +268,17 @@ FText UTicTacToeUnitFormatBPLibrary::FormatWeight(double weight, EWeightUnit fro
 	EWeightUnit target_unit = toUnit;
 
 	// Auto unit
-	switch (AutoUnit)
-	{
-	case EAutoUnitType::AUT_OFF: break;
-	case EAutoUnitType::AUT_MET_AUTO:
-		if (weight_kg < 0.001) {
-			target_unit = EWeightUnit::WU_MET_MG;
-			break;
-		}
-		if (weight_kg < 0.1) {
-			target_unit = EWeightUnit::WU_MET_G;
-			break;
-		}
-		if (weight_kg < 1000.0) {
-			target_unit = EWeightUnit::WU_MET_KG;
-			break;
-		}
-		target_unit = EWeightUnit::WU_MET_TON;
-		break;
-	case EAutoUnitType::AUT_IMP_US_AUTO:
-		if (weight_kg < 0.028) {
-			target_unit = EWeightUnit::WU_US_GR;
-			break;
-		}
-		if (weight_kg < 0.5) {
-			target_unit = EWeightUnit::WU_US_OZ;
-			break;
-		}
-		if (weight_kg < 1017) {
-			target_unit = EWeightUnit::WU_US_LB;
-			break;
-		}
-		target_unit = EWeightUnit::WU_US_TON_S;
-		break;
-
-	default: break;
-	}
+	if (AutoUnit == EAutoUnitType::AUT_MET_AUTO || AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+		target_unit = GetAutoWeight(weight_kg, AutoUnit);
 
 	if (!WeightConversionToKG.Contains(target_unit)) return FText();
-	if (!WeightUnitDisplayStrings.Contains(target_unit)) return FText();
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	if (!unit_string) return FText();
 
 	// Convert weight to target unit
 	double weight_converted = ConvertWeight(weight, fromUnit, target_unit);// weight_kg / WeightConversionToKG[target_unit];
 
-	return FText::Format(
-		FText::FromString("{0}{1}"),
-		UKismetTextLibrary::Conv_DoubleToText(weight_converted, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
-		WeightUnitDisplayStrings[target_unit]
-	);
+	return FormatValue(weight_converted, *unit_string, EUnitFamily::UF_WEIGHT, precision, ForceSign, UseGrouping, StableWidth, Notation);
 }
 
 double UTicTacToeUnitFormatBPLibrary::ConvertVolume(double volume, EVolumeUnit fromUnit, EVolumeUnit toUnit)
@@ -166,7 +289,7 @@ double UTicTacToeUnitFormatBPLibrary::ConvertVolume(double volume, EVolumeUnit f
 	return ( volume * VolumeConversionToM3[fromUnit] ) / VolumeConversionToM3[toUnit];
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatVolume(double volume, EVolumeUnit fromUnit, EVolumeUnit toUnit, EAutoVolumeUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatVolume(double volume, EVolumeUnit fromUnit, EVolumeUnit toUnit, EAutoVolumeUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
 	if (!VolumeConversionToM3.Contains(fromUnit)) return FText();
 
@@ -176,58 +299,17 @@ FText UTicTacToeUnitFormatBPLibrary::FormatVolume(double volume, EVolumeUnit fro
 	EVolumeUnit target_unit = toUnit;
 
 	// Auto unit
-	switch (AutoUnit)
-	{
-	case EAutoVolumeUnitType::AUT_OFF: break;
-	case EAutoVolumeUnitType::AUT_MET_AUTO:
-		if (volume_m3 < 0.0001) {
-			target_unit = EVolumeUnit::VU_MET_MM3;
-			break;
-		}
-		if (volume_m3 < 0.1) {
-			target_unit = EVolumeUnit::VU_MET_CM3;
-			break;
-		}
-		if (volume_m3 < 1000000) {
-			target_unit = EVolumeUnit::VU_MET_M3;
-			break;
-		}
-		if (volume_m3 < 1000000000.0 && UseExtendedAutoUnits ) {
-			target_unit = EVolumeUnit::VU_MET_HM3;
-			break;
-		}
-		target_unit = EVolumeUnit::VU_MET_KM3;
-		break;
-	case EAutoVolumeUnitType::AUT_IMP_AUTO:
-		if (volume_m3 < 0.001) {
-			target_unit = EVolumeUnit::VU_US_IN3;
-			break;
-		}
-		if (volume_m3 < 0.5) {
-			target_unit = EVolumeUnit::VU_US_FT3;
-			break;
-		}
-		if (volume_m3 < 2000) {
-			target_unit = EVolumeUnit::VU_US_YD3;
-			break;
-		}
-		target_unit = EVolumeUnit::VU_US_ACREFT;
-		break;
-
-	default: break;
-	}
+	if (AutoUnit == EAutoVolumeUnitType::AUT_MET_AUTO || AutoUnit == EAutoVolumeUnitType::AUT_IMP_AUTO)
+		target_unit = GetAutoVolume(volume_m3, AutoUnit, UseExtendedAutoUnits);
 
 	if (!VolumeConversionToM3.Contains(target_unit)) return FText();
-	if (!VolumeUnitDisplayStrings.Contains(target_unit)) return FText();
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	if (!unit_string) return FText();
 
 	// Convert meters to target unit
 	double volume_converted = volume_m3 / VolumeConversionToM3[target_unit];
 
-	return FText::Format(
-		FText::FromString("{0}{1}"),
-		UKismetTextLibrary::Conv_DoubleToText(volume_converted, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
-		VolumeUnitDisplayStrings[target_unit]
-	);
+	return FormatValue(volume_converted, *unit_string, EUnitFamily::UF_VOLUME, precision, ForceSign, UseGrouping, StableWidth, Notation);
 }
 
 double UTicTacToeUnitFormatBPLibrary::ConvertArea(double volume, EAreaUnit fromUnit, EAreaUnit toUnit)
@@ -237,7 +319,7 @@ double UTicTacToeUnitFormatBPLibrary::ConvertArea(double volume, EAreaUnit fromU
 	return ( volume * AreaConversionToM2[fromUnit] ) / AreaConversionToM2[toUnit];
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatArea(double volume, EAreaUnit fromUnit, EAreaUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatArea(double volume, EAreaUnit fromUnit, EAreaUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
 	if (!AreaConversionToM2.Contains(fromUnit)) return FText();
 
@@ -247,96 +329,31 @@ FText UTicTacToeUnitFormatBPLibrary::FormatArea(double volume, EAreaUnit fromUni
 	EAreaUnit target_unit = toUnit;
 
 	// Auto unit
-	switch (AutoUnit)
-	{
-	case EAutoUnitType::AUT_OFF: break;
-	case EAutoUnitType::AUT_MET_AUTO:
-		if (area_m2 < 0.0001) {
-			target_unit = EAreaUnit::AU_MET_MM2;
-			break;
-		}
-		if (area_m2 < 0.1) {
-			target_unit = EAreaUnit::AU_MET_CM2;
-			break;
-		}
-		if (area_m2 < 10000.0) {
-			target_unit = EAreaUnit::AU_MET_M2;
-			break;
-		}
-		if (area_m2 < 100000000.0) {
-			target_unit = EAreaUnit::AU_MET_HA;
-			break;
-		}
-		target_unit = EAreaUnit::AU_MET_KM2;
-		break;
-	case EAutoUnitType::AUT_IMP_US_AUTO:
-		if (area_m2 < 0.01) {
-			target_unit = EAreaUnit::AU_US_SQIN;
-			break;
-		}
-		if (area_m2 < 0.1) {
-			target_unit = EAreaUnit::AU_US_SQFT;
-			break;
-		}
-		if (area_m2 < 4000) {
-			target_unit = EAreaUnit::AU_US_SQYD;
-			break;
-		}
-		target_unit = EAreaUnit::AU_US_ACRE;
-		break;
-
-	default: break;
-	}
+	if (AutoUnit == EAutoUnitType::AUT_MET_AUTO || AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+		target_unit = GetAutoArea(area_m2, AutoUnit);
 
 	if (!AreaConversionToM2.Contains(target_unit)) return FText();
-	if (!AreaUnitDisplayStrings.Contains(target_unit)) return FText();
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	if (!unit_string) return FText();
 
 	// Convert meters to target unit
 	double area_converted = area_m2 / AreaConversionToM2[target_unit];
 
-	return FText::Format(
-		FText::FromString("{0}{1}"),
-		UKismetTextLibrary::Conv_DoubleToText(area_converted, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
-		AreaUnitDisplayStrings[target_unit]
-	);
+	return FormatValue(area_converted, *unit_string, EUnitFamily::UF_AREA, precision, ForceSign, UseGrouping, StableWidth, Notation);
 }
 
 double UTicTacToeUnitFormatBPLibrary::ConvertTemperature(double temperature, ETemperatureUnit fromUnit, ETemperatureUnit toUnit)
 {
-	double temp_k = 0.0;
-	switch (fromUnit)
-	{
-		case ETemperatureUnit::TU_CEL:
-			temp_k = temperature + 273.15;
-			break;
-		case ETemperatureUnit::TU_KEL:
-			temp_k = temperature;
-			break;
-		case ETemperatureUnit::TU_FAR:
-			temp_k = (temperature - 32.0) * 0.5555555555555 + 273.15;
-	}
-	switch (toUnit)
-	{
-		case ETemperatureUnit::TU_CEL:
-			return temperature - 273.15;
-		case ETemperatureUnit::TU_KEL:
-			return temperature;
-		case ETemperatureUnit::TU_FAR:
-			return (temperature - 273.15) * 0.5555555555555 + 32;
-		default:
-			return 0.0;
-	}
+	const FTicTacToeAffineTransform* transform = FTicTacToeAffine::Find(fromUnit, toUnit);
+	return transform ? transform->Apply(temperature) : 0.0;
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatTemperature(double temperature, ETemperatureUnit fromUnit, ETemperatureUnit toUnit, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatTemperature(double temperature, ETemperatureUnit fromUnit, ETemperatureUnit toUnit, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
-	if (!TemperatureUnitDisplayStrings.Contains(toUnit)) return FText();
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(toUnit);
+	if (!unit_string) return FText();
 	double temp_converted = ConvertTemperature(temperature, fromUnit, toUnit);
-	return FText::Format(
-		FText::FromString("{0}{1}"),
-		UKismetTextLibrary::Conv_DoubleToText(temp_converted, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
-		TemperatureUnitDisplayStrings[toUnit]
-	);
+	return FormatValue(temp_converted, *unit_string, EUnitFamily::UF_TEMPERATURE, precision, ForceSign, UseGrouping, StableWidth, Notation);
 }
 
 double UTicTacToeUnitFormatBPLibrary::ConvertTime(double time, ETimeUnit fromUnit, ETimeUnit toUnit)
@@ -346,7 +363,7 @@ double UTicTacToeUnitFormatBPLibrary::ConvertTime(double time, ETimeUnit fromUni
 	return (time * TimeConversionToS[fromUnit]) / TimeConversionToS[toUnit];
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatTime(double volume, ETimeUnit fromUnit, ETimeUnit toUnit, bool AutoUnit, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatTime(double volume, ETimeUnit fromUnit, ETimeUnit toUnit, bool AutoUnit, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
 	if (!TimeConversionToS.Contains(fromUnit)) return FText();
 
@@ -357,68 +374,54 @@ FText UTicTacToeUnitFormatBPLibrary::FormatTime(double volume, ETimeUnit fromUni
 
 	// Auto unit
 	if (AutoUnit)
-	{
-		if (time_s < 60.0)
-			target_unit = ETimeUnit::TU_SEC;
-		else if (time_s < 3600.0)
-			target_unit = ETimeUnit::TU_MIN;
-		else if (time_s < 86400.0)
-			target_unit = ETimeUnit::TU_HR;
-		else if (time_s < 2592000.0)
-			target_unit = ETimeUnit::TU_MO;
-		else
-			target_unit = ETimeUnit::TU_YR;
-	}
+		target_unit = GetAutoTime(time_s);
 
 	if (!TimeConversionToS.Contains(target_unit)) return FText();
-	if (!TimeUnitDisplayStrings.Contains(target_unit)) return FText();
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	if (!unit_string) return FText();
 
 	// Convert meters to target unit
 	double time_converted = time_s / TimeConversionToS[target_unit];
 
-	return FText::Format(
-		FText::FromString("{0}{1}"),
-		UKismetTextLibrary::Conv_DoubleToText(time_converted, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
-		TimeUnitDisplayStrings[target_unit]
-	);
+	return FormatValue(time_converted, *unit_string, EUnitFamily::UF_TIME, precision, ForceSign, UseGrouping, StableWidth, Notation);
 }
 
 double UTicTacToeUnitFormatBPLibrary::ConvertSpeed(double speed, ELengthUnit fromLengthUnit, ELengthUnit toLengthUnit, ETimeUnit fromTimeUnit, ETimeUnit toTimeUnit)
 {
-	return ConvertLength(speed, fromLengthUnit, toLengthUnit) / ConvertTime(1.0, fromTimeUnit, toTimeUnit);
+	// Length pair over the reversed time pair, both from the cached unit pair tables
+	const FTicTacToeAffineTransform* length = FTicTacToeAffine::Find(EUnitFamily::UF_LENGTH, (uint8)fromLengthUnit, (uint8)toLengthUnit);
+	const FTicTacToeAffineTransform* time = FTicTacToeAffine::Find(EUnitFamily::UF_TIME, (uint8)toTimeUnit, (uint8)fromTimeUnit);
+	if (!length || !time) return 0.0;
+
+	return (speed * length->Numerator * time->Numerator) / (length->Denominator * time->Denominator);
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatSpeed(double speed, ELengthUnit fromLengthUnit, ELengthUnit toLengthUnit, ETimeUnit fromTimeUnit, ETimeUnit toTimeUnit, EAutoUnitType AutoLengthUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatSpeed(double speed, ELengthUnit fromLengthUnit, ELengthUnit toLengthUnit, ETimeUnit fromTimeUnit, ETimeUnit toTimeUnit, EAutoUnitType AutoLengthUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
-	ELengthUnit target_unit = toLengthUnit;
-	
-
-	// Convert to m/time, determine best unit, then convert to that unit
-	if (AutoLengthUnit == EAutoUnitType::AUT_MET_AUTO || AutoLengthUnit == EAutoUnitType::AUT_IMP_US_AUTO) {
-		target_unit = GetAutoLength(ConvertSpeed(speed, fromLengthUnit, ELengthUnit::LU_MET_M, fromTimeUnit, toTimeUnit), AutoLengthUnit);
-	}
+	// Convert to m/time, determine best unit, then convert to that unit. GetDisplayUnit as in the readout, so both pick
+	// the same unit for the same AutoLengthUnit and UseExtendedAutoUnits
+	const double speed_meters = ConvertSpeed(speed, fromLengthUnit, ELengthUnit::LU_MET_M, fromTimeUnit, toTimeUnit);
+	const ELengthUnit target_unit = (ELengthUnit)GetDisplayUnit(speed_meters, EUnitFamily::UF_LENGTH, (uint8)ELengthUnit::LU_MET_M, (uint8)toLengthUnit, (uint8)AutoLengthUnit, UseExtendedAutoUnits);
 
 	double speed_converted = ConvertSpeed(speed, fromLengthUnit, target_unit, fromTimeUnit, toTimeUnit);
 	
-	if (!LengthUnitDisplayStrings.Contains(target_unit)) return FText();
-	if (!TimeUnitDisplayStrings.Contains(toTimeUnit)) return FText();
+	const FText* length_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	const FText* time_string = FTicTacToeUnitDisplayStrings::Find(toTimeUnit);
+	if (!length_string || !time_string) return FText();
 
-	return FText::Format(
-		FText::FromString("{0}{1}/{2}"),
-		UKismetTextLibrary::Conv_DoubleToText(speed_converted, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
-		LengthUnitDisplayStrings[target_unit],
-		TimeUnitDisplayStrings[toTimeUnit]
-	);
+	const int32 suffix_slot = StableWidth > 0 ? GetStableSuffixWidth(EUnitFamily::UF_LENGTH) + 1 + GetStableSuffixWidth(EUnitFamily::UF_TIME) : 0;
+
+	return FormatValue(speed_converted, FText::Format(FText::FromString("{0}/{1}"), *length_string, *time_string), suffix_slot, precision, ForceSign, UseGrouping, StableWidth, Notation);
 }
 
 double UTicTacToeUnitFormatBPLibrary::ConvertPressure(double pressure, EPressureUnit fromUnit, EPressureUnit toUnit)
 {
-	if (!PressureConversionToPa.Contains(fromUnit)) return 0.0;
-	if (!PressureConversionToPa.Contains(toUnit)) return 0.0;
-	return (pressure * PressureConversionToPa[fromUnit]) / PressureConversionToPa[toUnit];
+	// Gauge units are offset from absolute ones
+	const FTicTacToeAffineTransform* transform = FTicTacToeAffine::Find(fromUnit, toUnit);
+	return transform ? transform->Apply(pressure) : 0.0;
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatPressure(double pressure, EPressureUnit fromUnit, EPressureUnit toUnit, EAutoPressureUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatPressure(double pressure, EPressureUnit fromUnit, EPressureUnit toUnit, EAutoPressureUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
 	EPressureUnit target_unit = toUnit;
 
@@ -429,13 +432,10 @@ FText UTicTacToeUnitFormatBPLibrary::FormatPressure(double pressure, EPressureUn
 
 	double pressure_converted = ConvertPressure(pressure, fromUnit, target_unit);
 
-	if (!PressureUnitDisplayStrings.Contains(target_unit)) return FText();
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	if (!unit_string) return FText();
 
-	return FText::Format(
-		FText::FromString("{0}{1}"),
-		UKismetTextLibrary::Conv_DoubleToText(pressure_converted, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
-		PressureUnitDisplayStrings[target_unit]
-	);
+	return FormatValue(pressure_converted, *unit_string, EUnitFamily::UF_PRESSURE, precision, ForceSign, UseGrouping, StableWidth, Notation);
 }
 
 double UTicTacToeUnitFormatBPLibrary::ConvertEnergy(double energy, EEnergyUnit fromUnit, EEnergyUnit toUnit)
@@ -445,7 +445,7 @@ double UTicTacToeUnitFormatBPLibrary::ConvertEnergy(double energy, EEnergyUnit f
 	return (energy * EnergyConversionToJ[fromUnit]) / EnergyConversionToJ[toUnit];
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatEnergy(double energy, EEnergyUnit fromUnit, EEnergyUnit toUnit, EAutoEnergyUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatEnergy(double energy, EEnergyUnit fromUnit, EEnergyUnit toUnit, EAutoEnergyUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
 	EEnergyUnit target_unit = toUnit;
 
@@ -456,13 +456,10 @@ FText UTicTacToeUnitFormatBPLibrary::FormatEnergy(double energy, EEnergyUnit fro
 
 	double energy_converted = ConvertEnergy(energy, fromUnit, target_unit);
 
-	if (!EnergyUnitDisplayStrings.Contains(target_unit)) return FText();
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	if (!unit_string) return FText();
 
-	return FText::Format(
-		FText::FromString("{0}{1}"),
-		UKismetTextLibrary::Conv_DoubleToText(energy_converted, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
-		EnergyUnitDisplayStrings[target_unit]
-	);
+	return FormatValue(energy_converted, *unit_string, EUnitFamily::UF_ENERGY, precision, ForceSign, UseGrouping, StableWidth, Notation);
 }
 
 double UTicTacToeUnitFormatBPLibrary::ConvertAngle(double angle, EAngleUnit fromUnit, EAngleUnit toUnit)
@@ -472,24 +469,761 @@ double UTicTacToeUnitFormatBPLibrary::ConvertAngle(double angle, EAngleUnit from
 	return (angle * AngleConversionToDeg[fromUnit]) / AngleConversionToDeg[toUnit];
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatAngle(double angle, EAngleUnit fromUnit, EAngleUnit toUnit, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatAngle(double angle, EAngleUnit fromUnit, EAngleUnit toUnit, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
 	double angle_converted = ConvertAngle(angle, fromUnit, toUnit);
 
-	if (!AngleUnitDisplayStrings.Contains(toUnit)) return FText();
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(toUnit);
+	if (!unit_string) return FText();
 
-	return FText::Format(
-		FText::FromString("{0}{1}"),
-		UKismetTextLibrary::Conv_DoubleToText(angle_converted, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, 0, precision),
-		AngleUnitDisplayStrings[toUnit]
-	);
+	return FormatValue(angle_converted, *unit_string, EUnitFamily::UF_ANGLE, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatDerived(double value, EUnitFamily family, uint8 fromUnit, uint8 toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	const uint8 target_unit = GetDisplayUnit(value, family, fromUnit, toUnit, (uint8)AutoUnit, UseExtendedAutoUnits);
+
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(family, target_unit);
+	if (!unit_string) return FText();
+
+	return FormatValue(ConvertUnit(value, family, fromUnit, target_unit), *unit_string, family, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+double UTicTacToeUnitFormatBPLibrary::ConvertPower(double power, EPowerUnit fromUnit, EPowerUnit toUnit)
+{
+	const FTicTacToeAffineTransform* transform = FTicTacToeAffine::Find(fromUnit, toUnit);
+	return transform ? transform->Apply(power) : 0.0;
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatPower(double power, EPowerUnit fromUnit, EPowerUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	return FormatDerived(power, EUnitFamily::UF_POWER, (uint8)fromUnit, (uint8)toUnit, AutoUnit, UseExtendedAutoUnits, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+double UTicTacToeUnitFormatBPLibrary::ConvertFlow(double flow, EFlowUnit fromUnit, EFlowUnit toUnit)
+{
+	const FTicTacToeAffineTransform* transform = FTicTacToeAffine::Find(fromUnit, toUnit);
+	return transform ? transform->Apply(flow) : 0.0;
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatFlow(double flow, EFlowUnit fromUnit, EFlowUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	return FormatDerived(flow, EUnitFamily::UF_FLOW, (uint8)fromUnit, (uint8)toUnit, AutoUnit, UseExtendedAutoUnits, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+double UTicTacToeUnitFormatBPLibrary::ConvertDensity(double density, EDensityUnit fromUnit, EDensityUnit toUnit)
+{
+	const FTicTacToeAffineTransform* transform = FTicTacToeAffine::Find(fromUnit, toUnit);
+	return transform ? transform->Apply(density) : 0.0;
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatDensity(double density, EDensityUnit fromUnit, EDensityUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	return FormatDerived(density, EUnitFamily::UF_DENSITY, (uint8)fromUnit, (uint8)toUnit, AutoUnit, UseExtendedAutoUnits, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+double UTicTacToeUnitFormatBPLibrary::ConvertAcceleration(double acceleration, EAccelerationUnit fromUnit, EAccelerationUnit toUnit)
+{
+	const FTicTacToeAffineTransform* transform = FTicTacToeAffine::Find(fromUnit, toUnit);
+	return transform ? transform->Apply(acceleration) : 0.0;
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatAcceleration(double acceleration, EAccelerationUnit fromUnit, EAccelerationUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	return FormatDerived(acceleration, EUnitFamily::UF_ACCELERATION, (uint8)fromUnit, (uint8)toUnit, AutoUnit, UseExtendedAutoUnits, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+double UTicTacToeUnitFormatBPLibrary::ConvertTorque(double torque, ETorqueUnit fromUnit, ETorqueUnit toUnit)
+{
+	const FTicTacToeAffineTransform* transform = FTicTacToeAffine::Find(fromUnit, toUnit);
+	return transform ? transform->Apply(torque) : 0.0;
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatTorque(double torque, ETorqueUnit fromUnit, ETorqueUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	return FormatDerived(torque, EUnitFamily::UF_TORQUE, (uint8)fromUnit, (uint8)toUnit, AutoUnit, UseExtendedAutoUnits, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+double UTicTacToeUnitFormatBPLibrary::ConvertDataSize(double size, EDataSizeUnit fromUnit, EDataSizeUnit toUnit)
+{
+	if (!DataSizeConversionToByte.Contains(toUnit)) return 0.0;
+	if (!DataSizeConversionToByte.Contains(fromUnit)) return 0.0;
+	return (size * DataSizeConversionToByte[fromUnit]) / DataSizeConversionToByte[toUnit];
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatDataSize(double size, EDataSizeUnit fromUnit, EDataSizeUnit toUnit, EAutoDataUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	EDataSizeUnit target_unit = toUnit;
+
+	if (AutoUnit != EAutoDataUnitType::AUT_OFF) {
+		double size_bytes = ConvertDataSize(size, fromUnit, EDataSizeUnit::DS_BYTE);
+		target_unit = GetAutoDataSize(size_bytes, AutoUnit, UseExtendedAutoUnits);
+	}
+
+	double size_converted = ConvertDataSize(size, fromUnit, target_unit);
+
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	if (!unit_string) return FText();
+
+	return FormatValue(size_converted, *unit_string, EUnitFamily::UF_DATA_SIZE, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatDataSizeInt64(int64 size, EDataSizeUnit fromUnit, EDataSizeUnit toUnit, EAutoDataUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	return FormatDataInt64(size, EUnitFamily::UF_DATA_SIZE, (uint8)fromUnit, (uint8)toUnit, AutoUnit, UseExtendedAutoUnits, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+double UTicTacToeUnitFormatBPLibrary::ConvertDataRate(double rate, EDataRateUnit fromUnit, EDataRateUnit toUnit)
+{
+	if (!DataRateConversionToByteS.Contains(toUnit)) return 0.0;
+	if (!DataRateConversionToByteS.Contains(fromUnit)) return 0.0;
+	return (rate * DataRateConversionToByteS[fromUnit]) / DataRateConversionToByteS[toUnit];
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatDataRate(double rate, EDataRateUnit fromUnit, EDataRateUnit toUnit, EAutoDataUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	EDataRateUnit target_unit = toUnit;
+
+	if (AutoUnit != EAutoDataUnitType::AUT_OFF) {
+		double rate_bytes_s = ConvertDataRate(rate, fromUnit, EDataRateUnit::DR_BYTE_S);
+		target_unit = GetAutoDataRate(rate_bytes_s, AutoUnit, UseExtendedAutoUnits);
+	}
+
+	double rate_converted = ConvertDataRate(rate, fromUnit, target_unit);
+
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	if (!unit_string) return FText();
+
+	return FormatValue(rate_converted, *unit_string, EUnitFamily::UF_DATA_RATE, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatDataRateInt64(int64 rate, EDataRateUnit fromUnit, EDataRateUnit toUnit, EAutoDataUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	return FormatDataInt64(rate, EUnitFamily::UF_DATA_RATE, (uint8)fromUnit, (uint8)toUnit, AutoUnit, UseExtendedAutoUnits, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatDataInt64(int64 value, EUnitFamily family, uint8 fromUnit, uint8 toUnit, EAutoDataUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	uint8 target_unit = toUnit;
+
+	// The auto unit comes from the whole byte count, a count too large for int64 bytes gets the largest unit
+	FTicTacToeUnitRatio ratio;
+	if (AutoUnit != EAutoDataUnitType::AUT_OFF && FTicTacToeFixedPoint::GetRatio((EDataSizeUnit)fromUnit, EDataSizeUnit::DS_BYTE, ratio))
+	{
+		int64 value_bytes;
+		const uint64 abs_bytes = FTicTacToeFixedPoint::Apply(value, ratio, ERoundingMode::ToZero, value_bytes)
+			? (value_bytes < 0 ? uint64(0) - uint64(value_bytes) : uint64(value_bytes))
+			: MAX_uint64;
+		target_unit = (uint8)Core::GetAutoDataSize((uint64_t)abs_bytes, (Core::EAutoData)AutoUnit, UseExtendedAutoUnits);
+	}
+
+	if (!FTicTacToeFixedPoint::GetRatio((EDataSizeUnit)fromUnit, (EDataSizeUnit)target_unit, ratio)) return FText();
+
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(family, target_unit);
+	if (!unit_string) return FText();
+
+	// Fixed digits come straight from the exact quotient and remainder, a double would round the whole part past 2^53
+	bool negative;
+	uint64 whole, fraction;
+	const int32 fractional_digits = FMath::Clamp(precision, 0, FTicTacToeFixedPoint::MaxDecimalDigits);
+	if (Notation == ENumberNotation::NN_FIXED && FTicTacToeFixedPoint::ApplyToDecimal(value, ratio, fractional_digits, negative, whole, fraction))
+	{
+		const FText number = FormatDecimal(negative, whole, fraction, fractional_digits, StableWidth > 0 ? fractional_digits : 0, ForceSign, UseGrouping);
+		if (StableWidth <= 0)
+			return FText::Format(FText::FromString("{0}{1}"), number, *unit_string);
+
+		return PadValue(number, *unit_string, GetStableSuffixWidth(family), StableWidth);
+	}
+
+	double value_converted;
+	if (!FTicTacToeFixedPoint::ApplyToDouble(value, ratio, value_converted)) value_converted = ConvertUnit((double)value, family, fromUnit, target_unit);
+
+	return FormatValue(value_converted, *unit_string, family, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+double UTicTacToeUnitFormatBPLibrary::ConvertEngineSpeed(double speed, EEngineSpeedUnit toUnit)
+{
+	return Core::ConvertEngineSpeed(speed, (Core::EEngineSpeed)toUnit);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatEngineSpeed(double speed, EEngineSpeedUnit toUnit, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(toUnit);
+	if (!unit_string) return FText();
+
+	const int32 suffix_slot = StableWidth > 0 ? FTicTacToeUnitDisplayStrings::GetMaxEngineSpeedLength() : 0;
+	return FormatValue(Core::ConvertEngineSpeed(speed, (Core::EEngineSpeed)toUnit), *unit_string, suffix_slot, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatEngineVelocity(const FVector& velocity, EEngineSpeedUnit toUnit, bool IgnoreVertical, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	return FormatEngineSpeed(IgnoreVertical ? velocity.Size2D() : velocity.Size(), toUnit, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+bool UTicTacToeUnitFormatBPLibrary::GetEngineSpeedUnit(ELengthUnit lengthUnit, ETimeUnit timeUnit, EEngineSpeedUnit& engineSpeedUnit)
+{
+	if (timeUnit == ETimeUnit::TU_SEC && lengthUnit == ELengthUnit::LU_MET_M)
+	{
+		engineSpeedUnit = EEngineSpeedUnit::ESU_M_S;
+		return true;
+	}
+	if (timeUnit != ETimeUnit::TU_HR) return false;
+
+	switch (lengthUnit)
+	{
+	case ELengthUnit::LU_MET_KM:	engineSpeedUnit = EEngineSpeedUnit::ESU_KM_H; return true;
+	case ELengthUnit::LU_US_MILE:
+	case ELengthUnit::LU_BRIT_MI:	engineSpeedUnit = EEngineSpeedUnit::ESU_MI_H; return true;
+	case ELengthUnit::LU_BRIT_NMI:	engineSpeedUnit = EEngineSpeedUnit::ESU_KN; return true;
+	default:						return false;
+	}
 }
 
-FText UTicTacToeUnitFormatBPLibrary::FormatPercentage(double percentage, int precision, bool ForceSign, bool UseGrouping)
+FText UTicTacToeUnitFormatBPLibrary::FormatPercentage(double percentage, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
 {
+	if (StableWidth > 0 || Notation != ENumberNotation::NN_FIXED)
+		return FormatValue(percentage * 100.0, FText::AsCultureInvariant(TEXT("%")), 1, precision, ForceSign, UseGrouping, StableWidth, Notation);
+
 	return FText::Format(
 		FText::FromString("{0}%"),
 		UKismetTextLibrary::Conv_DoubleToText(percentage * 100.0, ERoundingMode::HalfToEven, ForceSign, UseGrouping, 1, 324, precision)
 	);
 }
 
+// (value * multiplier) / divisor on all three components at once, same operation order as the scalar Convert* functions
+static FORCEINLINE VectorRegister4Double ScaleVector3(const double* components, double multiplier, double divisor)
+{
+	const VectorRegister4Double value = VectorLoadFloat3_W0(components);
+	return VectorDivide(VectorMultiply(value, VectorSetFloat1(multiplier)), VectorSetFloat1(divisor));
+}
+
+FVector UTicTacToeUnitFormatBPLibrary::ConvertLengthVector(const FVector& length, ELengthUnit fromUnit, ELengthUnit toUnit)
+{
+	if (!LengthConversionsToM.Contains(fromUnit)) return FVector::ZeroVector;
+	if (!LengthConversionsToM.Contains(toUnit)) return FVector::ZeroVector;
+
+	FVector length_converted;
+	VectorStoreFloat3(ScaleVector3(&length.X, LengthConversionsToM[fromUnit], LengthConversionsToM[toUnit]), &length_converted.X);
+	return length_converted;
+}
+
+FVector UTicTacToeUnitFormatBPLibrary::ConvertSpeedVector(const FVector& speed, ELengthUnit fromLengthUnit, ELengthUnit toLengthUnit, ETimeUnit fromTimeUnit, ETimeUnit toTimeUnit)
+{
+	if (!LengthConversionsToM.Contains(fromLengthUnit)) return FVector::ZeroVector;
+	if (!LengthConversionsToM.Contains(toLengthUnit)) return FVector::ZeroVector;
+
+	// Fold the time ratio into the divisor so the whole conversion stays a single multiply/divide
+	const double time_ratio = ConvertTime(1.0, fromTimeUnit, toTimeUnit);
+	if (time_ratio == 0.0) return FVector::ZeroVector;
+
+	FVector speed_converted;
+	VectorStoreFloat3(ScaleVector3(&speed.X, LengthConversionsToM[fromLengthUnit], LengthConversionsToM[toLengthUnit] * time_ratio), &speed_converted.X);
+	return speed_converted;
+}
+
+FRotator UTicTacToeUnitFormatBPLibrary::ConvertAngleRotator(const FRotator& angle, EAngleUnit fromUnit, EAngleUnit toUnit)
+{
+	if (!AngleConversionToDeg.Contains(toUnit)) return FRotator::ZeroRotator;
+	if (!AngleConversionToDeg.Contains(fromUnit)) return FRotator::ZeroRotator;
+
+	// Pitch, Yaw and Roll are laid out contiguously like X, Y and Z
+	FRotator angle_converted;
+	VectorStoreFloat3(ScaleVector3(&angle.Pitch, AngleConversionToDeg[fromUnit], AngleConversionToDeg[toUnit]), &angle_converted.Pitch);
+	return angle_converted;
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatVector(const FVector& length, ELengthUnit fromUnit, ELengthUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	ELengthUnit target_unit = toUnit;
+
+	// One unit for the whole vector, picked from its largest component
+	if (AutoUnit == EAutoUnitType::AUT_MET_AUTO || AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+		target_unit = GetAutoLength(ConvertLengthVector(length, fromUnit, ELengthUnit::LU_MET_M).GetAbsMax(), AutoUnit);
+
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(target_unit);
+	if (!unit_string) return FText();
+
+	const FVector length_converted = ConvertLengthVector(length, fromUnit, target_unit);
+
+	// Each component as FormatLength prints it, StableWidth pads every component to the same width
+	return FText::Format(
+		FText::FromString("{0}, {1}, {2}"),
+		FormatValue(length_converted.X, *unit_string, EUnitFamily::UF_LENGTH, precision, ForceSign, UseGrouping, StableWidth, Notation),
+		FormatValue(length_converted.Y, *unit_string, EUnitFamily::UF_LENGTH, precision, ForceSign, UseGrouping, StableWidth, Notation),
+		FormatValue(length_converted.Z, *unit_string, EUnitFamily::UF_LENGTH, precision, ForceSign, UseGrouping, StableWidth, Notation)
+	);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatRotator(const FRotator& angle, EAngleUnit fromUnit, EAngleUnit toUnit, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(toUnit);
+	if (!unit_string) return FText();
+
+	const FRotator angle_converted = ConvertAngleRotator(angle, fromUnit, toUnit);
+
+	return FText::Format(
+		FText::FromString("{0}, {1}, {2}"),
+		FormatValue(angle_converted.Pitch, *unit_string, EUnitFamily::UF_ANGLE, precision, ForceSign, UseGrouping, StableWidth, Notation),
+		FormatValue(angle_converted.Yaw, *unit_string, EUnitFamily::UF_ANGLE, precision, ForceSign, UseGrouping, StableWidth, Notation),
+		FormatValue(angle_converted.Roll, *unit_string, EUnitFamily::UF_ANGLE, precision, ForceSign, UseGrouping, StableWidth, Notation)
+	);
+}
+
+
+
+int64 UTicTacToeUnitFormatBPLibrary::ConvertLengthFixed(int64 length, bool& Overflow, ELengthUnit fromUnit, ELengthUnit toUnit, TEnumAsByte<ERoundingMode> RoundingMode)
+{
+	int64 length_converted = 0;
+	Overflow = !FTicTacToeFixedPoint::Convert(length, fromUnit, toUnit, RoundingMode.GetValue(), length_converted);
+	return length_converted;
+}
+
+bool UTicTacToeUnitFormatBPLibrary::ConvertLengthFixedArray(TArray<int64>& lengths, ELengthUnit fromUnit, ELengthUnit toUnit, TEnumAsByte<ERoundingMode> RoundingMode)
+{
+	return FTicTacToeFixedPoint::Convert(MakeArrayView(lengths), fromUnit, toUnit, RoundingMode.GetValue());
+}
+
+int64 UTicTacToeUnitFormatBPLibrary::ConvertWeightFixed(int64 weight, bool& Overflow, EWeightUnit fromUnit, EWeightUnit toUnit, TEnumAsByte<ERoundingMode> RoundingMode)
+{
+	int64 weight_converted = 0;
+	Overflow = !FTicTacToeFixedPoint::Convert(weight, fromUnit, toUnit, RoundingMode.GetValue(), weight_converted);
+	return weight_converted;
+}
+
+bool UTicTacToeUnitFormatBPLibrary::ConvertWeightFixedArray(TArray<int64>& weights, EWeightUnit fromUnit, EWeightUnit toUnit, TEnumAsByte<ERoundingMode> RoundingMode)
+{
+	return FTicTacToeFixedPoint::Convert(MakeArrayView(weights), fromUnit, toUnit, RoundingMode.GetValue());
+}
+
+int64 UTicTacToeUnitFormatBPLibrary::ConvertVolumeFixed(int64 volume, bool& Overflow, EVolumeUnit fromUnit, EVolumeUnit toUnit, TEnumAsByte<ERoundingMode> RoundingMode)
+{
+	int64 volume_converted = 0;
+	Overflow = !FTicTacToeFixedPoint::Convert(volume, fromUnit, toUnit, RoundingMode.GetValue(), volume_converted);
+	return volume_converted;
+}
+
+bool UTicTacToeUnitFormatBPLibrary::ConvertVolumeFixedArray(TArray<int64>& volumes, EVolumeUnit fromUnit, EVolumeUnit toUnit, TEnumAsByte<ERoundingMode> RoundingMode)
+{
+	return FTicTacToeFixedPoint::Convert(MakeArrayView(volumes), fromUnit, toUnit, RoundingMode.GetValue());
+}
+
+int64 UTicTacToeUnitFormatBPLibrary::ConvertAreaFixed(int64 area, bool& Overflow, EAreaUnit fromUnit, EAreaUnit toUnit, TEnumAsByte<ERoundingMode> RoundingMode)
+{
+	int64 area_converted = 0;
+	Overflow = !FTicTacToeFixedPoint::Convert(area, fromUnit, toUnit, RoundingMode.GetValue(), area_converted);
+	return area_converted;
+}
+
+bool UTicTacToeUnitFormatBPLibrary::ConvertAreaFixedArray(TArray<int64>& areas, EAreaUnit fromUnit, EAreaUnit toUnit, TEnumAsByte<ERoundingMode> RoundingMode)
+{
+	return FTicTacToeFixedPoint::Convert(MakeArrayView(areas), fromUnit, toUnit, RoundingMode.GetValue());
+}
+
+int64 UTicTacToeUnitFormatBPLibrary::ConvertDataSizeFixed(int64 size, bool& Overflow, EDataSizeUnit fromUnit, EDataSizeUnit toUnit, TEnumAsByte<ERoundingMode> RoundingMode)
+{
+	int64 size_converted = 0;
+	Overflow = !FTicTacToeFixedPoint::Convert(size, fromUnit, toUnit, RoundingMode.GetValue(), size_converted);
+	return size_converted;
+}
+
+int64 UTicTacToeUnitFormatBPLibrary::ConvertDataRateFixed(int64 rate, bool& Overflow, EDataRateUnit fromUnit, EDataRateUnit toUnit, TEnumAsByte<ERoundingMode> RoundingMode)
+{
+	int64 rate_converted = 0;
+	Overflow = !FTicTacToeFixedPoint::Convert(rate, fromUnit, toUnit, RoundingMode.GetValue(), rate_converted);
+	return rate_converted;
+}
+
+double UTicTacToeUnitFormatBPLibrary::ConvertUnit(double value, EUnitFamily family, uint8 fromUnit, uint8 toUnit)
+{
+	switch (family)
+	{
+	case EUnitFamily::UF_LENGTH:		return ConvertLength(value, (ELengthUnit)fromUnit, (ELengthUnit)toUnit);
+	case EUnitFamily::UF_WEIGHT:		return ConvertWeight(value, (EWeightUnit)fromUnit, (EWeightUnit)toUnit);
+	case EUnitFamily::UF_VOLUME:		return ConvertVolume(value, (EVolumeUnit)fromUnit, (EVolumeUnit)toUnit);
+	case EUnitFamily::UF_AREA:			return ConvertArea(value, (EAreaUnit)fromUnit, (EAreaUnit)toUnit);
+	case EUnitFamily::UF_TEMPERATURE:	return ConvertTemperature(value, (ETemperatureUnit)fromUnit, (ETemperatureUnit)toUnit);
+	case EUnitFamily::UF_TIME:			return ConvertTime(value, (ETimeUnit)fromUnit, (ETimeUnit)toUnit);
+	case EUnitFamily::UF_PRESSURE:		return ConvertPressure(value, (EPressureUnit)fromUnit, (EPressureUnit)toUnit);
+	case EUnitFamily::UF_ENERGY:		return ConvertEnergy(value, (EEnergyUnit)fromUnit, (EEnergyUnit)toUnit);
+	case EUnitFamily::UF_ANGLE:			return ConvertAngle(value, (EAngleUnit)fromUnit, (EAngleUnit)toUnit);
+	case EUnitFamily::UF_POWER:			return ConvertPower(value, (EPowerUnit)fromUnit, (EPowerUnit)toUnit);
+	case EUnitFamily::UF_FLOW:			return ConvertFlow(value, (EFlowUnit)fromUnit, (EFlowUnit)toUnit);
+	case EUnitFamily::UF_DENSITY:		return ConvertDensity(value, (EDensityUnit)fromUnit, (EDensityUnit)toUnit);
+	case EUnitFamily::UF_ACCELERATION:	return ConvertAcceleration(value, (EAccelerationUnit)fromUnit, (EAccelerationUnit)toUnit);
+	case EUnitFamily::UF_TORQUE:		return ConvertTorque(value, (ETorqueUnit)fromUnit, (ETorqueUnit)toUnit);
+	case EUnitFamily::UF_DATA_SIZE:		return ConvertDataSize(value, (EDataSizeUnit)fromUnit, (EDataSizeUnit)toUnit);
+	case EUnitFamily::UF_DATA_RATE:		return ConvertDataRate(value, (EDataRateUnit)fromUnit, (EDataRateUnit)toUnit);
+	default: return 0.0;
+	}
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatUnit(double value, EUnitFamily family, uint8 fromUnit, uint8 toUnit, uint8 AutoUnit, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	switch (family)
+	{
+	case EUnitFamily::UF_LENGTH:		return FormatLength(value, (ELengthUnit)fromUnit, (ELengthUnit)toUnit, (EAutoUnitType)AutoUnit, false, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_WEIGHT:		return FormatWeight(value, (EWeightUnit)fromUnit, (EWeightUnit)toUnit, (EAutoUnitType)AutoUnit, false, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_VOLUME:		return FormatVolume(value, (EVolumeUnit)fromUnit, (EVolumeUnit)toUnit, (EAutoVolumeUnitType)AutoUnit, false, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_AREA:			return FormatArea(value, (EAreaUnit)fromUnit, (EAreaUnit)toUnit, (EAutoUnitType)AutoUnit, false, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_TEMPERATURE:	return FormatTemperature(value, (ETemperatureUnit)fromUnit, (ETemperatureUnit)toUnit, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_TIME:			return FormatTime(value, (ETimeUnit)fromUnit, (ETimeUnit)toUnit, AutoUnit != 0, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_PRESSURE:		return FormatPressure(value, (EPressureUnit)fromUnit, (EPressureUnit)toUnit, (EAutoPressureUnitType)AutoUnit, false, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_ENERGY:		return FormatEnergy(value, (EEnergyUnit)fromUnit, (EEnergyUnit)toUnit, (EAutoEnergyUnitType)AutoUnit, false, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_ANGLE:			return FormatAngle(value, (EAngleUnit)fromUnit, (EAngleUnit)toUnit, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_POWER:
+	case EUnitFamily::UF_FLOW:
+	case EUnitFamily::UF_DENSITY:
+	case EUnitFamily::UF_ACCELERATION:
+	case EUnitFamily::UF_TORQUE:		return FormatDerived(value, family, fromUnit, toUnit, (EAutoUnitType)AutoUnit, false, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_DATA_SIZE:		return FormatDataSize(value, (EDataSizeUnit)fromUnit, (EDataSizeUnit)toUnit, (EAutoDataUnitType)AutoUnit, false, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	case EUnitFamily::UF_DATA_RATE:		return FormatDataRate(value, (EDataRateUnit)fromUnit, (EDataRateUnit)toUnit, (EAutoDataUnitType)AutoUnit, false, precision, ForceSign, UseGrouping, StableWidth, Notation);
+	default: return FText();
+	}
+}
+
+uint8 UTicTacToeUnitFormatBPLibrary::GetDisplayUnit(double value, EUnitFamily family, uint8 fromUnit, uint8 toUnit, uint8 AutoUnit, bool UseExtendedAutoUnits)
+{
+	const EAutoUnitType auto_unit = (EAutoUnitType)AutoUnit;
+	const bool auto_ladder = auto_unit == EAutoUnitType::AUT_MET_AUTO || auto_unit == EAutoUnitType::AUT_IMP_US_AUTO;
+
+	switch (family)
+	{
+	case EUnitFamily::UF_LENGTH:
+		return auto_ladder ? (uint8)GetAutoLength(ConvertLength(value, (ELengthUnit)fromUnit, ELengthUnit::LU_MET_M), auto_unit) : toUnit;
+	case EUnitFamily::UF_WEIGHT:
+		return auto_ladder ? (uint8)GetAutoWeight(ConvertWeight(value, (EWeightUnit)fromUnit, EWeightUnit::WU_MET_KG), auto_unit) : toUnit;
+	case EUnitFamily::UF_AREA:
+		return auto_ladder ? (uint8)GetAutoArea(ConvertArea(value, (EAreaUnit)fromUnit, EAreaUnit::AU_MET_M2), auto_unit) : toUnit;
+	case EUnitFamily::UF_VOLUME:
+		if ((EAutoVolumeUnitType)AutoUnit != EAutoVolumeUnitType::AUT_MET_AUTO && (EAutoVolumeUnitType)AutoUnit != EAutoVolumeUnitType::AUT_IMP_AUTO) return toUnit;
+		return (uint8)GetAutoVolume(ConvertVolume(value, (EVolumeUnit)fromUnit, EVolumeUnit::VU_MET_M3), (EAutoVolumeUnitType)AutoUnit, UseExtendedAutoUnits);
+	case EUnitFamily::UF_TIME:
+		return AutoUnit != 0 ? (uint8)GetAutoTime(ConvertTime(value, (ETimeUnit)fromUnit, ETimeUnit::TU_SEC)) : toUnit;
+	case EUnitFamily::UF_PRESSURE:
+		if ((EAutoPressureUnitType)AutoUnit != EAutoPressureUnitType::AUT_MET_AUTO) return toUnit;
+		return (uint8)GetAutoPressure(ConvertPressure(value, (EPressureUnit)fromUnit, EPressureUnit::PU_MET_PA), EAutoPressureUnitType::AUT_MET_AUTO);
+	case EUnitFamily::UF_ENERGY:
+		if ((EAutoEnergyUnitType)AutoUnit == EAutoEnergyUnitType::AUT_OFF) return toUnit;
+		return (uint8)GetAutoEnergy(ConvertEnergy(value, (EEnergyUnit)fromUnit, EEnergyUnit::EU_J), (EAutoEnergyUnitType)AutoUnit);
+	case EUnitFamily::UF_POWER:
+		return auto_ladder ? (uint8)GetAutoPower(ConvertPower(value, (EPowerUnit)fromUnit, EPowerUnit::PW_MET_W), auto_unit) : toUnit;
+	case EUnitFamily::UF_FLOW:
+		return auto_ladder ? (uint8)GetAutoFlow(ConvertFlow(value, (EFlowUnit)fromUnit, EFlowUnit::FU_MET_M3_S), auto_unit) : toUnit;
+	case EUnitFamily::UF_DENSITY:
+		return auto_ladder ? (uint8)GetAutoDensity(ConvertDensity(value, (EDensityUnit)fromUnit, EDensityUnit::DU_MET_KG_M3), auto_unit) : toUnit;
+	case EUnitFamily::UF_ACCELERATION:
+		return auto_ladder ? (uint8)GetAutoAcceleration(ConvertAcceleration(value, (EAccelerationUnit)fromUnit, EAccelerationUnit::AC_MET_M_S2), auto_unit) : toUnit;
+	case EUnitFamily::UF_TORQUE:
+		return auto_ladder ? (uint8)GetAutoTorque(ConvertTorque(value, (ETorqueUnit)fromUnit, ETorqueUnit::TQ_MET_N_M), auto_unit) : toUnit;
+	case EUnitFamily::UF_DATA_SIZE:
+		if ((EAutoDataUnitType)AutoUnit == EAutoDataUnitType::AUT_OFF) return toUnit;
+		return (uint8)GetAutoDataSize(ConvertDataSize(value, (EDataSizeUnit)fromUnit, EDataSizeUnit::DS_BYTE), (EAutoDataUnitType)AutoUnit, UseExtendedAutoUnits);
+	case EUnitFamily::UF_DATA_RATE:
+		if ((EAutoDataUnitType)AutoUnit == EAutoDataUnitType::AUT_OFF) return toUnit;
+		return (uint8)GetAutoDataRate(ConvertDataRate(value, (EDataRateUnit)fromUnit, EDataRateUnit::DR_BYTE_S), (EAutoDataUnitType)AutoUnit, UseExtendedAutoUnits);
+	default:
+		return toUnit;
+	}
+}
+
+ESIPrefix UTicTacToeUnitFormatBPLibrary::SelectSIPrefix(double value, int32 AllowedPrefixes, int32 Power)
+{
+	return FTicTacToeSIPrefix::Select(value, AllowedPrefixes, Power);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatSI(double value, FText unitSymbol, int32 AllowedPrefixes, int32 Power, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation)
+{
+	const ESIPrefix prefix = FTicTacToeSIPrefix::Select(value, AllowedPrefixes, Power);
+	const double value_converted = value / FTicTacToeSIPrefix::GetScale(prefix, Power);
+
+	// Longest prefix symbol is "da"
+	const int32 suffix_slot = StableWidth > 0 ? 2 + unitSymbol.ToString().Len() : 0;
+
+	return FormatValue(value_converted, FText::Format(FText::FromString("{0}{1}"), FTicTacToeSIPrefix::GetSymbol(prefix), unitSymbol), suffix_slot, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+void UTicTacToeUnitFormatBPLibrary::SetAutoUnitPrefixes(EUnitFamily family, int32 AllowedPrefixes)
+{
+	if (std::atomic<int32>* prefixes = FindAutoPrefixes(family))
+		prefixes->store(AllowedPrefixes & GetMetricPrefixes(family), std::memory_order_relaxed);
+}
+
+int32 UTicTacToeUnitFormatBPLibrary::GetAutoUnitPrefixes(EUnitFamily family)
+{
+	const std::atomic<int32>* prefixes = FindAutoPrefixes(family);
+	return prefixes ? prefixes->load(std::memory_order_relaxed) : 0;
+}
+
+int UTicTacToeUnitFormatBPLibrary::GetStableNumberWidth(int precision, int integerDigits, bool UseGrouping)
+{
+	integerDigits = FMath::Max(integerDigits, 1);
+	precision = FMath::Max(precision, 0);
+
+	// Sign, digits, one separator per group of three, decimal separator and fractional digits
+	return 1 + integerDigits + (UseGrouping ? (integerDigits - 1) / 3 : 0) + (precision > 0 ? 1 + precision : 0);
+}
+
+int UTicTacToeUnitFormatBPLibrary::GetStableSuffixWidth(EUnitFamily family)
+{
+	return FTicTacToeUnitDisplayStrings::GetMaxLength(family);
+}
+
+int UTicTacToeUnitFormatBPLibrary::GetStableWidth(EUnitFamily family, int precision, int integerDigits, bool UseGrouping)
+{
+	return GetStableNumberWidth(precision, integerDigits, UseGrouping) + GetStableSuffixWidth(family);
+}
+
+// Characters Conv_DoubleToText takes at most for abs_value at this precision, sign excluded. Also gives the decimal
+// exponent after rounding, MIN_int32 when the value is zero.
+static int32 GetNumberWidth(double abs_value, int32 precision, bool UseGrouping, int32& out_exponent)
+{
+	int32 exponent = FTicTacToeSIPrefix::GetDecimalExponent(abs_value);
+
+	// Rounding can carry into the next digit, 9.96 -> 10.0 or 0.096 -> 0.10
+	if (exponent != MIN_int32 && exponent + 1 >= -precision
+		&& abs_value >= FTicTacToeSIPrefix::GetPowerOfTen(exponent + 1) - 0.5 * FTicTacToeSIPrefix::GetPowerOfTen(-precision))
+		++exponent;
+
+	out_exponent = exponent;
+
+	const int32 integer_digits = exponent != MIN_int32 && exponent > 0 ? exponent + 1 : 1;
+	return integer_digits + (UseGrouping ? (integer_digits - 1) / 3 : 0) + (precision > 0 ? 1 + precision : 0);
+}
+
+void UTicTacToeUnitFormatBPLibrary::GetAutoUnitLadder(EUnitFamily family, uint8 AutoUnit, bool UseExtendedAutoUnits, TArray<uint8, TInlineAllocator<8>>& OutUnits)
+{
+	OutUnits.Reset();
+
+	// SI ladders follow the prefix whitelist, the scale of each prefix selects its own unit
+	auto AddPrefixLadder = [&OutUnits, family](TFunctionRef<uint8(double)> GetUnit)
+	{
+		for (uint32 prefixes = (uint32)GetAutoUnitPrefixes(family); prefixes; prefixes &= prefixes - 1)
+		{
+			OutUnits.AddUnique(GetUnit(FTicTacToeSIPrefix::GetScale(ESIPrefix(FMath::CountTrailingZeros(prefixes)))));
+		}
+		if (OutUnits.IsEmpty()) OutUnits.Add(GetUnit(1.0));
+	};
+
+	switch (family)
+	{
+	case EUnitFamily::UF_LENGTH:
+		if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_MET_AUTO)
+			AddPrefixLadder([](double scale) { return (uint8)GetAutoLength(scale, EAutoUnitType::AUT_MET_AUTO); });
+		else if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+			OutUnits = { (uint8)ELengthUnit::LU_US_INCH, (uint8)ELengthUnit::LU_US_FOOT, (uint8)ELengthUnit::LU_US_YARD, (uint8)ELengthUnit::LU_US_MILE };
+		break;
+
+	case EUnitFamily::UF_WEIGHT:
+		if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_MET_AUTO)
+			OutUnits = { (uint8)EWeightUnit::WU_MET_MG, (uint8)EWeightUnit::WU_MET_G, (uint8)EWeightUnit::WU_MET_KG, (uint8)EWeightUnit::WU_MET_TON };
+		else if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+			OutUnits = { (uint8)EWeightUnit::WU_US_GR, (uint8)EWeightUnit::WU_US_OZ, (uint8)EWeightUnit::WU_US_LB, (uint8)EWeightUnit::WU_US_TON_S };
+		break;
+
+	case EUnitFamily::UF_VOLUME:
+		if ((EAutoVolumeUnitType)AutoUnit == EAutoVolumeUnitType::AUT_MET_AUTO)
+		{
+			OutUnits = { (uint8)EVolumeUnit::VU_MET_MM3, (uint8)EVolumeUnit::VU_MET_CM3, (uint8)EVolumeUnit::VU_MET_M3 };
+			if (UseExtendedAutoUnits) OutUnits.Add((uint8)EVolumeUnit::VU_MET_HM3);
+			OutUnits.Add((uint8)EVolumeUnit::VU_MET_KM3);
+		}
+		else if ((EAutoVolumeUnitType)AutoUnit == EAutoVolumeUnitType::AUT_IMP_AUTO)
+			OutUnits = { (uint8)EVolumeUnit::VU_US_IN3, (uint8)EVolumeUnit::VU_US_FT3, (uint8)EVolumeUnit::VU_US_YD3, (uint8)EVolumeUnit::VU_US_ACREFT };
+		break;
+
+	case EUnitFamily::UF_AREA:
+		if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_MET_AUTO)
+			OutUnits = { (uint8)EAreaUnit::AU_MET_MM2, (uint8)EAreaUnit::AU_MET_CM2, (uint8)EAreaUnit::AU_MET_M2, (uint8)EAreaUnit::AU_MET_HA, (uint8)EAreaUnit::AU_MET_KM2 };
+		else if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+			OutUnits = { (uint8)EAreaUnit::AU_US_SQIN, (uint8)EAreaUnit::AU_US_SQFT, (uint8)EAreaUnit::AU_US_SQYD, (uint8)EAreaUnit::AU_US_ACRE };
+		break;
+
+	case EUnitFamily::UF_TIME:
+		if (AutoUnit != 0)
+			OutUnits = { (uint8)ETimeUnit::TU_SEC, (uint8)ETimeUnit::TU_MIN, (uint8)ETimeUnit::TU_HR, (uint8)ETimeUnit::TU_MO, (uint8)ETimeUnit::TU_YR };
+		break;
+
+	case EUnitFamily::UF_PRESSURE:
+		if ((EAutoPressureUnitType)AutoUnit == EAutoPressureUnitType::AUT_MET_AUTO)
+			AddPrefixLadder([](double scale) { return (uint8)GetAutoPressure(scale, EAutoPressureUnitType::AUT_MET_AUTO); });
+		break;
+
+	case EUnitFamily::UF_ENERGY:
+		if ((EAutoEnergyUnitType)AutoUnit == EAutoEnergyUnitType::AUT_JOULES)
+			AddPrefixLadder([](double scale) { return (uint8)GetAutoEnergy(scale, EAutoEnergyUnitType::AUT_JOULES); });
+		else if ((EAutoEnergyUnitType)AutoUnit == EAutoEnergyUnitType::AUT_WATTH)
+			OutUnits = { (uint8)EEnergyUnit::EU_WH, (uint8)EEnergyUnit::EU_KWH, (uint8)EEnergyUnit::EU_MWH };
+		break;
+
+	case EUnitFamily::UF_POWER:
+		if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_MET_AUTO)
+			AddPrefixLadder([](double scale) { return (uint8)GetAutoPower(scale, EAutoUnitType::AUT_MET_AUTO); });
+		else if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+			OutUnits = { (uint8)EPowerUnit::PW_US_HP };
+		break;
+
+	case EUnitFamily::UF_FLOW:
+		if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_MET_AUTO)
+			OutUnits = { (uint8)EFlowUnit::FU_MET_ML_S, (uint8)EFlowUnit::FU_MET_L_S, (uint8)EFlowUnit::FU_MET_M3_S };
+		else if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+			OutUnits = { (uint8)EFlowUnit::FU_US_GAL_H, (uint8)EFlowUnit::FU_US_GAL_MIN, (uint8)EFlowUnit::FU_US_FT3_S };
+		break;
+
+	case EUnitFamily::UF_DENSITY:
+		if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_MET_AUTO)
+			OutUnits = { (uint8)EDensityUnit::DU_MET_G_M3, (uint8)EDensityUnit::DU_MET_KG_M3 };
+		else if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+			OutUnits = { (uint8)EDensityUnit::DU_US_LB_FT3 };
+		break;
+
+	case EUnitFamily::UF_ACCELERATION:
+		if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_MET_AUTO)
+			OutUnits = { (uint8)EAccelerationUnit::AC_MET_MM_S2, (uint8)EAccelerationUnit::AC_MET_M_S2 };
+		else if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+			OutUnits = { (uint8)EAccelerationUnit::AC_US_IN_S2, (uint8)EAccelerationUnit::AC_US_FT_S2 };
+		break;
+
+	case EUnitFamily::UF_TORQUE:
+		if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_MET_AUTO)
+			OutUnits = { (uint8)ETorqueUnit::TQ_MET_N_CM, (uint8)ETorqueUnit::TQ_MET_N_M, (uint8)ETorqueUnit::TQ_MET_KN_M };
+		else if ((EAutoUnitType)AutoUnit == EAutoUnitType::AUT_IMP_US_AUTO)
+			OutUnits = { (uint8)ETorqueUnit::TQ_US_LBF_IN, (uint8)ETorqueUnit::TQ_US_LBF_FT };
+		break;
+
+	case EUnitFamily::UF_DATA_SIZE:
+	case EUnitFamily::UF_DATA_RATE:
+		// Rates share the size layout
+		if ((EAutoDataUnitType)AutoUnit == EAutoDataUnitType::AUT_DECIMAL)
+		{
+			OutUnits = { (uint8)EDataSizeUnit::DS_BYTE, (uint8)EDataSizeUnit::DS_KB, (uint8)EDataSizeUnit::DS_MB, (uint8)EDataSizeUnit::DS_GB };
+			if (UseExtendedAutoUnits) OutUnits.Append({ (uint8)EDataSizeUnit::DS_TB, (uint8)EDataSizeUnit::DS_PB });
+		}
+		else if ((EAutoDataUnitType)AutoUnit == EAutoDataUnitType::AUT_BINARY)
+		{
+			OutUnits = { (uint8)EDataSizeUnit::DS_BYTE, (uint8)EDataSizeUnit::DS_KIB, (uint8)EDataSizeUnit::DS_MIB, (uint8)EDataSizeUnit::DS_GIB };
+			if (UseExtendedAutoUnits) OutUnits.Append({ (uint8)EDataSizeUnit::DS_TIB, (uint8)EDataSizeUnit::DS_PIB });
+		}
+		else if ((EAutoDataUnitType)AutoUnit == EAutoDataUnitType::AUT_DECIMAL_BITS)
+		{
+			OutUnits = { (uint8)EDataSizeUnit::DS_BIT, (uint8)EDataSizeUnit::DS_KBIT, (uint8)EDataSizeUnit::DS_MBIT, (uint8)EDataSizeUnit::DS_GBIT };
+			if (UseExtendedAutoUnits) OutUnits.Add((uint8)EDataSizeUnit::DS_TBIT);
+		}
+		break;
+
+	default: break;
+	}
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatClock(double seconds, EClockFormat format, bool ForceSign)
+{
+	FTicTacToeRaceTimer timer(format, ForceSign);
+	timer.UpdateSeconds(seconds);
+	return timer.ToText();
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatUnitToWidth(double value, EUnitFamily family, uint8 fromUnit, uint8 toUnit, uint8 AutoUnit, bool UseExtendedAutoUnits, int MaxCharacters, int MaxPrecision, bool ForceSign, bool UseGrouping)
+{
+	TArray<uint8, TInlineAllocator<8>> ladder;
+	GetAutoUnitLadder(family, AutoUnit, UseExtendedAutoUnits, ladder);
+	if (ladder.IsEmpty()) ladder.Add(toUnit);
+
+	const uint8 auto_unit = GetDisplayUnit(value, family, fromUnit, toUnit, AutoUnit, UseExtendedAutoUnits);
+	MaxPrecision = FMath::Clamp(MaxPrecision, 0, 15);
+
+	const FText* best_string = nullptr;
+	uint8 best_unit = auto_unit;
+	int32 best_precision = 0;
+	int32 best_width = MAX_int32;
+	int32 best_digits = MIN_int32;
+	bool best_fits = false;
+	double best_value = 0.0;
+
+	for (uint8 unit : ladder)
+	{
+		const FText* unit_string = FTicTacToeUnitDisplayStrings::Find(family, unit);
+		if (!unit_string) continue;
+
+		const double value_converted = ConvertUnit(value, family, fromUnit, unit);
+		const double abs_value = FMath::Abs(value_converted);
+
+		// The sign of the number as printed, an offset unit can flip it (-5 °C is 23 °F) and a negative that rounds to zero keeps it
+		const int32 sign_width = (ForceSign || FMath::IsNegativeOrNegativeZero(value_converted)) ? 1 : 0;
+		const int32 fixed_width = sign_width + FTicTacToeUnitDisplayStrings::GetLength(family, unit);
+
+		// Integer part first, then as many fractional digits as the remaining characters allow
+		int32 exponent;
+		const int32 integer_width = GetNumberWidth(abs_value, 0, UseGrouping, exponent);
+		int32 precision = FMath::Clamp(MaxCharacters - fixed_width - integer_width - 1, 0, MaxPrecision);
+		int32 width = fixed_width + GetNumberWidth(abs_value, precision, UseGrouping, exponent);
+
+		// Rounding at 0 digits may have carried where the chosen precision does not (9.94 -> "10" but "9.9")
+		int32 next_exponent;
+		const int32 next_width = precision < MaxPrecision ? fixed_width + GetNumberWidth(abs_value, precision + 1, UseGrouping, next_exponent) : MAX_int32;
+		if (next_width <= MaxCharacters)
+		{
+			++precision;
+			width = next_width;
+			exponent = next_exponent;
+		}
+
+		const bool fits = width <= MaxCharacters;
+		const int32 digits = exponent == MIN_int32 ? 0 : FMath::Max(precision + exponent + 1, 0);
+
+		bool better;
+		if (fits != best_fits)					better = fits;
+		else if (!fits)							better = width < best_width;
+		else if (digits != best_digits)			better = digits > best_digits;
+		else if ((unit == auto_unit) != (best_unit == auto_unit)) better = unit == auto_unit;
+		else									better = width < best_width;
+
+		if (better || !best_string)
+		{
+			best_string = unit_string;
+			best_unit = unit;
+			best_precision = precision;
+			best_width = width;
+			best_digits = digits;
+			best_fits = fits;
+			best_value = value_converted;
+		}
+	}
+
+	if (!best_string) return FText();
+
+	return FormatValue(best_value, *best_string, 0, best_precision, ForceSign, UseGrouping, 0);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatLengthToWidth(double length, ELengthUnit fromUnit, ELengthUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int MaxCharacters, int MaxPrecision, bool ForceSign, bool UseGrouping)
+{
+	return FormatUnitToWidth(length, EUnitFamily::UF_LENGTH, (uint8)fromUnit, (uint8)toUnit, (uint8)AutoUnit, UseExtendedAutoUnits, MaxCharacters, MaxPrecision, ForceSign, UseGrouping);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatWeightToWidth(double weight, EWeightUnit fromUnit, EWeightUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int MaxCharacters, int MaxPrecision, bool ForceSign, bool UseGrouping)
+{
+	return FormatUnitToWidth(weight, EUnitFamily::UF_WEIGHT, (uint8)fromUnit, (uint8)toUnit, (uint8)AutoUnit, UseExtendedAutoUnits, MaxCharacters, MaxPrecision, ForceSign, UseGrouping);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatVolumeToWidth(double volume, EVolumeUnit fromUnit, EVolumeUnit toUnit, EAutoVolumeUnitType AutoUnit, bool UseExtendedAutoUnits, int MaxCharacters, int MaxPrecision, bool ForceSign, bool UseGrouping)
+{
+	return FormatUnitToWidth(volume, EUnitFamily::UF_VOLUME, (uint8)fromUnit, (uint8)toUnit, (uint8)AutoUnit, UseExtendedAutoUnits, MaxCharacters, MaxPrecision, ForceSign, UseGrouping);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatAreaToWidth(double area, EAreaUnit fromUnit, EAreaUnit toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int MaxCharacters, int MaxPrecision, bool ForceSign, bool UseGrouping)
+{
+	return FormatUnitToWidth(area, EUnitFamily::UF_AREA, (uint8)fromUnit, (uint8)toUnit, (uint8)AutoUnit, UseExtendedAutoUnits, MaxCharacters, MaxPrecision, ForceSign, UseGrouping);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatTimeToWidth(double time, ETimeUnit fromUnit, ETimeUnit toUnit, bool AutoUnit, int MaxCharacters, int MaxPrecision, bool ForceSign, bool UseGrouping)
+{
+	return FormatUnitToWidth(time, EUnitFamily::UF_TIME, (uint8)fromUnit, (uint8)toUnit, AutoUnit ? 1 : 0, false, MaxCharacters, MaxPrecision, ForceSign, UseGrouping);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatPressureToWidth(double pressure, EPressureUnit fromUnit, EPressureUnit toUnit, EAutoPressureUnitType AutoUnit, bool UseExtendedAutoUnits, int MaxCharacters, int MaxPrecision, bool ForceSign, bool UseGrouping)
+{
+	return FormatUnitToWidth(pressure, EUnitFamily::UF_PRESSURE, (uint8)fromUnit, (uint8)toUnit, (uint8)AutoUnit, UseExtendedAutoUnits, MaxCharacters, MaxPrecision, ForceSign, UseGrouping);
+}
+
+FText UTicTacToeUnitFormatBPLibrary::FormatEnergyToWidth(double energy, EEnergyUnit fromUnit, EEnergyUnit toUnit, EAutoEnergyUnitType AutoUnit, bool UseExtendedAutoUnits, int MaxCharacters, int MaxPrecision, bool ForceSign, bool UseGrouping)
+{
+	return FormatUnitToWidth(energy, EUnitFamily::UF_ENERGY, (uint8)fromUnit, (uint8)toUnit, (uint8)AutoUnit, UseExtendedAutoUnits, MaxCharacters, MaxPrecision, ForceSign, UseGrouping);
+}
@@ -0,0 +1,301 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitFormatScheduler.h"
+#include "TicTacToeUnitPreferenceSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Algo/Sort.h"
+
+namespace TicTacToeUnitScheduler
+{
+	// Results are dropped all at once past this size, values of moving labels rarely repeat for long
+	static constexpr int32 MaxCachedResults = 4096;
+}
+
+FText FTicTacToeFormatRequest::Format(const UTicTacToeUnitPreferenceSubsystem* Preferences) const
+{
+	using Library = UTicTacToeUnitFormatBPLibrary;
+
+	if (UseUnitPreferences && Preferences)
+	{
+		return Preferences->Format(Value, Family, FromUnit, Precision, ForceSign, UseGrouping, StableWidth, Notation);
+	}
+
+	// FormatUnit has no extended auto units, so the display unit is picked here and formatted as a fixed unit
+	const uint8 target_unit = Library::GetDisplayUnit(Value, Family, FromUnit, ToUnit, AutoUnit, UseExtendedAutoUnits);
+	return Library::FormatUnit(Value, Family, FromUnit, target_unit, 0, Precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+UTicTacToeUnitFormatScheduler* UTicTacToeUnitFormatScheduler::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UTicTacToeUnitFormatScheduler>() : nullptr;
+}
+
+void UTicTacToeUnitFormatScheduler::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UTicTacToeUnitPreferenceSubsystem* Preferences = Collection.InitializeDependency<UTicTacToeUnitPreferenceSubsystem>();
+	if (Preferences)
+	{
+		PreferencesChangedHandle = Preferences->OnPreferencesChangedNative().AddUObject(this, &UTicTacToeUnitFormatScheduler::OnPreferencesChanged);
+		BoundPreferences = Preferences;
+	}
+}
+
+void UTicTacToeUnitFormatScheduler::Deinitialize()
+{
+	if (UTicTacToeUnitPreferenceSubsystem* Preferences = BoundPreferences.Get())
+	{
+		Preferences->OnPreferencesChangedNative().Remove(PreferencesChangedHandle);
+	}
+	BoundPreferences.Reset();
+	PreferencesChangedHandle.Reset();
+
+	Labels.Empty();
+	Pending.Empty();
+	Results.Empty();
+
+	Super::Deinitialize();
+}
+
+FTicTacToeFormatHandle UTicTacToeUnitFormatScheduler::RegisterLabel(const FTicTacToeFormatRequest& Request, FOnTicTacToeLabelFormatted OnFormatted)
+{
+	const FTicTacToeFormatHandle Handle = AddLabel(Request);
+	Labels[Handle.Index].OnFormatted = MoveTemp(OnFormatted);
+	return Handle;
+}
+
+FTicTacToeFormatHandle UTicTacToeUnitFormatScheduler::RegisterLabelDynamic(const FTicTacToeFormatRequest& Request, const FOnTicTacToeLabelFormattedDynamic& OnFormatted)
+{
+	const FTicTacToeFormatHandle Handle = AddLabel(Request);
+	Labels[Handle.Index].OnFormattedDynamic = OnFormatted;
+	return Handle;
+}
+
+void UTicTacToeUnitFormatScheduler::UpdateLabel(FTicTacToeFormatHandle Handle, const FTicTacToeFormatRequest& Request)
+{
+	FLabel* Label = FindLabel(Handle);
+	if (!Label || Label->Request == Request) return;
+
+	Label->Request = Request;
+	Enqueue(Handle.Index);
+}
+
+void UTicTacToeUnitFormatScheduler::UpdateLabelValue(FTicTacToeFormatHandle Handle, double Value)
+{
+	FLabel* Label = FindLabel(Handle);
+	if (!Label || Label->Request.Value == Value) return;
+
+	Label->Request.Value = Value;
+	Enqueue(Handle.Index);
+}
+
+void UTicTacToeUnitFormatScheduler::SetLabelVisible(FTicTacToeFormatHandle Handle, bool Visible)
+{
+	FLabel* Label = FindLabel(Handle);
+	if (!Label || Label->bVisible == Visible) return;
+
+	Label->bVisible = Visible;
+	bPendingSorted &= !Label->bPending;
+}
+
+void UTicTacToeUnitFormatScheduler::ReleaseLabel(FTicTacToeFormatHandle& Handle)
+{
+	if (FindLabel(Handle))
+	{
+		// Its entry in Pending is skipped when reached, the slot can only be reused with a new serial
+		Labels.RemoveAt(Handle.Index);
+	}
+	Handle = FTicTacToeFormatHandle();
+}
+
+bool UTicTacToeUnitFormatScheduler::GetLabelText(FTicTacToeFormatHandle Handle, FText& Text) const
+{
+	const FLabel* Label = FindLabel(Handle);
+	if (!Label || !Label->bFormatted) return false;
+
+	Text = Label->Text;
+	return true;
+}
+
+bool UTicTacToeUnitFormatScheduler::IsLabelPending(FTicTacToeFormatHandle Handle) const
+{
+	const FLabel* Label = FindLabel(Handle);
+	return Label && Label->bPending;
+}
+
+void UTicTacToeUnitFormatScheduler::FlushLabel(FTicTacToeFormatHandle Handle)
+{
+	FLabel* Label = FindLabel(Handle);
+	if (!Label || !Label->bPending) return;
+
+	// Left in Pending, which skips labels that are no longer pending
+	Label->bPending = false;
+	if (!FormatLabel(*Label)) return;
+
+	// Copied, the callback may release the label
+	const FText Text = Label->Text;
+	const FOnTicTacToeLabelFormatted OnFormatted = Label->OnFormatted;
+	const FOnTicTacToeLabelFormattedDynamic OnFormattedDynamic = Label->OnFormattedDynamic;
+	OnFormatted.ExecuteIfBound(Text);
+	OnFormattedDynamic.ExecuteIfBound(Text);
+}
+
+void UTicTacToeUnitFormatScheduler::Flush()
+{
+	ProcessPending(0);
+}
+
+void UTicTacToeUnitFormatScheduler::Tick(float DeltaTime)
+{
+	const uint64 BudgetCycles = uint64(FrameBudgetMs * 0.001 / FPlatformTime::GetSecondsPerCycle64());
+	ProcessPending(FPlatformTime::Cycles64() + FMath::Max<uint64>(BudgetCycles, 1));
+}
+
+ETickableTickType UTicTacToeUnitFormatScheduler::GetTickableTickType() const
+{
+	return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+TStatId UTicTacToeUnitFormatScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTicTacToeUnitFormatScheduler, STATGROUP_Tickables);
+}
+
+UTicTacToeUnitFormatScheduler::FLabel* UTicTacToeUnitFormatScheduler::FindLabel(FTicTacToeFormatHandle Handle)
+{
+	if (!Labels.IsValidIndex(Handle.Index)) return nullptr;
+
+	FLabel& Label = Labels[Handle.Index];
+	return Label.Serial == Handle.Serial ? &Label : nullptr;
+}
+
+const UTicTacToeUnitFormatScheduler::FLabel* UTicTacToeUnitFormatScheduler::FindLabel(FTicTacToeFormatHandle Handle) const
+{
+	return const_cast<UTicTacToeUnitFormatScheduler*>(this)->FindLabel(Handle);
+}
+
+FTicTacToeFormatHandle UTicTacToeUnitFormatScheduler::AddLabel(const FTicTacToeFormatRequest& Request)
+{
+	FTicTacToeFormatHandle Handle;
+	Handle.Index = Labels.Emplace();
+	Handle.Serial = NextSerial++;
+
+	FLabel& Label = Labels[Handle.Index];
+	Label.Serial = Handle.Serial;
+	Label.Request = Request;
+	Enqueue(Handle.Index);
+
+	return Handle;
+}
+
+void UTicTacToeUnitFormatScheduler::Enqueue(int32 Index)
+{
+	FLabel& Label = Labels[Index];
+	Label.ChangedFrame = GFrameCounter;
+	bPendingSorted = false;
+
+	// Already queued labels move up to the current frame, their old request is never formatted
+	if (Label.bPending) return;
+
+	Label.bPending = true;
+	Pending.Add(Index);
+}
+
+bool UTicTacToeUnitFormatScheduler::FormatLabel(FLabel& Label)
+{
+	using namespace TicTacToeUnitScheduler;
+
+	FText Text;
+	if (const FText* Cached = Results.Find(Label.Request))
+	{
+		Text = *Cached;
+	}
+	else
+	{
+		if (Results.Num() >= MaxCachedResults) Results.Reset();
+
+		Text = Label.Request.Format(BoundPreferences.Get());
+		Results.Add(Label.Request, Text);
+	}
+
+	const bool bChanged = !Label.bFormatted || !Text.ToString().Equals(Label.Text.ToString(), ESearchCase::CaseSensitive);
+	Label.Text = MoveTemp(Text);
+	Label.bFormatted = true;
+	return bChanged;
+}
+
+void UTicTacToeUnitFormatScheduler::ProcessPending(uint64 Deadline)
+{
+	if (Pending.IsEmpty()) return;
+
+	// Stale entries (released or flushed labels) sort first and are dropped below
+	if (!bPendingSorted)
+	{
+		auto Priority = [this](int32 Index)
+		{
+			const FLabel* Label = Labels.IsValidIndex(Index) ? &Labels[Index] : nullptr;
+			if (!Label || !Label->bPending) return TTuple<bool, bool, uint64>(false, false, 0);
+			return TTuple<bool, bool, uint64>(true, Label->bVisible, Label->ChangedFrame);
+		};
+
+		Algo::SortBy(Pending, Priority);
+		bPendingSorted = true;
+	}
+
+	// Callbacks run once the queue is consistent again, they may update or release labels
+	TArray<TPair<int32, uint32>, TInlineAllocator<64>> Formatted;
+
+	int32 NumFormatted = 0;
+	while (!Pending.IsEmpty())
+	{
+		if (Deadline != 0 && NumFormatted > 0 && FPlatformTime::Cycles64() >= Deadline) break;
+
+		const int32 Index = Pending.Pop(EAllowShrinking::No);
+		if (!Labels.IsValidIndex(Index) || !Labels[Index].bPending) continue;
+
+		FLabel& Label = Labels[Index];
+		Label.bPending = false;
+		++NumFormatted;
+
+		if (FormatLabel(Label))
+		{
+			Formatted.Emplace(Index, Label.Serial);
+		}
+	}
+
+	for (const TPair<int32, uint32>& Entry : Formatted)
+	{
+		FTicTacToeFormatHandle Handle;
+		Handle.Index = Entry.Key;
+		Handle.Serial = Entry.Value;
+
+		const FLabel* Label = FindLabel(Handle);
+		if (!Label) continue;
+
+		// Copied, the callback may release the label
+		const FText Text = Label->Text;
+		const FOnTicTacToeLabelFormatted OnFormatted = Label->OnFormatted;
+		const FOnTicTacToeLabelFormattedDynamic OnFormattedDynamic = Label->OnFormattedDynamic;
+		OnFormatted.ExecuteIfBound(Text);
+		OnFormattedDynamic.ExecuteIfBound(Text);
+	}
+}
+
+void UTicTacToeUnitFormatScheduler::OnPreferencesChanged()
+{
+	// The cached texts of preference labels are in the old units
+	Results.Reset();
+
+	for (auto It = Labels.CreateIterator(); It; ++It)
+	{
+		if (It->Request.UseUnitPreferences)
+		{
+			Enqueue(It.GetIndex());
+		}
+	}
+}
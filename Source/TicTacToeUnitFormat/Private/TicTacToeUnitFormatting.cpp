@@ -1,4 +1,14 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 
-#include "TicTacToeUnitFormatting.h"
\ No newline at end of file
+#include "TicTacToeUnitFormatting.h"
+
+FText UTicTacToeUnitFormatting::FormatQuantity(const FTicTacToeQuantity& quantity, bool ForceSign, bool UseGrouping)
+{
+	return quantity.ToText(ForceSign, UseGrouping);
+}
+
+FTicTacToeQuantity UTicTacToeUnitFormatting::ConvertQuantity(const FTicTacToeQuantity& quantity, uint8 toUnit)
+{
+	return FTicTacToeQuantity(quantity.ConvertTo(toUnit), quantity.Family, toUnit, quantity.Precision);
+}
@@ -0,0 +1,228 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitListSource.h"
+#include "TicTacToeUnitPreferenceSubsystem.h"
+
+UTicTacToeUnitListSource* UTicTacToeUnitListSource::CreateListSource(UObject* WorldContextObject, int32 MaxCachedRows)
+{
+	UTicTacToeUnitListSource* Source = NewObject<UTicTacToeUnitListSource>(WorldContextObject ? WorldContextObject : GetTransientPackage());
+	Source->MaxCachedRows = FMath::Max(MaxCachedRows, 1);
+	Source->BindUnitPreferences(UTicTacToeUnitPreferenceSubsystem::Get(WorldContextObject));
+	return Source;
+}
+
+void UTicTacToeUnitListSource::BeginDestroy()
+{
+	UnbindUnitPreferences();
+
+	Super::BeginDestroy();
+}
+
+int32 UTicTacToeUnitListSource::AddColumn(const FTicTacToeFormatRequest& Format)
+{
+	FColumn& Column = Columns.AddDefaulted_GetRef();
+	Column.Format = Format;
+	Column.Values.SetNumZeroed(RowCount);
+
+	for (FCachedRow& Cached : CachedRows)
+	{
+		Cached.Texts.AddDefaulted();
+		Cached.Formatted.Add(false);
+	}
+	return Columns.Num() - 1;
+}
+
+void UTicTacToeUnitListSource::SetColumnFormat(int32 Column, const FTicTacToeFormatRequest& Format)
+{
+	if (!Columns.IsValidIndex(Column) || Columns[Column].Format == Format) return;
+
+	Columns[Column].Format = Format;
+	InvalidateColumn(Column);
+	BroadcastInvalidated();
+}
+
+void UTicTacToeUnitListSource::SetNumRows(int32 NumRows)
+{
+	NumRows = FMath::Max(NumRows, 0);
+	if (NumRows == RowCount) return;
+
+	for (FColumn& Column : Columns)
+	{
+		Column.Values.SetNumZeroed(NumRows);
+	}
+
+	// Rows past the end are dropped, rows that come back are zeros and must not reuse old texts
+	for (int32 Index = CachedRows.Num() - 1; Index >= 0; --Index)
+	{
+		if (CachedRows[Index].Row >= NumRows) InvalidateRow(CachedRows[Index].Row);
+	}
+	RowCount = NumRows;
+}
+
+void UTicTacToeUnitListSource::SetColumnValues(int32 Column, const TArray<double>& Values)
+{
+	SetColumnValues(Column, TArrayView<const double>(Values));
+}
+
+void UTicTacToeUnitListSource::SetColumnValues(int32 Column, TArrayView<const double> Values)
+{
+	if (!Columns.IsValidIndex(Column)) return;
+
+	// Texts of the cached rows were handed out, including rows the new count drops
+	const bool bAnyCached = CachedRows.Num() > 0;
+
+	SetNumRows(Values.Num());
+	FMemory::Memcpy(Columns[Column].Values.GetData(), Values.GetData(), Values.Num() * sizeof(double));
+	InvalidateColumn(Column);
+	if (bAnyCached) BroadcastInvalidated();
+}
+
+void UTicTacToeUnitListSource::SetValue(int32 Row, int32 Column, double Value)
+{
+	if (!Columns.IsValidIndex(Column) || Row < 0 || Row >= RowCount) return;
+
+	double& Current = Columns[Column].Values[Row];
+	if (Current == Value) return;
+
+	Current = Value;
+	if (const int32* CachedIndex = CachedRowIndices.Find(Row))
+	{
+		CachedRows[*CachedIndex].Formatted[Column] = false;
+		BroadcastInvalidated();
+	}
+}
+
+double UTicTacToeUnitListSource::GetValue(int32 Row, int32 Column) const
+{
+	if (!Columns.IsValidIndex(Column) || Row < 0 || Row >= RowCount) return 0.0;
+	return Columns[Column].Values[Row];
+}
+
+FText UTicTacToeUnitListSource::GetText(int32 Row, int32 Column)
+{
+	if (!Columns.IsValidIndex(Column) || Row < 0 || Row >= RowCount) return FText::GetEmpty();
+
+	FCachedRow& Cached = FindOrAddCachedRow(Row);
+	if (!Cached.Formatted[Column])
+	{
+		FTicTacToeFormatRequest Request = Columns[Column].Format;
+		Request.Value = Columns[Column].Values[Row];
+
+		Cached.Texts[Column] = Request.Format(BoundPreferences.Get());
+		Cached.Formatted[Column] = true;
+	}
+	return Cached.Texts[Column];
+}
+
+void UTicTacToeUnitListSource::GetRowTexts(int32 Row, TArray<FText>& Texts)
+{
+	Texts.Reset(Columns.Num());
+	for (int32 Column = 0; Column < Columns.Num(); ++Column)
+	{
+		Texts.Add(GetText(Row, Column));
+	}
+}
+
+void UTicTacToeUnitListSource::Invalidate()
+{
+	CachedRows.Reset();
+	CachedRowIndices.Reset();
+	BroadcastInvalidated();
+}
+
+UTicTacToeUnitListSource::FCachedRow& UTicTacToeUnitListSource::FindOrAddCachedRow(int32 Row)
+{
+	++UseCounter;
+
+	if (const int32* CachedIndex = CachedRowIndices.Find(Row))
+	{
+		FCachedRow& Cached = CachedRows[*CachedIndex];
+		Cached.LastUsed = UseCounter;
+		return Cached;
+	}
+
+	int32 Index = CachedRows.Num();
+	if (Index < MaxCachedRows)
+	{
+		CachedRows.AddDefaulted();
+	}
+	else
+	{
+		// A view shows a few dozen rows, a linear scan of the cache is cheaper than keeping a list in order
+		Index = 0;
+		for (int32 Candidate = 1; Candidate < CachedRows.Num(); ++Candidate)
+		{
+			if (CachedRows[Candidate].LastUsed < CachedRows[Index].LastUsed) Index = Candidate;
+		}
+		CachedRowIndices.Remove(CachedRows[Index].Row);
+	}
+
+	// Recycled rows keep their text allocations
+	FCachedRow& Cached = CachedRows[Index];
+	Cached.Row = Row;
+	Cached.LastUsed = UseCounter;
+	Cached.Texts.SetNum(Columns.Num());
+	Cached.Formatted.Init(false, Columns.Num());
+	CachedRowIndices.Add(Row, Index);
+	return Cached;
+}
+
+void UTicTacToeUnitListSource::InvalidateRow(int32 Row)
+{
+	int32 Index = INDEX_NONE;
+	if (!CachedRowIndices.RemoveAndCopyValue(Row, Index)) return;
+
+	const int32 LastIndex = CachedRows.Num() - 1;
+	if (Index != LastIndex)
+	{
+		CachedRowIndices[CachedRows[LastIndex].Row] = Index;
+	}
+	CachedRows.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UTicTacToeUnitListSource::InvalidateColumn(int32 Column)
+{
+	for (FCachedRow& Cached : CachedRows)
+	{
+		Cached.Formatted[Column] = false;
+	}
+}
+
+void UTicTacToeUnitListSource::BindUnitPreferences(UTicTacToeUnitPreferenceSubsystem* Preferences)
+{
+	UnbindUnitPreferences();
+	if (!Preferences) return;
+
+	PreferencesChangedHandle = Preferences->OnPreferencesChangedNative().AddUObject(this, &UTicTacToeUnitListSource::OnPreferencesChanged);
+	BoundPreferences = Preferences;
+}
+
+void UTicTacToeUnitListSource::UnbindUnitPreferences()
+{
+	if (UTicTacToeUnitPreferenceSubsystem* Preferences = BoundPreferences.Get())
+	{
+		Preferences->OnPreferencesChangedNative().Remove(PreferencesChangedHandle);
+	}
+	BoundPreferences.Reset();
+	PreferencesChangedHandle.Reset();
+}
+
+void UTicTacToeUnitListSource::OnPreferencesChanged()
+{
+	bool bAnyColumn = false;
+	for (int32 Column = 0; Column < Columns.Num(); ++Column)
+	{
+		if (!Columns[Column].Format.UseUnitPreferences) continue;
+
+		InvalidateColumn(Column);
+		bAnyColumn = true;
+	}
+
+	if (bAnyColumn) BroadcastInvalidated();
+}
+
+void UTicTacToeUnitListSource::BroadcastInvalidated()
+{
+	InvalidatedNative.Broadcast();
+	OnInvalidated.Broadcast();
+}
@@ -0,0 +1,195 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitPreferenceSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+UTicTacToeUnitPreferenceSubsystem* UTicTacToeUnitPreferenceSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UTicTacToeUnitPreferenceSubsystem>() : nullptr;
+}
+
+void UTicTacToeUnitPreferenceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ResolveAndBroadcast();
+}
+
+void UTicTacToeUnitPreferenceSubsystem::SetUnitSystem(EUnitSystem UnitSystem)
+{
+	if (Preferences.UnitSystem == UnitSystem) return;
+
+	Preferences.UnitSystem = UnitSystem;
+	ResolveAndBroadcast();
+}
+
+void UTicTacToeUnitPreferenceSubsystem::SetFamilyOverride(EUnitFamily family, FTicTacToeUnitOverride Override)
+{
+	const FTicTacToeUnitOverride* current = Preferences.Overrides.Find(family);
+	if (current && *current == Override) return;
+
+	Preferences.Overrides.Add(family, Override);
+	ResolveAndBroadcast();
+}
+
+void UTicTacToeUnitPreferenceSubsystem::ClearFamilyOverride(EUnitFamily family)
+{
+	if (Preferences.Overrides.Remove(family) == 0) return;
+
+	ResolveAndBroadcast();
+}
+
+void UTicTacToeUnitPreferenceSubsystem::ApplyPreferences(const FTicTacToeUnitPreferences& InPreferences)
+{
+	Preferences = InPreferences;
+	ResolveAndBroadcast();
+}
+
+FTicTacToeUnitOverride UTicTacToeUnitPreferenceSubsystem::GetFamilyUnit(EUnitFamily family) const
+{
+	return GetResolvedUnit(family).Unit;
+}
+
+void UTicTacToeUnitPreferenceSubsystem::GetSpeedUnits(ELengthUnit& LengthUnit, ETimeUnit& TimeUnit) const
+{
+	LengthUnit = SpeedLengthUnit;
+	TimeUnit = SpeedTimeUnit;
+}
+
+const FTicTacToeResolvedUnit& UTicTacToeUnitPreferenceSubsystem::GetResolvedUnit(EUnitFamily family) const
+{
+	static const FTicTacToeResolvedUnit Unresolved;
+
+	const FTicTacToeResolvedUnit* resolved = Resolved.Find(family);
+	return resolved ? *resolved : Unresolved;
+}
+
+FText UTicTacToeUnitPreferenceSubsystem::Format(double value, EUnitFamily family, uint8 fromUnit, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation) const
+{
+	using Library = UTicTacToeUnitFormatBPLibrary;
+
+	const FTicTacToeUnitOverride& unit = GetResolvedUnit(family).Unit;
+
+	// FormatUnit has no extended auto units, so the display unit is picked here and formatted as a fixed unit
+	const uint8 target_unit = Library::GetDisplayUnit(value, family, fromUnit, unit.ToUnit, unit.AutoUnit, unit.UseExtendedAutoUnits);
+	return Library::FormatUnit(value, family, fromUnit, target_unit, 0, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+FText UTicTacToeUnitPreferenceSubsystem::FormatSpeed(double speed, ELengthUnit fromLengthUnit, ETimeUnit fromTimeUnit, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation) const
+{
+	return UTicTacToeUnitFormatBPLibrary::FormatSpeed(speed, fromLengthUnit, SpeedLengthUnit, fromTimeUnit, SpeedTimeUnit, EAutoUnitType::AUT_OFF, false, precision, ForceSign, UseGrouping, StableWidth, Notation);
+}
+
+FTicTacToeUnitOverride UTicTacToeUnitPreferenceSubsystem::GetSystemUnit(EUnitSystem UnitSystem, EUnitFamily family)
+{
+	auto Make = [](auto ToUnit, auto AutoUnit)
+	{
+		FTicTacToeUnitOverride unit;
+		unit.ToUnit = (uint8)ToUnit;
+		unit.AutoUnit = (uint8)AutoUnit;
+		return unit;
+	};
+
+	const bool metric = UnitSystem == EUnitSystem::US_METRIC || UnitSystem == EUnitSystem::US_NAUTICAL;
+
+	// British units without an auto ladder of their own use the US one, the inch, foot, yard and mile are the same
+	switch (family)
+	{
+	case EUnitFamily::UF_LENGTH:
+		if (UnitSystem == EUnitSystem::US_NAUTICAL) return Make(ELengthUnit::LU_BRIT_NMI, EAutoUnitType::AUT_OFF);
+		return metric ? Make(ELengthUnit::LU_MET_M, EAutoUnitType::AUT_MET_AUTO) : Make(ELengthUnit::LU_US_FOOT, EAutoUnitType::AUT_IMP_US_AUTO);
+
+	case EUnitFamily::UF_WEIGHT:
+		if (UnitSystem == EUnitSystem::US_IMPERIAL_BRIT) return Make(EWeightUnit::WU_BRIT_LB, EAutoUnitType::AUT_OFF);
+		return metric ? Make(EWeightUnit::WU_MET_KG, EAutoUnitType::AUT_MET_AUTO) : Make(EWeightUnit::WU_US_LB, EAutoUnitType::AUT_IMP_US_AUTO);
+
+	case EUnitFamily::UF_VOLUME:
+		if (UnitSystem == EUnitSystem::US_IMPERIAL_BRIT) return Make(EVolumeUnit::VU_BRIT_GAL, EAutoVolumeUnitType::AUT_OFF);
+		return metric ? Make(EVolumeUnit::VU_MET_L, EAutoVolumeUnitType::AUT_OFF) : Make(EVolumeUnit::VU_US_GAL, EAutoVolumeUnitType::AUT_OFF);
+
+	case EUnitFamily::UF_AREA:
+		return metric ? Make(EAreaUnit::AU_MET_M2, EAutoUnitType::AUT_MET_AUTO) : Make(EAreaUnit::AU_US_SQFT, EAutoUnitType::AUT_IMP_US_AUTO);
+
+	case EUnitFamily::UF_TEMPERATURE:
+		return Make(UnitSystem == EUnitSystem::US_IMPERIAL_US ? ETemperatureUnit::TU_FAR : ETemperatureUnit::TU_CEL, 0);
+
+	case EUnitFamily::UF_TIME:
+		return Make(ETimeUnit::TU_SEC, 1);
+
+	case EUnitFamily::UF_PRESSURE:
+		return metric ? Make(EPressureUnit::PU_MET_KPA, EAutoPressureUnitType::AUT_MET_AUTO) : Make(EPressureUnit::PU_MET_PSI, EAutoPressureUnitType::AUT_OFF);
+
+	case EUnitFamily::UF_ENERGY:
+		return Make(EEnergyUnit::EU_J, EAutoEnergyUnitType::AUT_JOULES);
+
+	case EUnitFamily::UF_ANGLE:
+		return Make(EAngleUnit::AU_DEG, 0);
+
+	case EUnitFamily::UF_POWER:
+		return metric ? Make(EPowerUnit::PW_MET_KW, EAutoUnitType::AUT_MET_AUTO) : Make(EPowerUnit::PW_US_HP, EAutoUnitType::AUT_IMP_US_AUTO);
+
+	case EUnitFamily::UF_FLOW:
+		return metric ? Make(EFlowUnit::FU_MET_L_MIN, EAutoUnitType::AUT_OFF) : Make(EFlowUnit::FU_US_GAL_MIN, EAutoUnitType::AUT_OFF);
+
+	case EUnitFamily::UF_DENSITY:
+		return metric ? Make(EDensityUnit::DU_MET_KG_M3, EAutoUnitType::AUT_MET_AUTO) : Make(EDensityUnit::DU_US_LB_FT3, EAutoUnitType::AUT_IMP_US_AUTO);
+
+	case EUnitFamily::UF_ACCELERATION:
+		return metric ? Make(EAccelerationUnit::AC_MET_M_S2, EAutoUnitType::AUT_MET_AUTO) : Make(EAccelerationUnit::AC_US_FT_S2, EAutoUnitType::AUT_IMP_US_AUTO);
+
+	case EUnitFamily::UF_TORQUE:
+		return metric ? Make(ETorqueUnit::TQ_MET_N_M, EAutoUnitType::AUT_MET_AUTO) : Make(ETorqueUnit::TQ_US_LBF_FT, EAutoUnitType::AUT_IMP_US_AUTO);
+
+	// Data units do not depend on the unit system: sizes as the OS file browsers show them, rates as connections are sold
+	case EUnitFamily::UF_DATA_SIZE:
+		return Make(EDataSizeUnit::DS_BYTE, EAutoDataUnitType::AUT_BINARY);
+
+	case EUnitFamily::UF_DATA_RATE:
+		return Make(EDataRateUnit::DR_BYTE_S, EAutoDataUnitType::AUT_DECIMAL_BITS);
+
+	default:
+		return FTicTacToeUnitOverride();
+	}
+}
+
+void UTicTacToeUnitPreferenceSubsystem::ResolveAndBroadcast()
+{
+	bool bChanged = false;
+
+	const UEnum* FamilyEnum = StaticEnum<EUnitFamily>();
+	for (int32 Index = 0; Index < FamilyEnum->NumEnums() - 1; ++Index)
+	{
+		const EUnitFamily family = (EUnitFamily)FamilyEnum->GetValueByIndex(Index);
+
+		const FTicTacToeUnitOverride* override_unit = Preferences.Overrides.Find(family);
+		const FTicTacToeUnitOverride unit = override_unit ? *override_unit : GetSystemUnit(Preferences.UnitSystem, family);
+
+		FTicTacToeResolvedUnit* resolved = Resolved.Find(family);
+		if (resolved && resolved->Unit == unit) continue;
+
+		if (!resolved) resolved = &Resolved.Add(family);
+		resolved->Unit = unit;
+		UTicTacToeUnitFormatBPLibrary::GetAutoUnitLadder(family, unit.AutoUnit, unit.UseExtendedAutoUnits, resolved->Ladder);
+		bChanged = true;
+	}
+
+	ELengthUnit speed_length = ELengthUnit::LU_MET_KM;
+	switch (Preferences.UnitSystem)
+	{
+	case EUnitSystem::US_IMPERIAL_US:		speed_length = ELengthUnit::LU_US_MILE; break;
+	case EUnitSystem::US_IMPERIAL_BRIT:		speed_length = ELengthUnit::LU_BRIT_MI; break;
+	case EUnitSystem::US_NAUTICAL:			speed_length = ELengthUnit::LU_BRIT_NMI; break;
+	default: break;
+	}
+	bChanged |= speed_length != SpeedLengthUnit;
+	SpeedLengthUnit = speed_length;
+
+	if (!bChanged) return;
+
+	PreferencesChangedNative.Broadcast();
+	OnPreferencesChanged.Broadcast();
+}
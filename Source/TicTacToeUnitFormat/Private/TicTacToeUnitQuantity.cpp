@@ -0,0 +1,115 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitQuantity.h"
+
+// The wire header keeps the family in FamilyBits, a new family past that would be written over the unit bits
+static_assert(int32(EUnitFamily::UF_DATA_RATE) < (1 << FTicTacToeQuantity::FamilyBits));
+
+namespace TicTacToeUnitQuantity
+{
+	static constexpr double PowersOfTen[] = { 1.0, 10.0, 100.0, 1000.0, 10000.0, 100000.0, 1000000.0, 10000000.0 };
+
+	// Quantized values stay below 2^53 so they convert back to double exactly
+	static constexpr double MaxQuantized = 9007199254740992.0;
+
+	static constexpr int32 HeaderBits = FTicTacToeQuantity::FamilyBits + FTicTacToeQuantity::UnitBits + FTicTacToeQuantity::PrecisionBits + 1;
+	static constexpr uint32 RawFlag = 1u << (HeaderBits - 1);
+
+	static uint64 ZigZagEncode(int64 Value)
+	{
+		return (uint64(Value) << 1) ^ uint64(Value >> 63);
+	}
+
+	static int64 ZigZagDecode(uint64 Value)
+	{
+		return int64(Value >> 1) ^ -int64(Value & 1);
+	}
+}
+
+uint32 FTicTacToeQuantity::PackHeader() const
+{
+	return uint32(Family)
+		| (uint32(Unit) << FamilyBits)
+		| (uint32(FMath::Min(Precision, MaxPrecision)) << (FamilyBits + UnitBits));
+}
+
+bool FTicTacToeQuantity::UnpackHeader(uint32 Header)
+{
+	const uint8 FamilyValue = Header & ((1u << FamilyBits) - 1);
+	if (!StaticEnum<EUnitFamily>()->IsValidEnumValue(FamilyValue)) return false;
+
+	// Any 6-bit unit fits the header, only the family's own units are accepted
+	const uint8 UnitValue = (Header >> FamilyBits) & ((1u << UnitBits) - 1);
+	if (UnitValue >= TicTacToeUnitCore::GetUnitCount((TicTacToeUnitCore::EFamily)FamilyValue)) return false;
+
+	Family = EUnitFamily(FamilyValue);
+	Unit = UnitValue;
+	Precision = (Header >> (FamilyBits + UnitBits)) & ((1u << PrecisionBits) - 1);
+	return true;
+}
+
+bool FTicTacToeQuantity::GetQuantizedValue(int64& OutQuantized) const
+{
+	const double Scaled = Value * TicTacToeUnitQuantity::PowersOfTen[FMath::Min(Precision, MaxPrecision)];
+	if (!FMath::IsFinite(Scaled) || FMath::Abs(Scaled) >= TicTacToeUnitQuantity::MaxQuantized) return false;
+
+	OutQuantized = int64(FMath::RoundHalfToEven(Scaled));
+	return true;
+}
+
+double FTicTacToeQuantity::ConvertTo(uint8 ToUnit) const
+{
+	return UTicTacToeUnitFormatBPLibrary::ConvertUnit(Value, Family, Unit, ToUnit);
+}
+
+FText FTicTacToeQuantity::ToText(bool ForceSign, bool UseGrouping) const
+{
+	return UTicTacToeUnitFormatBPLibrary::FormatUnit(Value, Family, Unit, Unit, 0, Precision, ForceSign, UseGrouping);
+}
+
+bool FTicTacToeQuantity::Identical(const FTicTacToeQuantity* Other, uint32 PortFlags) const
+{
+	if (!Other || PackHeader() != Other->PackHeader()) return false;
+
+	int64 Quantized, OtherQuantized;
+	if (GetQuantizedValue(Quantized) && Other->GetQuantizedValue(OtherQuantized)) return Quantized == OtherQuantized;
+
+	return Value == Other->Value;
+}
+
+bool FTicTacToeQuantity::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace TicTacToeUnitQuantity;
+
+	uint32 Header = 0;
+	int64 Quantized = 0;
+	if (Ar.IsSaving())
+	{
+		Header = PackHeader();
+		if (!GetQuantizedValue(Quantized)) Header |= RawFlag;
+	}
+
+	Ar.SerializeBits(&Header, HeaderBits);
+
+	if (Ar.IsLoading() && !UnpackHeader(Header))
+	{
+		Ar.SetError();
+		bOutSuccess = false;
+		return true;
+	}
+
+	if (Header & RawFlag)
+	{
+		Ar << Value;
+	}
+	else
+	{
+		uint64 Encoded = ZigZagEncode(Quantized);
+		Ar.SerializeIntPacked64(Encoded);
+
+		if (Ar.IsLoading()) Value = double(ZigZagDecode(Encoded)) / PowersOfTen[Precision];
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitRaceTimer.h"
+
+FTicTacToeRaceTimer::FTicTacToeRaceTimer(EClockFormat InFormat, bool bInForceSign)
+	: Format(InFormat)
+	, bForceSign(bInForceSign)
+{
+	switch (Format)
+	{
+	case EClockFormat::CF_MIN_SEC_MS:		TicksPerUnit = ETimespan::TicksPerMillisecond; UnitsPerTopUnit = 60 * 1000; break;
+	case EClockFormat::CF_HR_MIN_SEC:		TicksPerUnit = ETimespan::TicksPerSecond; UnitsPerTopUnit = 3600; break;
+	case EClockFormat::CF_HR_MIN_SEC_MS:	TicksPerUnit = ETimespan::TicksPerMillisecond; UnitsPerTopUnit = 3600 * 1000; break;
+	case EClockFormat::CF_SEC_MS:			TicksPerUnit = ETimespan::TicksPerMillisecond; UnitsPerTopUnit = 1000; break;
+	}
+
+	Buffer[0] = TEXT('\0');
+}
+
+void FTicTacToeRaceTimer::Layout(int32 InTopDigits, bool bInNegative)
+{
+	// Built from the right, positions are mirrored at the end
+	TCHAR Reversed[MaxLength];
+	int32 Count = 0;
+	NumDigits = 0;
+
+	auto AddDigits = [&](int32 Num, uint8 LastRadix)
+	{
+		for (int32 i = 0; i < Num; ++i)
+		{
+			DigitRadices[NumDigits] = (i == Num - 1) ? LastRadix : 10;
+			DigitPositions[NumDigits++] = (uint8)Count;
+			Reversed[Count++] = TEXT('0');
+		}
+	};
+	auto AddSeparator = [&](TCHAR Separator) { Reversed[Count++] = Separator; };
+
+	switch (Format)
+	{
+	case EClockFormat::CF_MIN_SEC_MS:
+		AddDigits(3, 10); AddSeparator(TEXT('.'));
+		AddDigits(2, 6); AddSeparator(TEXT(':'));
+		break;
+	case EClockFormat::CF_HR_MIN_SEC:
+		AddDigits(2, 6); AddSeparator(TEXT(':'));
+		AddDigits(2, 6); AddSeparator(TEXT(':'));
+		break;
+	case EClockFormat::CF_HR_MIN_SEC_MS:
+		AddDigits(3, 10); AddSeparator(TEXT('.'));
+		AddDigits(2, 6); AddSeparator(TEXT(':'));
+		AddDigits(2, 6); AddSeparator(TEXT(':'));
+		break;
+	case EClockFormat::CF_SEC_MS:
+		AddDigits(3, 10); AddSeparator(TEXT('.'));
+		break;
+	}
+
+	// Leading field has no upper bound, it takes as many digits as the value needs
+	AddDigits(InTopDigits, 10);
+
+	if (bInNegative) AddSeparator(TEXT('-'));
+	else if (bForceSign) AddSeparator(TEXT('+'));
+
+	Length = Count;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Buffer[i] = Reversed[Count - 1 - i];
+	}
+	Buffer[Length] = TEXT('\0');
+
+	for (int32 i = 0; i < NumDigits; ++i)
+	{
+		DigitPositions[i] = uint8(Count - 1 - DigitPositions[i]);
+	}
+
+	TopDigits = InTopDigits;
+	bNegative = bInNegative;
+	bValid = true;
+}
+
+int32 FTicTacToeRaceTimer::Update(int64 Ticks)
+{
+	// Truncated toward zero, a split of -0.0004 s shows as 00:00.000
+	const bool negative = Ticks < 0;
+	const uint64 units = (negative ? 0 - uint64(Ticks) : uint64(Ticks)) / uint64(TicksPerUnit);
+	const bool show_negative = negative && units != 0;
+
+	int32 top_digits = 2;
+	for (uint64 top = units / UnitsPerTopUnit / 100; top; top /= 10) ++top_digits;
+
+	if (!bValid || show_negative != bNegative || top_digits != TopDigits)
+	{
+		Layout(top_digits, show_negative);
+
+		uint64 remaining = units;
+		for (int32 i = 0; i < NumDigits; ++i)
+		{
+			Buffer[DigitPositions[i]] = TCHAR(TEXT('0') + remaining % DigitRadices[i]);
+			remaining /= DigitRadices[i];
+		}
+
+		PreviousUnits = units;
+		bTextDirty = true;
+		return 0;
+	}
+
+	if (units == PreviousUnits) return INDEX_NONE;
+
+	// Once the higher parts match, every digit left of here is already right
+	uint64 current = units;
+	uint64 previous = PreviousUnits;
+	int32 first_changed = INDEX_NONE;
+	for (int32 i = 0; i < NumDigits && current != previous; ++i)
+	{
+		const uint32 digit = uint32(current % DigitRadices[i]);
+		if (digit != previous % DigitRadices[i])
+		{
+			Buffer[DigitPositions[i]] = TCHAR(TEXT('0') + digit);
+			first_changed = DigitPositions[i];
+		}
+		current /= DigitRadices[i];
+		previous /= DigitRadices[i];
+	}
+
+	PreviousUnits = units;
+	bTextDirty = true;
+	return first_changed;
+}
+
+int32 FTicTacToeRaceTimer::UpdateSeconds(double Seconds)
+{
+	// Converting NaN, infinities or values past int64 ticks to int64 is undefined
+	if (!FMath::IsFinite(Seconds)) return INDEX_NONE;
+
+	constexpr double MaxSeconds = double(MAX_int64 / ETimespan::TicksPerSecond);
+	return Update(int64(FMath::Clamp(Seconds, -MaxSeconds, MaxSeconds) * ETimespan::TicksPerSecond));
+}
+
+int32 FTicTacToeRaceTimer::CopyTo(TArrayView<TCHAR> Destination) const
+{
+	if (Destination.Num() == 0) return 0;
+
+	const int32 copied = FMath::Min(Length, Destination.Num() - 1);
+	FMemory::Memcpy(Destination.GetData(), Buffer, copied * sizeof(TCHAR));
+	Destination[copied] = TEXT('\0');
+	return copied;
+}
+
+const FText& FTicTacToeRaceTimer::ToText() const
+{
+	if (bTextDirty)
+	{
+		CachedText = FText::AsCultureInvariant(FString(Length, Buffer));
+		bTextDirty = false;
+	}
+	return CachedText;
+}
@@ -0,0 +1,138 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitReadout.h"
+#include "TicTacToeUnitPreferenceSubsystem.h"
+
+#define LOCTEXT_NAMESPACE "FTicTacToeUnitFormatModule"
+
+UTicTacToeUnitReadout::UTicTacToeUnitReadout()
+{
+	Font = FCoreStyle::GetDefaultFontStyle("Regular", 24);
+}
+
+void UTicTacToeUnitReadout::SetValue(double InValue)
+{
+	Value = InValue;
+	if (MyReadout.IsValid()) MyReadout->SetValue(InValue);
+}
+
+void UTicTacToeUnitReadout::SetFont(FSlateFontInfo InFont)
+{
+	Font = InFont;
+	if (MyReadout.IsValid()) MyReadout->SetFont(Font);
+}
+
+void UTicTacToeUnitReadout::SetColorAndOpacity(FSlateColor InColorAndOpacity)
+{
+	ColorAndOpacity = InColorAndOpacity;
+	if (MyReadout.IsValid()) MyReadout->SetColorAndOpacity(ColorAndOpacity);
+}
+
+void UTicTacToeUnitReadout::UpdateFormat()
+{
+	if (MyReadout.IsValid()) MyReadout->SetFormat(MakeFormat());
+}
+
+void UTicTacToeUnitReadout::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+
+	if (!MyReadout.IsValid()) return;
+
+	if (UseUnitPreferences) BindUnitPreferences();
+	else UnbindUnitPreferences();
+
+	MyReadout->SetFormat(MakeFormat());
+	MyReadout->SetFont(Font);
+	MyReadout->SetColorAndOpacity(ColorAndOpacity);
+	MyReadout->SetValue(Value);
+}
+
+void UTicTacToeUnitReadout::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	UnbindUnitPreferences();
+	MyReadout.Reset();
+}
+
+#if WITH_EDITOR
+const FText UTicTacToeUnitReadout::GetPaletteCategory()
+{
+	return LOCTEXT("ReadoutPaletteCategory", "TicTacToe UnitFormat");
+}
+#endif
+
+TSharedRef<SWidget> UTicTacToeUnitReadout::RebuildWidget()
+{
+	if (UseUnitPreferences) BindUnitPreferences();
+
+	MyReadout = SNew(STicTacToeUnitReadout)
+		.Value(Value)
+		.Format(MakeFormat())
+		.Font(Font)
+		.ColorAndOpacity(ColorAndOpacity);
+
+	return MyReadout.ToSharedRef();
+}
+
+FTicTacToeReadoutFormat UTicTacToeUnitReadout::MakeFormat() const
+{
+	FTicTacToeReadoutFormat Format;
+	Format.Family = Family;
+	Format.FromUnit = FromUnit;
+	Format.ToUnit = ToUnit;
+	Format.AutoUnit = AutoUnit;
+	Format.UseExtendedAutoUnits = UseExtendedAutoUnits;
+	Format.Precision = Precision;
+	Format.ForceSign = ForceSign;
+	Format.UseGrouping = UseGrouping;
+	Format.StableWidth = StableWidth;
+	Format.Notation = Notation;
+	Format.PerTime = PerTime;
+	Format.FromTimeUnit = FromTimeUnit;
+	Format.ToTimeUnit = ToTimeUnit;
+
+	if (const UTicTacToeUnitPreferenceSubsystem* Preferences = UseUnitPreferences ? BoundPreferences.Get() : nullptr)
+	{
+		if (PerTime && Family == EUnitFamily::UF_LENGTH)
+		{
+			ELengthUnit SpeedLengthUnit;
+			Preferences->GetSpeedUnits(SpeedLengthUnit, Format.ToTimeUnit);
+			Format.ToUnit = (uint8)SpeedLengthUnit;
+			Format.AutoUnit = 0;
+			Format.UseExtendedAutoUnits = false;
+		}
+		else
+		{
+			const FTicTacToeUnitOverride& Unit = Preferences->GetResolvedUnit(Family).Unit;
+			Format.ToUnit = Unit.ToUnit;
+			Format.AutoUnit = Unit.AutoUnit;
+			Format.UseExtendedAutoUnits = Unit.UseExtendedAutoUnits;
+		}
+	}
+	return Format;
+}
+
+void UTicTacToeUnitReadout::BindUnitPreferences()
+{
+	if (BoundPreferences.IsValid()) return;
+
+	if (UTicTacToeUnitPreferenceSubsystem* Preferences = UTicTacToeUnitPreferenceSubsystem::Get(this))
+	{
+		BoundPreferences = Preferences;
+		PreferencesChangedHandle = Preferences->OnPreferencesChangedNative().AddUObject(this, &UTicTacToeUnitReadout::UpdateFormat);
+	}
+}
+
+void UTicTacToeUnitReadout::UnbindUnitPreferences()
+{
+	if (UTicTacToeUnitPreferenceSubsystem* Preferences = BoundPreferences.Get())
+	{
+		Preferences->OnPreferencesChangedNative().Remove(PreferencesChangedHandle);
+	}
+	BoundPreferences.Reset();
+	PreferencesChangedHandle.Reset();
+}
+
+#undef LOCTEXT_NAMESPACE
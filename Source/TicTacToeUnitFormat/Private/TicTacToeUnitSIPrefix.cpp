@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitSIPrefix.h"
+#include "TicTacToeUnitCore.h"
+
+#define LOCTEXT_NAMESPACE "FTicTacToeUnitFormatModule"
+
+// Selection and the power of ten table live in TicTacToeUnitCore, whose EPrefix has the values of ESIPrefix
+static_assert(int32(ESIPrefix::SI_NONE) == int32(TicTacToeUnitCore::EPrefix::None));
+static_assert(int32(ESIPrefix::SI_QUETTA) + 1 == int32(TicTacToeUnitCore::EPrefix::Count));
+static_assert(FTicTacToeSIPrefix::EngineeringPrefixes == int32(TicTacToeUnitCore::EngineeringPrefixes));
+
+int32 FTicTacToeSIPrefix::GetDecimalExponent(double Value)
+{
+	return TicTacToeUnitCore::GetDecimalExponent(Value);
+}
+
+ESIPrefix FTicTacToeSIPrefix::Select(double Value, int32 AllowedPrefixes, int32 Power)
+{
+	return ESIPrefix(TicTacToeUnitCore::SelectPrefix(Value, uint32(AllowedPrefixes), Power));
+}
+
+int32 FTicTacToeSIPrefix::GetExponent(ESIPrefix Prefix)
+{
+	return TicTacToeUnitCore::GetPrefixExponent(TicTacToeUnitCore::EPrefix(Prefix));
+}
+
+double FTicTacToeSIPrefix::GetScale(ESIPrefix Prefix, int32 Power)
+{
+	return GetPowerOfTen(GetExponent(Prefix) * Power);
+}
+
+double FTicTacToeSIPrefix::GetPowerOfTen(int32 Exponent)
+{
+	return TicTacToeUnitCore::GetPowerOfTen(Exponent);
+}
+
+const FText& FTicTacToeSIPrefix::GetSymbol(ESIPrefix Prefix)
+{
+	static const FText Symbols[] =
+	{
+		LOCTEXT("SIPrefixQuecto", "q"),
+		LOCTEXT("SIPrefixRonto", "r"),
+		LOCTEXT("SIPrefixYocto", "y"),
+		LOCTEXT("SIPrefixZepto", "z"),
+		LOCTEXT("SIPrefixAtto", "a"),
+		LOCTEXT("SIPrefixFemto", "f"),
+		LOCTEXT("SIPrefixPico", "p"),
+		LOCTEXT("SIPrefixNano", "n"),
+		LOCTEXT("SIPrefixMicro", "µ"),
+		LOCTEXT("SIPrefixMilli", "m"),
+		LOCTEXT("SIPrefixCenti", "c"),
+		LOCTEXT("SIPrefixDeci", "d"),
+		FText::GetEmpty(),
+		LOCTEXT("SIPrefixDeca", "da"),
+		LOCTEXT("SIPrefixHecto", "h"),
+		LOCTEXT("SIPrefixKilo", "k"),
+		LOCTEXT("SIPrefixMega", "M"),
+		LOCTEXT("SIPrefixGiga", "G"),
+		LOCTEXT("SIPrefixTera", "T"),
+		LOCTEXT("SIPrefixPeta", "P"),
+		LOCTEXT("SIPrefixExa", "E"),
+		LOCTEXT("SIPrefixZetta", "Z"),
+		LOCTEXT("SIPrefixYotta", "Y"),
+		LOCTEXT("SIPrefixRonna", "R"),
+		LOCTEXT("SIPrefixQuetta", "Q"),
+	};
+
+	return uint8(Prefix) < UE_ARRAY_COUNT(Symbols) ? Symbols[uint8(Prefix)] : FText::GetEmpty();
+}
+
+#undef LOCTEXT_NAMESPACE
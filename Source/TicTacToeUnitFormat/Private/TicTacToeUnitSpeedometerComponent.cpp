@@ -0,0 +1,130 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitSpeedometerComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/TextBlock.h"
+#include "GameFramework/Actor.h"
+#include "TicTacToeUnitPreferenceSubsystem.h"
+
+UTicTacToeUnitSpeedometerComponent::UTicTacToeUnitSpeedometerComponent()
+{
+	// After physics, so movement components and simulated bodies have this frame's velocity
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = true;
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+}
+
+void UTicTacToeUnitSpeedometerComponent::SetVelocitySource(USceneComponent* Source)
+{
+	VelocitySource = Source;
+	if (HasBegunPlay()) Sample(false);
+}
+
+void UTicTacToeUnitSpeedometerComponent::BindTextBlock(UTextBlock* TextBlock)
+{
+	BoundTextBlock = TextBlock;
+	if (TextBlock) TextBlock->SetText(SpeedText);
+}
+
+void UTicTacToeUnitSpeedometerComponent::UpdateFormat()
+{
+	SetComponentTickInterval(SampleRate > 0.0f ? 1.0f / SampleRate : 0.0f);
+
+	if (UseUnitPreferences) BindUnitPreferences();
+	else UnbindUnitPreferences();
+
+	bEngineSpeed = true;
+	EngineSpeedUnit = Unit;
+	if (const UTicTacToeUnitPreferenceSubsystem* Preferences = UseUnitPreferences ? BoundPreferences.Get() : nullptr)
+	{
+		Preferences->GetSpeedUnits(LengthUnit, TimeUnit);
+		bEngineSpeed = UTicTacToeUnitFormatBPLibrary::GetEngineSpeedUnit(LengthUnit, TimeUnit, EngineSpeedUnit);
+	}
+
+	if (bEngineSpeed)
+	{
+		ToDisplay = TicTacToeUnitCore::EngineSpeedFromCmS[(int32)EngineSpeedUnit];
+	}
+	else
+	{
+		// Same composition as ConvertSpeed, the length pair over the reversed time pair
+		const FTicTacToeAffineTransform* Length = FTicTacToeAffine::Find(EUnitFamily::UF_LENGTH, (uint8)ELengthUnit::LU_MET_CM, (uint8)LengthUnit);
+		const FTicTacToeAffineTransform* Time = FTicTacToeAffine::Find(EUnitFamily::UF_TIME, (uint8)TimeUnit, (uint8)ETimeUnit::TU_SEC);
+		ToDisplay = Length && Time ? FTicTacToeAffineTransform{ Length->Numerator * Time->Numerator, 0.0, Length->Denominator * Time->Denominator } : FTicTacToeAffineTransform{ 0.0, 0.0, 1.0 };
+	}
+
+	StepScale = FMath::Pow(10.0, (double)FMath::Clamp(Precision, 0, 15));
+	Sample(true);
+}
+
+void UTicTacToeUnitSpeedometerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UpdateFormat();
+}
+
+void UTicTacToeUnitSpeedometerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindUnitPreferences();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTicTacToeUnitSpeedometerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	Sample(false);
+}
+
+void UTicTacToeUnitSpeedometerComponent::Sample(bool bForce)
+{
+	const USceneComponent* Source = VelocitySource.Get();
+	if (!Source && GetOwner()) Source = GetOwner()->GetRootComponent();
+
+	const FVector Velocity = Source ? Source->GetComponentVelocity() : FVector::ZeroVector;
+	const double EngineSpeed = IgnoreVertical ? Velocity.Size2D() : Velocity.Size();
+	Speed = ToDisplay.Apply(EngineSpeed);
+
+	// Rounded the way the text rounds it, only a different displayed value is formatted
+	const double Steps = FMath::RoundHalfToEven(Speed * StepScale);
+	if (!bForce && Steps == DisplayedSteps) return;
+	DisplayedSteps = Steps;
+
+	SpeedText = MakeSpeedText(EngineSpeed);
+	if (UTextBlock* TextBlock = BoundTextBlock.Get()) TextBlock->SetText(SpeedText);
+
+	SpeedTextChangedNative.Broadcast(SpeedText);
+	OnSpeedTextChanged.Broadcast(SpeedText);
+}
+
+FText UTicTacToeUnitSpeedometerComponent::MakeSpeedText(double EngineSpeed) const
+{
+	if (bEngineSpeed)
+		return UTicTacToeUnitFormatBPLibrary::FormatEngineSpeed(EngineSpeed, EngineSpeedUnit, Precision, false, UseGrouping, StableWidth);
+
+	return UTicTacToeUnitFormatBPLibrary::FormatSpeed(EngineSpeed, ELengthUnit::LU_MET_CM, LengthUnit, ETimeUnit::TU_SEC, TimeUnit,
+		EAutoUnitType::AUT_OFF, false, Precision, false, UseGrouping, StableWidth);
+}
+
+void UTicTacToeUnitSpeedometerComponent::BindUnitPreferences()
+{
+	if (BoundPreferences.IsValid()) return;
+
+	if (UTicTacToeUnitPreferenceSubsystem* Preferences = UTicTacToeUnitPreferenceSubsystem::Get(this))
+	{
+		BoundPreferences = Preferences;
+		PreferencesChangedHandle = Preferences->OnPreferencesChangedNative().AddUObject(this, &UTicTacToeUnitSpeedometerComponent::UpdateFormat);
+	}
+}
+
+void UTicTacToeUnitSpeedometerComponent::UnbindUnitPreferences()
+{
+	if (UTicTacToeUnitPreferenceSubsystem* Preferences = BoundPreferences.Get())
+	{
+		Preferences->OnPreferencesChangedNative().Remove(PreferencesChangedHandle);
+	}
+	BoundPreferences.Reset();
+	PreferencesChangedHandle.Reset();
+}
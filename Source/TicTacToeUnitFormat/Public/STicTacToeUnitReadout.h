@@ -0,0 +1,122 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "Fonts/SlateFontInfo.h"
+#include "Fonts/FontCache.h"
+#include "Styling/CoreStyle.h"
+#include "Styling/SlateColor.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+
+// What a readout displays, same meaning as the parameters of the Format functions
+struct FTicTacToeReadoutFormat
+{
+	EUnitFamily Family = EUnitFamily::UF_LENGTH;
+
+	// Underlying values of the family's unit enums
+	uint8 FromUnit = 0;
+	uint8 ToUnit = 0;
+	uint8 AutoUnit = 0;
+
+	bool UseExtendedAutoUnits = false;
+	int32 Precision = 1;
+	bool ForceSign = false;
+	bool UseGrouping = false;
+
+	// As in the Format functions: StableWidth pads number and suffix with figure spaces, Precision is the number
+	// of significant digits in significant and engineering notation
+	int32 StableWidth = 0;
+	ENumberNotation Notation = ENumberNotation::NN_FIXED;
+
+	// Length only: the value is a speed in FromUnit per FromTimeUnit, displayed per ToTimeUnit
+	bool PerTime = false;
+	ETimeUnit FromTimeUnit = ETimeUnit::TU_SEC;
+	ETimeUnit ToTimeUnit = ETimeUnit::TU_SEC;
+};
+
+/*
+*	Numeric readout for values that change every frame (speed, altitude, fuel...).
+*
+*	A text block shapes its whole string again whenever the value changes. This widget shapes the digits,
+*	separators, signs and every suffix of its family once per font, scale and culture, then builds the glyph
+*	run of a new value by copying the cached glyphs. Conversion, auto unit and rounding are the library's.
+*
+*	Changing the value only repaints, unless the width of the text changes.
+*/
+class TICTACTOEUNITFORMAT_API STicTacToeUnitReadout : public SLeafWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(STicTacToeUnitReadout)
+		: _Value(0.0)
+		, _Font(FCoreStyle::GetDefaultFontStyle("Regular", 24))
+		, _ColorAndOpacity(FSlateColor::UseForeground())
+	{}
+		SLATE_ARGUMENT(double, Value)
+		SLATE_ARGUMENT(FTicTacToeReadoutFormat, Format)
+		SLATE_ARGUMENT(FSlateFontInfo, Font)
+		SLATE_ATTRIBUTE(FSlateColor, ColorAndOpacity)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	void SetValue(double InValue);
+	void SetFormat(const FTicTacToeReadoutFormat& InFormat);
+	void SetFont(const FSlateFontInfo& InFont);
+	void SetColorAndOpacity(const TAttribute<FSlateColor>& InColorAndOpacity);
+
+	const FString& GetDisplayString() const { return DisplayString; }
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+protected:
+
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+
+	struct FGlyphRun
+	{
+		TArray<FShapedGlyphEntry> Glyphs;
+		int32 NumCharacters = 0;
+	};
+
+	// Formats Value into NumberString and SuffixString, true when the displayed text changed
+	bool UpdateDisplayString();
+
+	// Drops every shaped glyph, for font, culture or scale changes
+	void ResetGlyphCache();
+
+	void ShapeGlyphCache(float Scale) const;
+	FGlyphRun ShapeRun(const FString& Token) const;
+	const FGlyphRun& FindOrShapeRun(TCHAR Character) const;
+	const FGlyphRun& FindOrShapeRun(const FString& Suffix) const;
+	void BuildSequence() const;
+
+	// Invalidates paint only when the text keeps its width
+	void InvalidateDisplay(bool bDisplayChanged);
+
+	void HandleCultureChanged();
+
+	double Value = 0.0;
+	FTicTacToeReadoutFormat Format;
+	FSlateFontInfo Font;
+	TAttribute<FSlateColor> ColorAndOpacity;
+
+	FString NumberString;
+	FString SuffixString;
+	FString DisplayString;
+
+	// Shaped at CachedScale, 0 when nothing is shaped yet
+	mutable TMap<TCHAR, FGlyphRun> CharacterRuns;
+	mutable TMap<FString, FGlyphRun> SuffixRuns;
+	mutable float CachedScale = 0.0f;
+	mutable int16 TextBaseline = 0;
+	mutable uint16 MaxTextHeight = 0;
+
+	mutable TSharedPtr<const FShapedGlyphSequence> Sequence;
+	mutable FVector2D SequenceSize = FVector2D::ZeroVector;
+	mutable bool bSequenceDirty = true;
+};
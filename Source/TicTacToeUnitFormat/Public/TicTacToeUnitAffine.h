@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitCore.h"
+
+// To = (From * Numerator + Offset) / Denominator
+using FTicTacToeAffineTransform = TicTacToeUnitCore::FAffineTransform;
+
+/*
+*	Conversions between units related by a scale and an offset: temperatures, gauge and absolute pressures,
+*	and every linear family as the offset-free case.
+*
+*	Temperature and pressure units are defined as exact rationals (K = F * 5/9 + 45967/180, Pa = psig *
+*	8896443230521/1290320000 + 101325...). Every unit pair of those families is composed in rational arithmetic
+*	when the module starts (TicTacToeUnitCore::Compose) and stored over a common denominator (C to F is (C * 9 + 160) / 5), so a conversion
+*	is a multiply, an add and a single division. Small integer inputs are converted with one rounding only:
+*	100 C is exactly 212 F, -40 C is -40 F and 0 psig is 101325 Pa. Round trips come back exact for whole
+*	degrees C through F, tenths of a degree between C and K and tenths of a bar gauge through Pa; adding an
+*	offset that is not a double (1.01325 bar) cannot be undone exactly for every value, so other pairs may not.
+*
+*	Linear families keep their double tables, the transform is (Value * FromFactor) / ToFactor as before. The
+*	factors of the derived families (power, flow...) are products of base table entries, see FTicTacToeDerivedUnits.
+*/
+struct TICTACTOEUNITFORMAT_API FTicTacToeAffine
+{
+	// Composes the unit pair tables, called at module startup. Lookups build them on first use otherwise.
+	static void Initialize();
+
+	// Null when either unit is not part of the family
+	static const FTicTacToeAffineTransform* Find(EUnitFamily Family, uint8 FromUnit, uint8 ToUnit);
+
+	static const FTicTacToeAffineTransform* Find(ETemperatureUnit FromUnit, ETemperatureUnit ToUnit) { return Find(EUnitFamily::UF_TEMPERATURE, (uint8)FromUnit, (uint8)ToUnit); }
+	static const FTicTacToeAffineTransform* Find(EPressureUnit FromUnit, EPressureUnit ToUnit) { return Find(EUnitFamily::UF_PRESSURE, (uint8)FromUnit, (uint8)ToUnit); }
+	static const FTicTacToeAffineTransform* Find(EPowerUnit FromUnit, EPowerUnit ToUnit) { return Find(EUnitFamily::UF_POWER, (uint8)FromUnit, (uint8)ToUnit); }
+	static const FTicTacToeAffineTransform* Find(EFlowUnit FromUnit, EFlowUnit ToUnit) { return Find(EUnitFamily::UF_FLOW, (uint8)FromUnit, (uint8)ToUnit); }
+	static const FTicTacToeAffineTransform* Find(EDensityUnit FromUnit, EDensityUnit ToUnit) { return Find(EUnitFamily::UF_DENSITY, (uint8)FromUnit, (uint8)ToUnit); }
+	static const FTicTacToeAffineTransform* Find(EAccelerationUnit FromUnit, EAccelerationUnit ToUnit) { return Find(EUnitFamily::UF_ACCELERATION, (uint8)FromUnit, (uint8)ToUnit); }
+	static const FTicTacToeAffineTransform* Find(ETorqueUnit FromUnit, ETorqueUnit ToUnit) { return Find(EUnitFamily::UF_TORQUE, (uint8)FromUnit, (uint8)ToUnit); }
+	static const FTicTacToeAffineTransform* Find(EDataSizeUnit FromUnit, EDataSizeUnit ToUnit) { return Find(EUnitFamily::UF_DATA_SIZE, (uint8)FromUnit, (uint8)ToUnit); }
+	static const FTicTacToeAffineTransform* Find(EDataRateUnit FromUnit, EDataRateUnit ToUnit) { return Find(EUnitFamily::UF_DATA_RATE, (uint8)FromUnit, (uint8)ToUnit); }
+
+	// 4-wide batch version of FTicTacToeAffineTransform::Apply, with the same result per value. Values and OutValues may alias.
+	static void Apply(TArrayView<const double> Values, const FTicTacToeAffineTransform& Transform, TArrayView<double> OutValues);
+
+	static void Apply(TArrayView<double> Values, const FTicTacToeAffineTransform& Transform) { Apply(Values, Transform, Values); }
+};
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitAxis.generated.h"
+
+class UTicTacToeUnitPreferenceSubsystem;
+
+// Ticks of a chart axis, all displayed in one unit with one precision
+USTRUCT(BlueprintType)
+struct TICTACTOEUNITFORMAT_API FTicTacToeAxisTicks
+{
+	GENERATED_BODY()
+
+	// Tick positions in the unit the range was given in
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	TArray<double> Values;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	TArray<FText> Labels;
+
+	// Underlying value of the family's unit enum every label is displayed in
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	uint8 DisplayUnit = 0;
+
+	// Distance between two ticks in the display unit, 1, 2 or 5 x 10^n
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	double Step = 0.0;
+
+	// Fractional digits of every label
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	int32 Precision = 0;
+};
+
+/*
+*	"Nice" axis ticks for telemetry graphs and stat charts.
+*
+*	The display unit is picked once for the whole range, from its largest magnitude, so the auto unit cannot
+*	switch between ticks. Ticks are multiples of a 1, 2 or 5 x 10^n step of that unit, computed as integer
+*	multiples of the step's mantissa over an exact power of ten so 0.1 steps print as 0.3 and not 0.30000000000000004.
+*	The precision is the smallest that tells ticks apart (-n when n < 0) and labels are formatted in one batch with
+*	shared number options and unit string, trailing zeros kept so every label has the same digits.
+*
+*	Offset units (temperature, gauge pressure) get nice ticks in the display unit, the positions are mapped
+*	back to the source unit exactly.
+*/
+struct TICTACTOEUNITFORMAT_API FTicTacToeUnitAxis
+{
+	// Nice step for at most MaxTicks ticks over Range, as Mantissa (1, 2 or 5) x 10^Exponent
+	static void GetNiceStep(double Range, int32 MaxTicks, int32& OutMantissa, int32& OutExponent);
+
+	// Empty when the range is not finite or a unit is not part of the family
+	static FTicTacToeAxisTicks MakeTicks(double Min, double Max, EUnitFamily Family, uint8 FromUnit, uint8 ToUnit, uint8 AutoUnit = 0, bool UseExtendedAutoUnits = false,
+		int32 MaxTicks = 6, bool ForceSign = false, bool UseGrouping = false);
+
+	// Display unit from the player's preferences for the family
+	static FTicTacToeAxisTicks MakeTicks(double Min, double Max, EUnitFamily Family, uint8 FromUnit, const UTicTacToeUnitPreferenceSubsystem& Preferences,
+		int32 MaxTicks = 6, bool ForceSign = false, bool UseGrouping = false);
+};
+
+UCLASS()
+class TICTACTOEUNITFORMAT_API UTicTacToeUnitAxisLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Ticks between min and max, in toUnit or the auto unit of the largest value. Units are the underlying value of the family's unit enum.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "7"), Category = "TicTacToe UnitFormat")
+	static FTicTacToeAxisTicks MakeAxisTicks(double min, double max, EUnitFamily family, uint8 fromUnit, uint8 toUnit, uint8 AutoUnit = 0, bool UseExtendedAutoUnits = false,
+		int32 MaxTicks = 6, bool ForceSign = false, bool UseGrouping = false);
+
+	// Ticks in the player's units of WorldContextObject's game instance, in fromUnit's family defaults without a preference subsystem
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", WorldContext = "WorldContextObject", AdvancedDisplay = "5"), Category = "TicTacToe UnitFormat")
+	static FTicTacToeAxisTicks MakePreferredAxisTicks(const UObject* WorldContextObject, double min, double max, EUnitFamily family, uint8 fromUnit,
+		int32 MaxTicks = 6, bool ForceSign = false, bool UseGrouping = false);
+};
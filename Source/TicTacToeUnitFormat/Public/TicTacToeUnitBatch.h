@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "TicTacToeUnitQuantity.h"
+#include "TicTacToeUnitBatch.generated.h"
+
+// Statistics of a list of values, entries with an unknown unit are skipped
+USTRUCT(BlueprintType)
+struct TICTACTOEUNITFORMAT_API FTicTacToeUnitAggregate
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	double Sum = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	double Min = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	double Max = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	double Mean = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	int32 Count = 0;
+};
+
+/*
+*	Operations on lists of values authored in different units of one family (inventory weights, cargo volumes...).
+*
+*	Canonicalize brings every value to the family's canonical unit in a single pass: the affine transform of
+*	every unit is looked up once per call into a flat table indexed by unit, so the loop has no map lookup or
+*	branch per entry. Values with a unit the family does not have become NaN.
+*
+*	Canonical values are then sorted by key, a double mapped to an unsigned integer with the same order, with a
+*	stable LSD radix sort that skips the byte passes where every key agrees. NaN always sorts last.
+*
+*	Sums use Neumaier compensated summation, so totals of many small items next to a few large ones stay exact to
+*	the last bit a double can hold.
+*/
+struct TICTACTOEUNITFORMAT_API FTicTacToeUnitBatch
+{
+	// Unit the conversion tables of the family are expressed in (meter, kilogram, cubic meter...)
+	static uint8 GetCanonicalUnit(EUnitFamily Family);
+
+	// False when the views differ in size or any unit is unknown, in which case the matching outputs are NaN
+	static bool Canonicalize(EUnitFamily Family, TArrayView<const double> Values, TArrayView<const uint8> Units, TArrayView<double> OutValues);
+
+	// Quantities of another family count as unknown units
+	static bool Canonicalize(EUnitFamily Family, TArrayView<const FTicTacToeQuantity> Quantities, TArrayView<double> OutValues);
+
+	// Unsigned key with the order of the value, -0 and +0 share a key and NaN is above everything
+	static uint64 GetSortKey(double Value);
+
+	static void GetSortKeys(TArrayView<const double> Values, TArrayView<uint64> OutKeys);
+
+	// Permutation that sorts Values, stable so equal values keep their list order
+	static void SortIndices(TArrayView<const double> Values, TArray<int32>& OutOrder, bool bDescending = false);
+
+	static double Sum(TArrayView<const double> Values);
+
+	static FTicTacToeUnitAggregate Aggregate(TArrayView<const double> Values);
+};
+
+UCLASS()
+class TICTACTOEUNITFORMAT_API UTicTacToeUnitBatchLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Values of every quantity in the family's canonical unit, false when some had another family or an unknown unit
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static bool CanonicalizeQuantities(const TArray<FTicTacToeQuantity>& quantities, EUnitFamily family, TArray<double>& OutValues);
+
+	// Indices of the quantities in sorted order, for sorting item lists by weight or volume whatever unit they were authored in
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static void SortQuantities(const TArray<FTicTacToeQuantity>& quantities, EUnitFamily family, bool Descending, TArray<int32>& OutOrder);
+
+	// Sum, min, max and mean in toUnit. The sum of an offset unit (temperature) is not meaningful.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static FTicTacToeUnitAggregate AggregateQuantities(const TArray<FTicTacToeQuantity>& quantities, EUnitFamily family, uint8 toUnit);
+};
@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TicTacToeUnitAffine.h"
+
+/*
+*	Large arrays of one family (per cell pressure, per node flow...) kept in their source unit and read in a view unit.
+*
+*	Values are never rewritten when the view unit changes: SetViewUnit only swaps the composed source to view
+*	transform, one FTicTacToeAffine table read, and values are converted when they are read. Get converts a single
+*	value, CopyValues and ForEachBlock convert runs with the 4-wide FTicTacToeAffine::Apply, ForEachBlock into a
+*	stack buffer of BlockSize values so iterating a column never allocates. Set writes a view value back through
+*	the inverse transform.
+*
+*	FormatValues formats a run in the view unit, converting it block by block before formatting.
+*/
+class TICTACTOEUNITFORMAT_API FTicTacToeUnitColumn
+{
+public:
+
+	static constexpr int32 BlockSize = 256;
+
+	FTicTacToeUnitColumn() = default;
+
+	// The view unit starts as the source unit, which has to be a unit of the family
+	FTicTacToeUnitColumn(EUnitFamily InFamily, uint8 InSourceUnit);
+
+	// No value is converted. False when the unit is not part of the family, in which case the view unit is kept.
+	bool SetViewUnit(uint8 InViewUnit);
+
+	EUnitFamily GetFamily() const { return Family; }
+
+	uint8 GetSourceUnit() const { return SourceUnit; }
+
+	uint8 GetViewUnit() const { return ViewUnit; }
+
+	const FTicTacToeAffineTransform& GetViewTransform() const { return ToView; }
+
+	// --- --- SOURCE VALUES --- --- //
+
+	int32 Num() const { return Values.Num(); }
+
+	// New values are zeros
+	void SetNum(int32 NewNum) { Values.SetNumZeroed(NewNum); }
+
+	int32 Add(double SourceValue) { return Values.Add(SourceValue); }
+
+	void SetSourceValues(TArrayView<const double> InValues);
+
+	// Raw storage in the source unit, for simulation code writing in place
+	TArray<double>& GetSourceValues() { return Values; }
+
+	const TArray<double>& GetSourceValues() const { return Values; }
+
+	// --- --- VIEW VALUES --- --- //
+
+	double Get(int32 Index) const { return ToView.Apply(Values[Index]); }
+
+	void Set(int32 Index, double ViewValue) { Values[Index] = ToSource.Apply(ViewValue); }
+
+	// Values [Start, Start + OutValues.Num()) in the view unit
+	void CopyValues(int32 Start, TArrayView<double> OutValues) const;
+
+	// Calls Visitor(Start, Block) on consecutive blocks of at most BlockSize values in the view unit
+	template<typename VisitorType>
+	void ForEachBlock(VisitorType&& Visitor) const
+	{
+		double Block[BlockSize];
+		for (int32 Start = 0; Start < Values.Num(); Start += BlockSize)
+		{
+			const TArrayView<double> View(Block, FMath::Min(BlockSize, Values.Num() - Start));
+			CopyValues(Start, View);
+			Visitor(Start, TArrayView<const double>(View));
+		}
+	}
+
+	// --- --- FORMATTING --- --- //
+
+	FText Format(int32 Index, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED) const;
+
+	// Texts of values [Start, Start + Count) in the view unit, clamped to the column, appended to OutTexts
+	void FormatValues(int32 Start, int32 Count, TArray<FText>& OutTexts, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED) const;
+
+private:
+
+	EUnitFamily Family = EUnitFamily::UF_LENGTH;
+	uint8 SourceUnit = 0;
+	uint8 ViewUnit = 0;
+
+	FTicTacToeAffineTransform ToView;
+	FTicTacToeAffineTransform ToSource;
+
+	TArray<double> Values;
+};
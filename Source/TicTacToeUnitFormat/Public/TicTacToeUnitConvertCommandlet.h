@@ -0,0 +1,39 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "TicTacToeUnitConvertCommandlet.generated.h"
+
+/*
+*	Headless converter for large telemetry exports stored in engine units.
+*
+*	UnrealEditor-Cmd <Project> -run=TicTacToeUnitConvert -in=<file> -out=<file> -columns=<spec>[,<spec>...]
+*		[-format=csv|f64|f32] [-stride=<values per record>] [-noheader] [-digits=<1-17>] [-chunkmb=16] [-threads=<n>]
+*
+*	A column spec is <index>:<family>:<fromUnit>:<toUnit>, using the unit enum names, with each index given at most once.
+*	Speed takes a length/time pair:
+*		2:length:LU_MET_CM:LU_MET_M
+*		5:speed:LU_MET_CM/TU_SEC:LU_MET_KM/TU_HR
+*		7:weight:WU_MET_KG:WU_US_LB
+*		9:temperature:TU_KEL:TU_CEL
+*
+*	CSV values are written with the fewest digits that read back as the same double. -digits prints that many
+*	significant digits instead, -digits=17 every digit of the double whether or not it is noise.
+*
+*	Binary inputs are headerless row-major records of -stride values; a single column dump is -stride=1.
+*	The input is mapped (or read, when the platform cannot map it) one chunk at a time and the output
+*	is written as each chunk completes, so memory use depends on -chunkmb and not on the file size.
+*	Any failed read or write returns 1.
+*/
+UCLASS()
+class UTicTacToeUnitConvertCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UTicTacToeUnitConvertCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
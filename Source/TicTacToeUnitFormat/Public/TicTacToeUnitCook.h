@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitCook.generated.h"
+
+// Source and runtime unit of a DataTable column, a CurveTable row or a CurveFloat
+USTRUCT(BlueprintType)
+struct TICTACTOEUNITFORMAT_API FTicTacToeUnitCookRule
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "TicTacToe UnitFormat", meta = (AllowedClasses = "/Script/Engine.DataTable, /Script/Engine.CurveTable, /Script/Engine.CurveFloat"))
+	FSoftObjectPath Asset;
+
+	// DataTable: float or double property of the row struct. CurveTable: row name, None for every row. CurveFloat: unused.
+	UPROPERTY(EditAnywhere, Category = "TicTacToe UnitFormat")
+	FName Column;
+
+	UPROPERTY(EditAnywhere, Category = "TicTacToe UnitFormat")
+	EUnitFamily Family = EUnitFamily::UF_LENGTH;
+
+	// Underlying value of the family's unit enum the designers author in, e.g. (uint8)EWeightUnit::WU_US_LB
+	UPROPERTY(EditAnywhere, Category = "TicTacToe UnitFormat")
+	uint8 AuthoredUnit = 0;
+
+	// Underlying value of the family's unit enum the game code reads, e.g. (uint8)EWeightUnit::WU_MET_KG
+	UPROPERTY(EditAnywhere, Category = "TicTacToe UnitFormat")
+	uint8 RuntimeUnit = 0;
+};
+
+/*
+*	Balance data authored in any unit and cooked in the unit the game reads.
+*
+*	Each rule tags a DataTable column, CurveTable row or CurveFloat with its authored and runtime unit. When a
+*	tagged asset is saved for cooking, its values are converted in bulk right before the save (curve keys,
+*	tangents and default values included) and the authored values are put back once the package is written,
+*	so cooked data is already in runtime units and the editor keeps showing the authored ones.
+*
+*	Game code reads tagged values through ToRuntimeUnit, which returns them untouched in cooked builds and
+*	converts them in the editor, where the data is still authored.
+*/
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "TicTacToe Unit Cook"))
+class TICTACTOEUNITFORMAT_API UTicTacToeUnitCookSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(config, EditAnywhere, Category = "TicTacToe UnitFormat")
+	TArray<FTicTacToeUnitCookRule> Rules;
+
+	// Rule of a DataTable column or CurveTable row, the CurveTable rule for every row when there is none for the row
+	const FTicTacToeUnitCookRule* FindRule(const UObject* Asset, FName Column) const;
+
+	// Value read from a tagged column, in its runtime unit
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static double ToRuntimeUnit(const UObject* Asset, FName Column, double Value);
+
+	// Registers the cook hooks, called at module startup
+	static void Initialize();
+	static void Shutdown();
+};
@@ -0,0 +1,1003 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// Standard library only, so tools outside the engine can include this header as is (C++20)
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <string>
+
+/*
+*	Engine independent core of the plugin: unit tables, conversions, auto unit ladders, SI prefix selection
+*	and a culture invariant number formatter.
+*
+*	The enums follow the order of the module's UENUMs (ELengthUnit, EAutoUnitType, ESIPrefix...) and are checked
+*	against them at compile time, so a unit is the same number on both sides. The module reads its tables and
+*	ladders from here and adds what needs the engine: FText and culture aware formatting, Blueprint nodes, the
+*	cached unit pair tables and the batch kernels.
+*/
+namespace TicTacToeUnitCore
+{
+	// --- --- UNITS --- --- //
+
+	enum class EFamily : uint8_t { Length, Weight, Volume, Area, Temperature, Time, Pressure, Energy, Angle, Power, Flow, Density, Acceleration, Torque, DataSize, DataRate, Count };
+
+	// EAutoUnitType, EAutoPressureUnitType uses the first two
+	enum class EAutoSystem : uint8_t { Off, Metric, ImperialUS };
+
+	enum class EAutoVolume : uint8_t { Off, Metric, MetricFluid, Imperial, ImperialFluid };
+
+	enum class EAutoEnergy : uint8_t { Off, Joules, WattHour };
+
+	// EAutoDataUnitType
+	enum class EAutoData : uint8_t { Off, Decimal, Binary, DecimalBits };
+
+	// ENumberNotation
+	enum class ENotation : uint8_t { Fixed, Significant, Engineering, Count };
+
+	enum class ELength : uint8_t
+	{
+		MET_MM, MET_CM, MET_DM, MET_M, MET_DAM, MET_HM, MET_KM,
+		US_TWIP, US_MIL, US_POINT, US_PICA, US_INCH, US_FOOT, US_YARD, US_MILE, US_LEAGUE,
+		BRIT_THOU, BRIT_BARLEYCORN, BRIT_IN, BRIT_HH, BRIT_FT, BRIT_YD, BRIT_CH, BRIT_FUR, BRIT_MI, BRIT_LEA,
+		BRIT_FTM, BRIT_CABLE, BRIT_NMI,
+		Count
+	};
+
+	enum class EWeight : uint8_t
+	{
+		MET_MG, MET_CG, MET_G, MET_DG, MET_HG, MET_KG, MET_TON,
+		US_GR, US_DR, US_OZ, US_LB, US_CWT_S, US_CWT_L, US_TON_S, US_TON_L,
+		BRIT_GR, BRIT_DR, BRIT_OZ, BRIT_LB, BRIT_ST, BRIT_QR, BRIT_CWT, BRIT_TON,
+		BRIT_SLUG,
+		Count
+	};
+
+	enum class EVolume : uint8_t
+	{
+		MET_ML, MET_CL, MET_DL, MET_L, MET_DAL, MET_HL, MET_KL,
+		MET_MM3, MET_CM3, MET_DM3, MET_M3, MET_DAM3, MET_HM3, MET_KM3,
+		BRIT_FLOZ, BRIT_GI, BRIT_PT, BRIT_QT, BRIT_GAL,
+		US_MIN, US_FLDR, US_TSP, US_TBSP, US_FLOZ, US_JIG, US_GI, US_C, US_PT, US_QT, US_POT, US_GAL, US_BBL, US_OILBBL, US_HOGSHEAD,
+		US_IN3, US_FT3, US_YD3, US_ACREFT,
+		Count
+	};
+
+	enum class EArea : uint8_t
+	{
+		MET_MM2, MET_CM2, MET_DM2, MET_M2, MET_DAM2, MET_HM2, MET_HA, MET_KM2,
+		US_SQIN, US_SQFT, US_SQYD, US_SQCH, US_ACRE, US_SEC, US_TWP,
+		Count
+	};
+
+	enum class ETemperature : uint8_t { CEL, FAR, KEL, Count };
+
+	enum class ETime : uint8_t { SEC, MIN, HR, DAY, MO, YR, Count };
+
+	enum class EPressure : uint8_t
+	{
+		MET_MILIPA, MET_CPA, MET_DPA, MET_PA, MET_DAPA, MET_HPA, MET_KPA, MET_BAR, MET_MPA, MET_GPA,
+		MET_PSI,
+		MET_BARG, US_PSIG,
+		Count
+	};
+
+	enum class EEnergy : uint8_t { UJ, MILIJ, J, KJ, MJ, WH, KWH, MWH, CAL, KCAL, Count };
+
+	enum class EAngle : uint8_t { DEG, RAD, MOA, MILIR, MIL_OTAN, MIL_RU, MIL_SU, Count };
+
+	enum class EPower : uint8_t { MET_MILIW, MET_W, MET_KW, MET_MW, MET_GW, MET_PS, US_FTLBF_S, US_HP, Count };
+
+	enum class EFlow : uint8_t { MET_ML_S, MET_L_S, MET_L_MIN, MET_L_H, MET_M3_S, MET_M3_H, US_GAL_MIN, US_GAL_H, US_FT3_S, US_FT3_MIN, Count };
+
+	enum class EDensity : uint8_t { MET_G_M3, MET_KG_M3, MET_G_CM3, MET_G_L, MET_KG_L, US_LB_FT3, US_LB_IN3, US_LB_GAL, Count };
+
+	enum class EAcceleration : uint8_t { MET_MM_S2, MET_CM_S2, MET_M_S2, G, US_IN_S2, US_FT_S2, Count };
+
+	enum class ETorque : uint8_t { MET_N_CM, MET_N_M, MET_KN_M, MET_KGF_M, US_LBF_IN, US_LBF_FT, Count };
+
+	// Sizes and rates share one layout, a rate unit is the size unit per second
+	enum class EDataSize : uint8_t { BIT, KBIT, MBIT, GBIT, TBIT, BYTE, KB, MB, GB, TB, PB, KIB, MIB, GIB, TIB, PIB, Count };
+
+	enum class EDataRate : uint8_t { BIT_S, KBIT_S, MBIT_S, GBIT_S, TBIT_S, BYTE_S, KB_S, MB_S, GB_S, TB_S, PB_S, KIB_S, MIB_S, GIB_S, TIB_S, PIB_S, Count };
+
+	// Speed displays of engine velocities, which are in cm/s
+	enum class EEngineSpeed : uint8_t { KM_H, MI_H, KN, M_S, Count };
+
+	// --- --- FACTORS --- --- //
+
+	// Size of one unit in the canonical unit of its family, indexed by unit
+	inline constexpr double LengthToM[] =
+	{
+		// Metric
+		0.001, 0.01, 0.1, 1.0, 10.0, 100.0, 1000.0,
+		// Imperial USA
+		0.0000017638, 0.00000254, 0.00003527, 0.00423, 0.0254, 0.3048, 0.9144, 1609.344, 4828.032,
+		// Imperial British
+		0.00000254, 0.00846, 0.0254, 0.1016, 0.3048, 0.9144, 20.1168, 201.168, 1609.344, 4828.032,
+		// Maritime British
+		1.852, 185.2, 1852.0,
+	};
+
+	inline constexpr double WeightToKg[] =
+	{
+		// Metric
+		0.00001, 0.0001, 0.001, 0.01, 0.1, 1.0, 1000.0,
+		// Imperial US
+		0.00006479891, 0.0017718451953125, 0.028349523125, 0.45359237, 45.359237, 50.80234544, 907.18474, 1016.0469088,
+		// Imperial British
+		0.00006479891, 0.0017718451953125, 0.028349523125, 0.45359237, 6.35029318, 12.70058636, 50.80234544, 1016.0469088,
+		// Other
+		14.59390294,
+	};
+
+	inline constexpr double VolumeToM3[] =
+	{
+		// Metric fluid
+		0.000001, 0.00001, 0.0001, 0.001, 0.010, 0.1, 1.0,
+		// Metric
+		0.000000001, 0.000001, 0.001, 1.0, 1000.0, 1000000.0, 1000000000.0,
+		// Imperial british fluid
+		0.000029574, 0.000118294, 0.000473176, 0.0011365225, 0.00454609,
+		// Imperial US fluid
+		0.000000061611519921875, 0.0000036966911953125, 0.00000492892159375, 0.00001478676478125, 0.0000295735295625,
+		0.00004436029434375, 0.00011829411825, 0.0002365882365, 0.0004731764773, 0.000946352946, 0.001892705892,
+		0.003785411784, 0.119240471196, 0.158987294928, 0.238480942392,
+		// Imperial US
+		0.000016387064, 0.028316846592, 0.764554857984, 1233.482,
+	};
+
+	inline constexpr double AreaToM2[] =
+	{
+		// Metric
+		0.000001, 0.0001, 0.01, 1.0, 100.0, 10000.0, 1000000.0, 100000000.0,
+		// Imperial US
+		0.00064516, 0.09290304, 0.83612736, 404.68564224, 4046.8564224, 258999800.0, 9323993000.0,
+	};
+
+	// Months are 30 days and years 365 days
+	inline constexpr double TimeToS[] = { 1.0, 60.0, 3600.0, 86400.0, 2592000.0, 31536000.0 };
+
+	// Linear units only, the gauge units that follow have an offset
+	inline constexpr double PressureToPa[] =
+	{
+		// Metric
+		0.001, 0.01, 0.1, 1.0, 10.0, 100.0, 1000.0, 100000.0, 1000000.0, 1000000000.0,
+		// Imperial (US)
+		6894.757293168362,
+	};
+
+	inline constexpr double EnergyToJ[] =
+	{
+		// Joules
+		0.000001, 0.001, 1.0, 1000.0, 1000000.0,
+		// Watt-hour
+		3600.0, 3600000.0, 3600000000.0,
+		// Calorie
+		0.0, 0.0,
+	};
+
+	inline constexpr double AngleToDeg[] = { 1.0, 57.2958, 0.016666666666666, 0.0572958, 0.05625, 0.06, 0.057143 };
+
+	// Every factor is exact in a double, rates use the same table per second
+	inline constexpr double DataSizeToByte[] =
+	{
+		// Bits
+		0.125, 125.0, 125000.0, 125000000.0, 125000000000.0,
+		// Bytes, SI
+		1.0, 1000.0, 1000000.0, 1000000000.0, 1000000000000.0, 1000000000000000.0,
+		// Bytes, IEC
+		1024.0, 1048576.0, 1073741824.0, 1099511627776.0, 1125899906842624.0,
+	};
+
+	static_assert(std::size(LengthToM) == size_t(ELength::Count));
+	static_assert(std::size(WeightToKg) == size_t(EWeight::Count));
+	static_assert(std::size(VolumeToM3) == size_t(EVolume::Count));
+	static_assert(std::size(AreaToM2) == size_t(EArea::Count));
+	static_assert(std::size(TimeToS) == size_t(ETime::Count));
+	static_assert(std::size(PressureToPa) == size_t(EPressure::MET_PSI) + 1);
+	static_assert(std::size(EnergyToJ) == size_t(EEnergy::Count));
+	static_assert(std::size(AngleToDeg) == size_t(EAngle::Count));
+	static_assert(std::size(DataSizeToByte) == size_t(EDataSize::Count));
+	static_assert(size_t(EDataRate::Count) == size_t(EDataSize::Count));
+
+	// Number of units of a family's enum, 0 for an unknown family
+	constexpr uint8_t GetUnitCount(EFamily Family)
+	{
+		switch (Family)
+		{
+		case EFamily::Length:		return uint8_t(ELength::Count);
+		case EFamily::Weight:		return uint8_t(EWeight::Count);
+		case EFamily::Volume:		return uint8_t(EVolume::Count);
+		case EFamily::Area:			return uint8_t(EArea::Count);
+		case EFamily::Temperature:	return uint8_t(ETemperature::Count);
+		case EFamily::Time:			return uint8_t(ETime::Count);
+		case EFamily::Pressure:		return uint8_t(EPressure::Count);
+		case EFamily::Energy:		return uint8_t(EEnergy::Count);
+		case EFamily::Angle:		return uint8_t(EAngle::Count);
+		case EFamily::Power:		return uint8_t(EPower::Count);
+		case EFamily::Flow:			return uint8_t(EFlow::Count);
+		case EFamily::Density:		return uint8_t(EDensity::Count);
+		case EFamily::Acceleration:	return uint8_t(EAcceleration::Count);
+		case EFamily::Torque:		return uint8_t(ETorque::Count);
+		case EFamily::DataSize:		return uint8_t(EDataSize::Count);
+		case EFamily::DataRate:		return uint8_t(EDataRate::Count);
+		default:					return 0;
+		}
+	}
+
+	// Factor table of a linear base family, empty for the others (temperature has an offset, derived families are composed)
+	constexpr std::span<const double> GetFactors(EFamily Family)
+	{
+		switch (Family)
+		{
+		case EFamily::Length:	return LengthToM;
+		case EFamily::Weight:	return WeightToKg;
+		case EFamily::Volume:	return VolumeToM3;
+		case EFamily::Area:		return AreaToM2;
+		case EFamily::Time:		return TimeToS;
+		case EFamily::Pressure:	return PressureToPa;
+		case EFamily::Energy:	return EnergyToJ;
+		case EFamily::Angle:	return AngleToDeg;
+		case EFamily::DataSize:
+		case EFamily::DataRate:	return DataSizeToByte;
+		default:				return {};
+		}
+	}
+
+	// (Value * FromFactor) / ToFactor, 0 when a unit is not in the table
+	inline double Convert(std::span<const double> Factors, double Value, uint8_t FromUnit, uint8_t ToUnit)
+	{
+		if (FromUnit >= Factors.size() || ToUnit >= Factors.size()) return 0.0;
+		return (Value * Factors[FromUnit]) / Factors[ToUnit];
+	}
+
+	// --- --- AFFINE --- --- //
+
+	// To = (From * Numerator + Offset) / Denominator
+	struct FAffineTransform
+	{
+		double Numerator = 1.0;
+		double Offset = 0.0;
+		double Denominator = 1.0;
+
+		double Apply(double Value) const
+		{
+			// Separate statements, so a contracting compiler cannot fuse them and the scalar and batch results match
+			const double Scaled = Value * Numerator;
+			const double Shifted = Scaled + Offset;
+			return Shifted / Denominator;
+		}
+	};
+
+	// Length per time units to length per time units, scaled by the length pair and divided by the time pair
+	constexpr FAffineTransform GetSpeedTransform(ELength FromLength, ETime FromTime, ELength ToLength, ETime ToTime)
+	{
+		return { LengthToM[size_t(FromLength)] * TimeToS[size_t(ToTime)], 0.0, LengthToM[size_t(ToLength)] * TimeToS[size_t(FromTime)] };
+	}
+
+	// cm/s to each engine speed display, composed at compile time. 100 cm/s is 3.6 km/h exactly, not 3.5999999999999996.
+	inline constexpr FAffineTransform EngineSpeedFromCmS[] =
+	{
+		GetSpeedTransform(ELength::MET_CM, ETime::SEC, ELength::MET_KM, ETime::HR),
+		GetSpeedTransform(ELength::MET_CM, ETime::SEC, ELength::US_MILE, ETime::HR),
+		GetSpeedTransform(ELength::MET_CM, ETime::SEC, ELength::BRIT_NMI, ETime::HR),
+		GetSpeedTransform(ELength::MET_CM, ETime::SEC, ELength::MET_M, ETime::SEC),
+	};
+
+	static_assert(std::size(EngineSpeedFromCmS) == size_t(EEngineSpeed::Count));
+
+	inline double ConvertEngineSpeed(double CmPerS, EEngineSpeed To)
+	{
+		return To < EEngineSpeed::Count ? EngineSpeedFromCmS[size_t(To)].Apply(CmPerS) : 0.0;
+	}
+
+	// Num / Den with Den > 0
+	struct FRational
+	{
+		int64_t Num = 0;
+		int64_t Den = 1;
+	};
+
+	// Canonical = Value * Scale + Offset
+	struct FUnitDefinition
+	{
+		FRational Scale;
+		FRational Offset;
+	};
+
+	// Standard atmosphere, the zero of gauge pressures
+	inline constexpr int64_t StandardAtmospherePa = 101325;
+
+	// Kelvin = Value * Scale + Offset, exact
+	inline constexpr FUnitDefinition TemperatureToK[] =
+	{
+		{ { 1, 1 }, { 27315, 100 } },
+		{ { 5, 9 }, { 45967, 180 } },
+		{ { 1, 1 }, { 0, 1 } },
+	};
+	static_assert(std::size(TemperatureToK) == size_t(ETemperature::Count));
+
+	namespace Rational
+	{
+		constexpr int64_t Abs(int64_t Value) { return Value < 0 ? -Value : Value; }
+
+		constexpr int64_t GreatestCommonDivisor(int64_t A, int64_t B)
+		{
+			A = Abs(A);
+			B = Abs(B);
+			while (B != 0)
+			{
+				const int64_t Remainder = A % B;
+				A = B;
+				B = Remainder;
+			}
+			return A;
+		}
+
+		constexpr bool Multiply(int64_t A, int64_t B, int64_t& OutValue)
+		{
+			if (A == 0 || B == 0)
+			{
+				OutValue = 0;
+				return true;
+			}
+			if (Abs(A) > INT64_MAX / Abs(B)) return false;
+			OutValue = A * B;
+			return true;
+		}
+
+		constexpr bool Reduce(int64_t Num, int64_t Den, FRational& OutValue)
+		{
+			if (Den == 0) return false;
+			if (Den < 0)
+			{
+				Num = -Num;
+				Den = -Den;
+			}
+
+			const int64_t Gcd = std::max<int64_t>(GreatestCommonDivisor(Num, Den), 1);
+			OutValue.Num = Num / Gcd;
+			OutValue.Den = Den / Gcd;
+			return true;
+		}
+
+		constexpr bool Subtract(const FRational& A, const FRational& B, FRational& OutValue)
+		{
+			const int64_t Gcd = GreatestCommonDivisor(A.Den, B.Den);
+			int64_t Left = 0, Right = 0, Den = 0;
+			if (!Multiply(A.Num, B.Den / Gcd, Left) || !Multiply(B.Num, A.Den / Gcd, Right) || !Multiply(A.Den, B.Den / Gcd, Den)) return false;
+			if ((Right > 0 && Left < INT64_MIN + Right) || (Right < 0 && Left > INT64_MAX + Right)) return false;
+			return Reduce(Left - Right, Den, OutValue);
+		}
+
+		constexpr bool Divide(const FRational& A, const FRational& B, FRational& OutValue)
+		{
+			if (B.Num == 0) return false;
+
+			// Cross-cancel first so the products stay small
+			const int64_t NumGcd = std::max<int64_t>(GreatestCommonDivisor(A.Num, B.Num), 1);
+			const int64_t DenGcd = std::max<int64_t>(GreatestCommonDivisor(A.Den, B.Den), 1);
+			int64_t Num = 0, Den = 0;
+			if (!Multiply(A.Num / NumGcd, B.Den / DenGcd, Num) || !Multiply(A.Den / DenGcd, B.Num / NumGcd, Den)) return false;
+			return Reduce(Num, Den, OutValue);
+		}
+
+		// (Value * Scale.Num / Scale.Den + Offset.Num / Offset.Den) over the common denominator of both terms
+		constexpr bool MakeTransform(const FRational& Scale, const FRational& Offset, FAffineTransform& OutTransform)
+		{
+			const int64_t Gcd = GreatestCommonDivisor(Scale.Den, Offset.Den);
+			int64_t Den = 0, Numerator = 0, OffsetNumerator = 0;
+			if (!Multiply(Scale.Den / Gcd, Offset.Den, Den)) return false;
+			if (!Multiply(Scale.Num, Den / Scale.Den, Numerator) || !Multiply(Offset.Num, Den / Offset.Den, OffsetNumerator)) return false;
+
+			OutTransform.Numerator = double(Numerator);
+			OutTransform.Offset = double(OffsetNumerator);
+			OutTransform.Denominator = double(Den);
+			return true;
+		}
+	}
+
+	// To = (Value * ScaleFrom + OffsetFrom - OffsetTo) / ScaleTo, composed exactly so small integers convert with a single rounding
+	constexpr FAffineTransform Compose(const FUnitDefinition& From, const FUnitDefinition& To)
+	{
+		FRational Scale, OffsetDifference, Offset;
+		FAffineTransform Transform;
+		if (Rational::Divide(From.Scale, To.Scale, Scale)
+			&& Rational::Subtract(From.Offset, To.Offset, OffsetDifference)
+			&& Rational::Divide(OffsetDifference, To.Scale, Offset)
+			&& Rational::MakeTransform(Scale, Offset, Transform))
+		{
+			return Transform;
+		}
+
+		// Out of int64 range, compose in double instead
+		auto ToDouble = [](const FRational& Value) { return double(Value.Num) / double(Value.Den); };
+		Transform.Numerator = ToDouble(From.Scale) / ToDouble(To.Scale);
+		Transform.Offset = (ToDouble(From.Offset) - ToDouble(To.Offset)) / ToDouble(To.Scale);
+		Transform.Denominator = 1.0;
+		return Transform;
+	}
+
+	// 0 when a unit is not a temperature
+	inline double ConvertTemperature(double Value, ETemperature FromUnit, ETemperature ToUnit)
+	{
+		if (FromUnit >= ETemperature::Count || ToUnit >= ETemperature::Count) return 0.0;
+		return Compose(TemperatureToK[size_t(FromUnit)], TemperatureToK[size_t(ToUnit)]).Apply(Value);
+	}
+
+	// --- --- SI PREFIXES --- --- //
+
+	// Bit indices of a prefix mask, smallest first (ESIPrefix)
+	enum class EPrefix : uint8_t
+	{
+		Quecto, Ronto, Yocto, Zepto, Atto, Femto, Pico, Nano, Micro, Milli, Centi, Deci,
+		None,
+		Deca, Hecto, Kilo, Mega, Giga, Tera, Peta, Exa, Zetta, Yotta, Ronna, Quetta,
+		Count
+	};
+
+	constexpr uint32_t Mask(EPrefix Prefix) { return 1u << uint32_t(Prefix); }
+
+	inline constexpr uint32_t AllPrefixes = (1u << uint32_t(EPrefix::Count)) - 1;
+	inline constexpr uint32_t EngineeringPrefixes = AllPrefixes & ~(Mask(EPrefix::Centi) | Mask(EPrefix::Deci) | Mask(EPrefix::Deca) | Mask(EPrefix::Hecto));
+
+	inline constexpr int8_t PrefixExponents[] = { -30, -27, -24, -21, -18, -15, -12, -9, -6, -3, -2, -1, 0, 1, 2, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30 };
+	static_assert(std::size(PrefixExponents) == size_t(EPrefix::Count));
+
+	inline constexpr int32_t MinPowerOfTen = -64;
+	inline constexpr int32_t MaxPowerOfTen = 64;
+
+	// Decimal literals so every entry is the correctly rounded double, which repeated multiplication would not give
+	inline constexpr double PowersOfTen[] =
+	{
+		1e-64, 1e-63, 1e-62, 1e-61, 1e-60, 1e-59, 1e-58, 1e-57,
+		1e-56, 1e-55, 1e-54, 1e-53, 1e-52, 1e-51, 1e-50, 1e-49,
+		1e-48, 1e-47, 1e-46, 1e-45, 1e-44, 1e-43, 1e-42, 1e-41,
+		1e-40, 1e-39, 1e-38, 1e-37, 1e-36, 1e-35, 1e-34, 1e-33,
+		1e-32, 1e-31, 1e-30, 1e-29, 1e-28, 1e-27, 1e-26, 1e-25,
+		1e-24, 1e-23, 1e-22, 1e-21, 1e-20, 1e-19, 1e-18, 1e-17,
+		1e-16, 1e-15, 1e-14, 1e-13, 1e-12, 1e-11, 1e-10, 1e-9,
+		1e-8, 1e-7, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1,
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+		1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+		1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22, 1e23,
+		1e24, 1e25, 1e26, 1e27, 1e28, 1e29, 1e30, 1e31,
+		1e32, 1e33, 1e34, 1e35, 1e36, 1e37, 1e38, 1e39,
+		1e40, 1e41, 1e42, 1e43, 1e44, 1e45, 1e46, 1e47,
+		1e48, 1e49, 1e50, 1e51, 1e52, 1e53, 1e54, 1e55,
+		1e56, 1e57, 1e58, 1e59, 1e60, 1e61, 1e62, 1e63,
+		1e64
+	};
+
+	// Correctly rounded 10^Exponent, from the table for the usual range
+	inline double GetPowerOfTen(int32_t Exponent)
+	{
+		if (Exponent < MinPowerOfTen || Exponent > MaxPowerOfTen) return std::pow(10.0, double(Exponent));
+		return PowersOfTen[Exponent - MinPowerOfTen];
+	}
+
+	constexpr int32_t GetPrefixExponent(EPrefix Prefix)
+	{
+		return Prefix < EPrefix::Count ? PrefixExponents[size_t(Prefix)] : 0;
+	}
+
+	constexpr int32_t FloorDivide(int32_t Value, int32_t Divisor)
+	{
+		const int32_t Quotient = Value / Divisor;
+		return (Value % Divisor != 0 && (Value < 0) != (Divisor < 0)) ? Quotient - 1 : Quotient;
+	}
+
+	// Index of the largest prefix whose exponent is <= Exponent, clamped to the prefix range
+	constexpr int32_t FloorPrefixIndex(int32_t Exponent)
+	{
+		Exponent = std::clamp(Exponent, -30, 30);
+		if (Exponent <= -3) return int32_t(EPrefix::Milli) + 1 + FloorDivide(Exponent, 3);
+		if (Exponent >= 3) return int32_t(EPrefix::Kilo) - 1 + Exponent / 3;
+		return int32_t(EPrefix::None) + Exponent;
+	}
+
+	/*
+	*	floor(log10(|Value|)), INT32_MIN for zero and non finite values.
+	*
+	*	The decimal exponent is estimated from the binary exponent of the double (e2 * log10(2) as a fixed-point
+	*	multiply) and corrected with a single compare against the power of ten table.
+	*/
+	inline int32_t GetDecimalExponent(double Value)
+	{
+		const double AbsValue = std::fabs(Value);
+		if (!(AbsValue > 0.0) || !std::isfinite(AbsValue)) return INT32_MIN;
+
+		uint64_t Bits;
+		std::memcpy(&Bits, &AbsValue, sizeof(Bits));
+
+		const int32_t BiasedExponent = int32_t(Bits >> 52);
+		const int32_t BinaryExponent = BiasedExponent != 0 ? BiasedExponent - 1023 : int32_t(std::bit_width(Bits)) - 1 - 1074;
+
+		// floor(BinaryExponent * log10(2)), exact over the whole double range. |Value| is in [2^e, 2^(e+1)) so the
+		// decimal exponent is this estimate or the next one.
+		const int32_t Estimate = (BinaryExponent * 78913) >> 18;
+		if (Estimate + 1 < MinPowerOfTen || Estimate + 1 > MaxPowerOfTen) return int32_t(std::floor(std::log10(AbsValue)));
+
+		return AbsValue >= PowersOfTen[Estimate + 1 - MinPowerOfTen] ? Estimate + 1 : Estimate;
+	}
+
+	// Largest allowed prefix that keeps |Value| >= 1 in the prefixed unit, or the smallest allowed prefix when none does.
+	// Power is the dimension of the unit (2 for square meters). None when AllowedPrefixes is empty.
+	inline EPrefix SelectPrefix(double Value, uint32_t AllowedPrefixes = EngineeringPrefixes, int32_t Power = 1)
+	{
+		const uint32_t Allowed = AllowedPrefixes & AllPrefixes;
+		if (Allowed == 0) return EPrefix::None;
+
+		const int32_t Exponent = GetDecimalExponent(Value);
+		uint32_t Candidates = 0;
+		if (Exponent != INT32_MIN)
+		{
+			const int32_t Index = FloorPrefixIndex(FloorDivide(Exponent, Power > 1 ? Power : 1));
+			Candidates = Allowed & ((2u << Index) - 1);
+		}
+
+		return EPrefix(Candidates ? std::bit_width(Candidates) - 1 : std::countr_zero(Allowed));
+	}
+
+	// Prefixes a family has metric units for
+	constexpr uint32_t GetMetricPrefixes(EFamily Family)
+	{
+		switch (Family)
+		{
+		case EFamily::Length:
+			return Mask(EPrefix::Milli) | Mask(EPrefix::Centi) | Mask(EPrefix::Deci) | Mask(EPrefix::None) | Mask(EPrefix::Deca) | Mask(EPrefix::Hecto) | Mask(EPrefix::Kilo);
+		case EFamily::Pressure:
+			return Mask(EPrefix::Milli) | Mask(EPrefix::Centi) | Mask(EPrefix::Deci) | Mask(EPrefix::None) | Mask(EPrefix::Deca) | Mask(EPrefix::Hecto) | Mask(EPrefix::Kilo)
+				| Mask(EPrefix::Mega) | Mask(EPrefix::Giga);
+		case EFamily::Energy:
+			return Mask(EPrefix::Micro) | Mask(EPrefix::Milli) | Mask(EPrefix::None) | Mask(EPrefix::Kilo) | Mask(EPrefix::Mega);
+		case EFamily::Power:
+			return Mask(EPrefix::Milli) | Mask(EPrefix::None) | Mask(EPrefix::Kilo) | Mask(EPrefix::Mega) | Mask(EPrefix::Giga);
+		default:
+			return 0;
+		}
+	}
+
+	// Prefixes the metric auto units pick from until changed
+	constexpr uint32_t GetDefaultAutoPrefixes(EFamily Family)
+	{
+		switch (Family)
+		{
+		case EFamily::Length:	return Mask(EPrefix::Milli) | Mask(EPrefix::Centi) | Mask(EPrefix::None) | Mask(EPrefix::Kilo);
+		case EFamily::Pressure:	return Mask(EPrefix::Milli) | Mask(EPrefix::None) | Mask(EPrefix::Kilo) | Mask(EPrefix::Mega) | Mask(EPrefix::Giga);
+		default:				return GetMetricPrefixes(Family);
+		}
+	}
+
+	// --- --- AUTO UNITS --- --- //
+
+	// Values are in the canonical unit of the family, prefixed metric units come from AllowedPrefixes
+
+	inline ELength GetAutoLength(double Meters, EAutoSystem System, uint32_t AllowedPrefixes = GetDefaultAutoPrefixes(EFamily::Length))
+	{
+		switch (System)
+		{
+		case EAutoSystem::Metric:
+			switch (SelectPrefix(Meters, AllowedPrefixes))
+			{
+			case EPrefix::Milli:	return ELength::MET_MM;
+			case EPrefix::Centi:	return ELength::MET_CM;
+			case EPrefix::Deci:		return ELength::MET_DM;
+			case EPrefix::Deca:		return ELength::MET_DAM;
+			case EPrefix::Hecto:	return ELength::MET_HM;
+			case EPrefix::Kilo:		return ELength::MET_KM;
+			default:				return ELength::MET_M;
+			}
+
+		case EAutoSystem::ImperialUS:
+			if (Meters < 0.5)		return ELength::US_INCH;
+			if (Meters < 2.0)		return ELength::US_FOOT;
+			if (Meters < 500)		return ELength::US_YARD;
+			return ELength::US_MILE;
+
+		default: return ELength::MET_M;
+		}
+	}
+
+	inline EWeight GetAutoWeight(double Kilograms, EAutoSystem System)
+	{
+		switch (System)
+		{
+		case EAutoSystem::Metric:
+			if (Kilograms < 0.001)	return EWeight::MET_MG;
+			if (Kilograms < 0.1)	return EWeight::MET_G;
+			if (Kilograms < 1000.0)	return EWeight::MET_KG;
+			return EWeight::MET_TON;
+
+		case EAutoSystem::ImperialUS:
+			if (Kilograms < 0.028)	return EWeight::US_GR;
+			if (Kilograms < 0.5)	return EWeight::US_OZ;
+			if (Kilograms < 1017)	return EWeight::US_LB;
+			return EWeight::US_TON_S;
+
+		default: return EWeight::MET_KG;
+		}
+	}
+
+	inline EVolume GetAutoVolume(double CubicMeters, EAutoVolume System, bool UseExtendedAutoUnits)
+	{
+		switch (System)
+		{
+		case EAutoVolume::Metric:
+			if (CubicMeters < 0.0001)		return EVolume::MET_MM3;
+			if (CubicMeters < 0.1)			return EVolume::MET_CM3;
+			if (CubicMeters < 1000000)		return EVolume::MET_M3;
+			if (CubicMeters < 1000000000.0 && UseExtendedAutoUnits) return EVolume::MET_HM3;
+			return EVolume::MET_KM3;
+
+		case EAutoVolume::Imperial:
+			if (CubicMeters < 0.001)		return EVolume::US_IN3;
+			if (CubicMeters < 0.5)			return EVolume::US_FT3;
+			if (CubicMeters < 2000)			return EVolume::US_YD3;
+			return EVolume::US_ACREFT;
+
+		default: return EVolume::MET_M3;
+		}
+	}
+
+	inline EArea GetAutoArea(double SquareMeters, EAutoSystem System)
+	{
+		switch (System)
+		{
+		case EAutoSystem::Metric:
+			if (SquareMeters < 0.0001)		return EArea::MET_MM2;
+			if (SquareMeters < 0.1)			return EArea::MET_CM2;
+			if (SquareMeters < 10000.0)		return EArea::MET_M2;
+			if (SquareMeters < 100000000.0)	return EArea::MET_HA;
+			return EArea::MET_KM2;
+
+		case EAutoSystem::ImperialUS:
+			if (SquareMeters < 0.01)		return EArea::US_SQIN;
+			if (SquareMeters < 0.1)			return EArea::US_SQFT;
+			if (SquareMeters < 4000)		return EArea::US_SQYD;
+			return EArea::US_ACRE;
+
+		default: return EArea::MET_M2;
+		}
+	}
+
+	inline ETime GetAutoTime(double Seconds)
+	{
+		if (Seconds < 60.0)			return ETime::SEC;
+		if (Seconds < 3600.0)		return ETime::MIN;
+		if (Seconds < 86400.0)		return ETime::HR;
+		if (Seconds < 2592000.0)	return ETime::MO;
+		return ETime::YR;
+	}
+
+	inline EPressure GetAutoPressure(double Pascals, EAutoSystem System, uint32_t AllowedPrefixes = GetDefaultAutoPrefixes(EFamily::Pressure))
+	{
+		if (System != EAutoSystem::Metric) return EPressure::MET_PA;
+
+		switch (SelectPrefix(Pascals, AllowedPrefixes))
+		{
+		case EPrefix::Milli:	return EPressure::MET_MILIPA;
+		case EPrefix::Centi:	return EPressure::MET_CPA;
+		case EPrefix::Deci:		return EPressure::MET_DPA;
+		case EPrefix::Deca:		return EPressure::MET_DAPA;
+		case EPrefix::Hecto:	return EPressure::MET_HPA;
+		case EPrefix::Kilo:		return EPressure::MET_KPA;
+		case EPrefix::Mega:		return EPressure::MET_MPA;
+		case EPrefix::Giga:		return EPressure::MET_GPA;
+		default:				return EPressure::MET_PA;
+		}
+	}
+
+	inline EEnergy GetAutoEnergy(double Joules, EAutoEnergy System, uint32_t AllowedPrefixes = GetDefaultAutoPrefixes(EFamily::Energy))
+	{
+		switch (System)
+		{
+		case EAutoEnergy::WattHour:
+			if (Joules < 3600000.0)		return EEnergy::WH;
+			if (Joules < 3600000000.0)	return EEnergy::KWH;
+			return EEnergy::MWH;
+
+		case EAutoEnergy::Joules:
+			switch (SelectPrefix(Joules, AllowedPrefixes))
+			{
+			case EPrefix::Micro:	return EEnergy::UJ;
+			case EPrefix::Milli:	return EEnergy::MILIJ;
+			case EPrefix::Kilo:		return EEnergy::KJ;
+			case EPrefix::Mega:		return EEnergy::MJ;
+			default:				return EEnergy::J;
+			}
+
+		default: return EEnergy::J;
+		}
+	}
+
+	inline EPower GetAutoPower(double Watts, EAutoSystem System, uint32_t AllowedPrefixes = GetDefaultAutoPrefixes(EFamily::Power))
+	{
+		switch (System)
+		{
+		case EAutoSystem::Metric:
+			switch (SelectPrefix(Watts, AllowedPrefixes))
+			{
+			case EPrefix::Milli:	return EPower::MET_MILIW;
+			case EPrefix::Kilo:		return EPower::MET_KW;
+			case EPrefix::Mega:		return EPower::MET_MW;
+			case EPrefix::Giga:		return EPower::MET_GW;
+			default:				return EPower::MET_W;
+			}
+
+		case EAutoSystem::ImperialUS:
+			return EPower::US_HP;
+
+		default: return EPower::MET_W;
+		}
+	}
+
+	inline EFlow GetAutoFlow(double CubicMetersPerSecond, EAutoSystem System)
+	{
+		// Picked on the magnitude, so a negative value gets the unit of its absolute value
+		const double Magnitude = std::fabs(CubicMetersPerSecond);
+
+		switch (System)
+		{
+		case EAutoSystem::Metric:
+			if (Magnitude < 0.001)				return EFlow::MET_ML_S;
+			if (Magnitude < 1.0)				return EFlow::MET_L_S;
+			return EFlow::MET_M3_S;
+
+		case EAutoSystem::ImperialUS:
+			if (Magnitude < 0.0000630901964)	return EFlow::US_GAL_H;
+			if (Magnitude < 0.028316846592)		return EFlow::US_GAL_MIN;
+			return EFlow::US_FT3_S;
+
+		default: return EFlow::MET_M3_S;
+		}
+	}
+
+	inline EDensity GetAutoDensity(double KilogramsPerCubicMeter, EAutoSystem System)
+	{
+		const double Magnitude = std::fabs(KilogramsPerCubicMeter);
+
+		switch (System)
+		{
+		case EAutoSystem::Metric:
+			if (Magnitude < 1.0)	return EDensity::MET_G_M3;
+			return EDensity::MET_KG_M3;
+
+		case EAutoSystem::ImperialUS:
+			return EDensity::US_LB_FT3;
+
+		default: return EDensity::MET_KG_M3;
+		}
+	}
+
+	inline EAcceleration GetAutoAcceleration(double MetersPerSecondSquared, EAutoSystem System)
+	{
+		const double Magnitude = std::fabs(MetersPerSecondSquared);
+
+		switch (System)
+		{
+		case EAutoSystem::Metric:
+			if (Magnitude < 0.1)	return EAcceleration::MET_MM_S2;
+			return EAcceleration::MET_M_S2;
+
+		case EAutoSystem::ImperialUS:
+			if (Magnitude < 0.3048)	return EAcceleration::US_IN_S2;
+			return EAcceleration::US_FT_S2;
+
+		default: return EAcceleration::MET_M_S2;
+		}
+	}
+
+	inline ETorque GetAutoTorque(double NewtonMeters, EAutoSystem System)
+	{
+		const double Magnitude = std::fabs(NewtonMeters);
+
+		switch (System)
+		{
+		case EAutoSystem::Metric:
+			if (Magnitude < 1.0)				return ETorque::MET_N_CM;
+			if (Magnitude < 1000.0)				return ETorque::MET_N_M;
+			return ETorque::MET_KN_M;
+
+		case EAutoSystem::ImperialUS:
+			if (Magnitude < 1.3558179483314004)	return ETorque::US_LBF_IN;
+			return ETorque::US_LBF_FT;
+
+		default: return ETorque::MET_N_M;
+		}
+	}
+
+	/*
+	*	Data units are picked from the integer count, with no floating-point compare.
+	*
+	*	The binary ladder index is floor(log2) / 10, straight from the leading zero count. The decimal one is
+	*	floor(log10) / 3, with floor(log10) estimated from the bit width (log10(2) ~ 1233 / 4096) and corrected by
+	*	one compare against an integer power of ten, the same estimate and correction as GetDecimalExponent.
+	*/
+	inline constexpr uint64_t IntegerPowersOfTen[] =
+	{
+		1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+		10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull,
+		10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull,
+	};
+
+	// floor(log1000(Count)), 0 for zero
+	constexpr int32_t GetDecimalLadderIndex(uint64_t Count)
+	{
+		if (Count == 0) return 0;
+		const int32_t Estimate = ((63 - std::countl_zero(Count)) * 1233) >> 12;
+		return (Count >= IntegerPowersOfTen[Estimate + 1] ? Estimate + 1 : Estimate) / 3;
+	}
+
+	// floor(log1024(Count)), 0 for zero
+	constexpr int32_t GetBinaryLadderIndex(uint64_t Count)
+	{
+		return Count == 0 ? 0 : (63 - std::countl_zero(Count)) / 10;
+	}
+
+	// Bytes for a size, bytes per second for a rate. The ladders stop at GB, GiB and Gbit, TB, PB, TiB, PiB and Tbit are extended units.
+	constexpr EDataSize GetAutoDataSize(uint64_t Bytes, EAutoData System, bool UseExtendedAutoUnits)
+	{
+		switch (System)
+		{
+		case EAutoData::Decimal:
+			return EDataSize(size_t(EDataSize::BYTE) + std::min(GetDecimalLadderIndex(Bytes), UseExtendedAutoUnits ? 5 : 3));
+
+		case EAutoData::Binary:
+		{
+			const int32_t Index = std::min(GetBinaryLadderIndex(Bytes), UseExtendedAutoUnits ? 5 : 3);
+			return Index == 0 ? EDataSize::BYTE : EDataSize(size_t(EDataSize::KIB) + Index - 1);
+		}
+
+		case EAutoData::DecimalBits:
+		{
+			// Above 2^61 bytes the bit count does not fit, it is far past the largest bit unit anyway
+			const int32_t Index = Bytes > (UINT64_MAX >> 3) ? 4 : GetDecimalLadderIndex(Bytes << 3);
+			return EDataSize(size_t(EDataSize::BIT) + std::min(Index, UseExtendedAutoUnits ? 4 : 3));
+		}
+
+		default: return EDataSize::BYTE;
+		}
+	}
+
+	// Thresholds are whole numbers, so the integer part of the magnitude picks the same unit as the value
+	inline EDataSize GetAutoDataSize(double Bytes, EAutoData System, bool UseExtendedAutoUnits)
+	{
+		const double AbsBytes = std::fabs(Bytes);
+		if (!(AbsBytes < 18446744073709551616.0)) return GetAutoDataSize(std::isnan(AbsBytes) ? 0 : UINT64_MAX, System, UseExtendedAutoUnits);
+		return GetAutoDataSize(uint64_t(AbsBytes), System, UseExtendedAutoUnits);
+	}
+
+	inline EDataRate GetAutoDataRate(double BytesPerSecond, EAutoData System, bool UseExtendedAutoUnits)
+	{
+		return EDataRate(GetAutoDataSize(BytesPerSecond, System, UseExtendedAutoUnits));
+	}
+
+	// --- --- FORMATTING --- --- //
+
+	// Most fractional digits a significant figures mantissa is printed with, the limit of the engine's decimal formatter
+	inline constexpr int32_t MaxNotationFractionalDigits = 18;
+
+	// How a value is printed in a notation, see GetNotationDigits
+	struct FNotationDigits
+	{
+		// Digits after the decimal separator of the printed mantissa
+		int32_t FractionalDigits = 0;
+
+		// Power of ten the value is divided by before printing, a multiple of 3 in engineering notation, 0 otherwise
+		int32_t Exponent = 0;
+
+		// The value is rounded to a multiple of 10^RoundingExponent
+		int32_t RoundingExponent = 0;
+	};
+
+	/*
+	*	Digits of a value in a notation, from its decimal exponent in a single pass.
+	*
+	*	Fixed keeps Digits fractional digits. Significant and Engineering keep Digits significant digits (at
+	*	least one), engineering also moves the exponent to a multiple of 3: 0.000123456 is 0.000123 and 123e-6
+	*	with 3 digits, 123456.7 is 123000 and 123e3. Rounding that carries into the next power of ten is
+	*	accounted for, 9.996 is 10.0 and not 10.00. Zero keeps Digits - 1 fractional digits.
+	*
+	*	Significant switches to the engineering exponent when the value is too small for MaxNotationFractionalDigits,
+	*	1.23e-17 is 12.3e-18 with 3 digits, rather than losing its last digits to the text formatter.
+	*/
+	inline FNotationDigits GetNotationDigits(double Value, ENotation Notation, int32_t Digits)
+	{
+		FNotationDigits Result;
+		if (Notation != ENotation::Significant && Notation != ENotation::Engineering)
+		{
+			Result.FractionalDigits = std::clamp(Digits, 0, 64);
+			Result.RoundingExponent = -Result.FractionalDigits;
+			return Result;
+		}
+
+		const int32_t Significant = std::clamp(Digits, 1, 17);
+		int32_t Exponent = GetDecimalExponent(Value);
+		if (Exponent == INT32_MIN)
+		{
+			Result.FractionalDigits = Significant - 1;
+			Result.RoundingExponent = 1 - Significant;
+			return Result;
+		}
+
+		if (std::fabs(Value) >= GetPowerOfTen(Exponent + 1) - 0.5 * GetPowerOfTen(Exponent + 1 - Significant)) ++Exponent;
+
+		Result.RoundingExponent = Exponent + 1 - Significant;
+		if (Notation == ENotation::Engineering || -Result.RoundingExponent > MaxNotationFractionalDigits) Result.Exponent = FloorDivide(Exponent, 3) * 3;
+		Result.FractionalDigits = std::max(Result.Exponent - Result.RoundingExponent, 0);
+		return Result;
+	}
+
+	// Value to print with FNotationDigits::FractionalDigits, already rounded when the digits kept end left of the separator
+	inline double GetNotationMantissa(double Value, const FNotationDigits& Digits)
+	{
+		// 10^Exponent is zero below the double range, subnormal values are scaled up in two steps instead
+		const double Mantissa = Digits.Exponent > -300 ? Value / GetPowerOfTen(Digits.Exponent)
+			: Value * GetPowerOfTen(-Digits.Exponent / 2) * GetPowerOfTen(Digits.Exponent / 2 - Digits.Exponent);
+		if (Digits.RoundingExponent <= Digits.Exponent) return Mantissa;
+
+		// Default floating point rounding mode, ties to even like the text formatting
+		const double Step = GetPowerOfTen(Digits.RoundingExponent - Digits.Exponent);
+		return std::nearbyint(Mantissa / Step) * Step;
+	}
+
+	/*
+	*	Culture invariant decimal string: '.' separator, ',' every three integral digits with grouping, '-' and '+'.
+	*
+	*	Rounded once from the exact binary value, ties to even, then trailing zeros are dropped down to
+	*	MinFractionalDigits. A value that rounds to zero has no sign. Non finite values give "inf", "-inf" and "nan".
+	*	The module formats through FText instead so separators and digits follow the culture.
+	*/
+	inline std::string FormatNumber(double Value, int32_t MaxFractionalDigits, bool ForceSign = false, bool UseGrouping = false, int32_t MinFractionalDigits = 0)
+	{
+		if (std::isnan(Value)) return "nan";
+		if (std::isinf(Value)) return Value < 0.0 ? "-inf" : (ForceSign ? "+inf" : "inf");
+
+		MaxFractionalDigits = std::clamp(MaxFractionalDigits, 0, 64);
+		MinFractionalDigits = std::clamp(MinFractionalDigits, 0, MaxFractionalDigits);
+
+		// 309 integral digits at most, plus the separator and the fraction
+		char Digits[400];
+		const std::to_chars_result Result = std::to_chars(Digits, Digits + sizeof(Digits), std::fabs(Value), std::chars_format::fixed, MaxFractionalDigits);
+		const char* End = Result.ptr;
+
+		const char* Point = std::find(static_cast<const char*>(Digits), End, '.');
+		const char* FractionEnd = End;
+		while (FractionEnd > Point + 1 + MinFractionalDigits && FractionEnd[-1] == '0') --FractionEnd;
+		if (FractionEnd == Point + 1) FractionEnd = Point;
+
+		const bool bIsZero = std::find_if(static_cast<const char*>(Digits), FractionEnd, [](char Digit) { return Digit >= '1' && Digit <= '9'; }) == FractionEnd;
+
+		std::string Text;
+		Text.reserve(size_t(FractionEnd - Digits) + (Point - Digits) / 3 + 1);
+		if (!bIsZero && Value < 0.0) Text += '-';
+		else if (ForceSign) Text += '+';
+
+		for (const char* Digit = Digits; Digit < Point; ++Digit)
+		{
+			if (UseGrouping && Digit != Digits && (Point - Digit) % 3 == 0) Text += ',';
+			Text += *Digit;
+		}
+		Text.append(Point, FractionEnd);
+		return Text;
+	}
+
+	// FormatNumber in a notation, engineering exponents as "e3". Significant trailing zeros are kept.
+	inline std::string FormatNumber(double Value, ENotation Notation, int32_t Digits, bool ForceSign = false, bool UseGrouping = false)
+	{
+		if ((Notation != ENotation::Significant && Notation != ENotation::Engineering) || !std::isfinite(Value)) return FormatNumber(Value, Digits, ForceSign, UseGrouping);
+
+		const FNotationDigits NotationDigits = GetNotationDigits(Value, Notation, Digits);
+		std::string Text = FormatNumber(GetNotationMantissa(Value, NotationDigits), NotationDigits.FractionalDigits, ForceSign, UseGrouping, NotationDigits.FractionalDigits);
+		if (NotationDigits.Exponent != 0) Text += "e" + std::to_string(NotationDigits.Exponent);
+		return Text;
+	}
+}
@@ -0,0 +1,27 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+
+/*
+*	Definitions of the derived families (power, flow, density, acceleration, torque).
+*
+*	A derived unit is a scale times a product of base units with integer exponents: L/min is liter * minute^-1,
+*	hp is 550 * g * pound * foot * second^-1. Its factor to the canonical unit of the family is read from the
+*	base tables, so a correction to a base table carries over to every unit built on it.
+*
+*	Factors are only computed when the unit pair tables of FTicTacToeAffine are built, conversions read the
+*	composed pair from there.
+*/
+struct TICTACTOEUNITFORMAT_API FTicTacToeDerivedUnits
+{
+	// Standard gravity in m/s2, for the g and the force units (kgf, lbf)
+	static constexpr double StandardGravity = 9.80665;
+
+	static bool IsDerived(EUnitFamily Family);
+
+	// Size of one unit in the canonical unit of the family (W, m3/s, kg/m3, m/s2, N m). 0 when the unit is not part of the family.
+	static double GetFactor(EUnitFamily Family, uint8 Unit);
+};
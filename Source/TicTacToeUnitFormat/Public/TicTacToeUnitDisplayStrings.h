@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitQuantity.h"
+#include <atomic>
+
+/*
+*	Localized unit suffixes ("km", "lb", "kPa"...).
+*
+*	The tables are built on first use rather than during static initialization, so nothing is created
+*	while the module loads at PreLoadingScreen. Each family is a flat array indexed by the unit's enum
+*	value. The FTexts are LOCTEXT references, so they follow culture changes without being rebuilt.
+*
+*	There is no separate cooked suffix blob. The suffixes stay LOCTEXT so the localization gatherer finds them,
+*	and their translations are already cooked per culture into the plugin's .locres, which the text
+*	localization manager loads and swaps on culture change. A second blob would duplicate that data.
+*/
+class TICTACTOEUNITFORMAT_API FTicTacToeUnitDisplayStrings
+{
+public:
+
+	// Null when the unit has no display string
+	static const FText* Find(EUnitFamily Family, uint8 Unit);
+
+	static const FText* Find(ELengthUnit Unit)			{ return Find(EUnitFamily::UF_LENGTH, (uint8)Unit); }
+	static const FText* Find(EWeightUnit Unit)			{ return Find(EUnitFamily::UF_WEIGHT, (uint8)Unit); }
+	static const FText* Find(EVolumeUnit Unit)			{ return Find(EUnitFamily::UF_VOLUME, (uint8)Unit); }
+	static const FText* Find(EAreaUnit Unit)			{ return Find(EUnitFamily::UF_AREA, (uint8)Unit); }
+	static const FText* Find(ETemperatureUnit Unit)		{ return Find(EUnitFamily::UF_TEMPERATURE, (uint8)Unit); }
+	static const FText* Find(ETimeUnit Unit)			{ return Find(EUnitFamily::UF_TIME, (uint8)Unit); }
+	static const FText* Find(EPressureUnit Unit)		{ return Find(EUnitFamily::UF_PRESSURE, (uint8)Unit); }
+	static const FText* Find(EEnergyUnit Unit)			{ return Find(EUnitFamily::UF_ENERGY, (uint8)Unit); }
+	static const FText* Find(EAngleUnit Unit)			{ return Find(EUnitFamily::UF_ANGLE, (uint8)Unit); }
+	static const FText* Find(EPowerUnit Unit)			{ return Find(EUnitFamily::UF_POWER, (uint8)Unit); }
+	static const FText* Find(EFlowUnit Unit)			{ return Find(EUnitFamily::UF_FLOW, (uint8)Unit); }
+	static const FText* Find(EDensityUnit Unit)			{ return Find(EUnitFamily::UF_DENSITY, (uint8)Unit); }
+	static const FText* Find(EAccelerationUnit Unit)	{ return Find(EUnitFamily::UF_ACCELERATION, (uint8)Unit); }
+	static const FText* Find(ETorqueUnit Unit)			{ return Find(EUnitFamily::UF_TORQUE, (uint8)Unit); }
+	static const FText* Find(EDataSizeUnit Unit)		{ return Find(EUnitFamily::UF_DATA_SIZE, (uint8)Unit); }
+	static const FText* Find(EDataRateUnit Unit)		{ return Find(EUnitFamily::UF_DATA_RATE, (uint8)Unit); }
+
+	// Speed displays have their own suffixes, "mph" rather than "mi/h"
+	static const FText* Find(EEngineSpeedUnit Unit);
+
+	// Length of the unit's display string in the current culture, in characters, 0 without one. Cached until the culture changes.
+	static int32 GetLength(EUnitFamily Family, uint8 Unit);
+
+	// Longest display string of the family in the current culture, in characters. Cached until the culture changes.
+	static int32 GetMaxLength(EUnitFamily Family);
+
+	static int32 GetMaxEngineSpeedLength();
+
+private:
+
+	FTicTacToeUnitDisplayStrings();
+	~FTicTacToeUnitDisplayStrings();
+
+	static const FTicTacToeUnitDisplayStrings& Get();
+
+	int32 GetCachedMaxLength(int32 Slot, const TArray<FText>& Strings) const;
+	void InvalidateLengths();
+
+	template<typename UnitType>
+	void Add(EUnitFamily Family, const TMap<UnitType, FText>& Strings);
+
+	// [Family][Unit], empty entries are units without a display string
+	TArray<TArray<FText>> Tables;
+
+	// Indexed by EEngineSpeedUnit
+	TArray<FText> EngineSpeeds;
+
+	// Longest string of each family then of the engine speeds, -1 when not measured in the current culture.
+	// Stable width formatting reads them for every label, measuring means converting every string of the family.
+	static constexpr int32 EngineSpeedSlot = (int32)TicTacToeUnitCore::EFamily::Count;
+	mutable std::atomic<int32> MaxLengths[EngineSpeedSlot + 1];
+
+	// [Family][Unit], -1 when not measured in the current culture. Width fitting reads them for every unit it tries.
+	static constexpr int32 MaxUnits = 1 << FTicTacToeQuantity::UnitBits;
+	mutable std::atomic<int32> Lengths[EngineSpeedSlot][MaxUnits];
+
+	FDelegateHandle CultureChangedHandle;
+};
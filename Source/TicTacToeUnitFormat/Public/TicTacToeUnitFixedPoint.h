@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+
+/*
+*	Deterministic int64 unit conversions for lockstep simulation and replay validation.
+*
+*	Every unit is stored as an exact ratio to its family base unit, taken from the same decimal
+*	definitions as the double tables. A (from, to) pair is reduced to a single Numerator/Denominator
+*	and applied with a 128-bit intermediate product and integer rounding only, so the result is
+*	bit-identical on every compiler and CPU regardless of fast-math or FMA contraction.
+*
+*	The fixed-point scale is up to the caller: converting micrometers-as-int64 of one unit gives
+*	micrometers-as-int64 of the other, as long as both sides use the same scale.
+*/
+struct FTicTacToeUnitRatio
+{
+	int64 Numerator = 1;
+	int64 Denominator = 1;
+};
+
+struct TICTACTOEUNITFORMAT_API FTicTacToeFixedPoint
+{
+	// Reduced ratio from one unit to another. False when either unit has no exact definition or the reduced ratio does not fit in int64.
+	static bool GetRatio(ELengthUnit FromUnit, ELengthUnit ToUnit, FTicTacToeUnitRatio& OutRatio);
+	static bool GetRatio(EWeightUnit FromUnit, EWeightUnit ToUnit, FTicTacToeUnitRatio& OutRatio);
+	static bool GetRatio(EVolumeUnit FromUnit, EVolumeUnit ToUnit, FTicTacToeUnitRatio& OutRatio);
+	static bool GetRatio(EAreaUnit FromUnit, EAreaUnit ToUnit, FTicTacToeUnitRatio& OutRatio);
+	static bool GetRatio(EPressureUnit FromUnit, EPressureUnit ToUnit, FTicTacToeUnitRatio& OutRatio);
+	static bool GetRatio(EEnergyUnit FromUnit, EEnergyUnit ToUnit, FTicTacToeUnitRatio& OutRatio);
+	static bool GetRatio(EDataSizeUnit FromUnit, EDataSizeUnit ToUnit, FTicTacToeUnitRatio& OutRatio);
+	static bool GetRatio(EDataRateUnit FromUnit, EDataRateUnit ToUnit, FTicTacToeUnitRatio& OutRatio);
+
+	// Units with an offset (gauge pressures) have no ratio: GetRatio and Convert return false for them whatever the value,
+	// which is not an overflow. Convert them in double with FTicTacToeAffine.
+	static bool IsOffsetUnit(EPressureUnit Unit) { return Unit == EPressureUnit::PU_MET_BARG || Unit == EPressureUnit::PU_US_PSIG; }
+
+	// Value * Numerator / Denominator, rounded with RoundingMode. False on overflow, in which case OutValue is left untouched.
+	static bool Apply(int64 Value, const FTicTacToeUnitRatio& Ratio, ERoundingMode RoundingMode, int64& OutValue);
+
+	// Value * Numerator / Denominator as a double, from the exact 128-bit quotient and remainder rather than a double product.
+	// False when the quotient does not fit in 64 bits.
+	static bool ApplyToDouble(int64 Value, const FTicTacToeUnitRatio& Ratio, double& OutValue);
+
+	// Most fractional digits ApplyToDecimal keeps, 10^18 still fits in int64
+	static constexpr int32 MaxDecimalDigits = 18;
+
+	// Value * Numerator / Denominator rounded half to even to FractionalDigits decimal places, as its sign, the magnitude of its
+	// whole part and its fractional digits read as an integer: -1234.5678 at 2 digits is true, 1234, 57. Every digit is exact.
+	// False when the whole part does not fit in 64 bits or FractionalDigits is not in [0, MaxDecimalDigits].
+	static bool ApplyToDecimal(int64 Value, const FTicTacToeUnitRatio& Ratio, int32 FractionalDigits, bool& bOutNegative, uint64& OutWhole, uint64& OutFraction);
+
+	// Converts in place. Entries that would overflow are left untouched and the function returns false.
+	static bool Apply(TArrayView<int64> Values, const FTicTacToeUnitRatio& Ratio, ERoundingMode RoundingMode);
+
+	template<typename UnitType>
+	static bool Convert(int64 Value, UnitType FromUnit, UnitType ToUnit, ERoundingMode RoundingMode, int64& OutValue)
+	{
+		FTicTacToeUnitRatio Ratio;
+		return GetRatio(FromUnit, ToUnit, Ratio) && Apply(Value, Ratio, RoundingMode, OutValue);
+	}
+
+	template<typename UnitType>
+	static bool Convert(TArrayView<int64> Values, UnitType FromUnit, UnitType ToUnit, ERoundingMode RoundingMode)
+	{
+		FTicTacToeUnitRatio Ratio;
+		return GetRatio(FromUnit, ToUnit, Ratio) && Apply(Values, Ratio, RoundingMode);
+	}
+};
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "TicTacToeUnitSIPrefix.h"
+#include "TicTacToeUnitCore.h"
 #include "TicTacToeUnitFormatBPLibrary.generated.h"
 
 /* 
@@ -58,6 +60,39 @@ enum class EAutoEnergyUnitType : uint8
 	AUT_WATTH				UMETA(DisplayName = "Auto metric"),
 };
 
+UENUM(BlueprintType)
+enum class EAutoDataUnitType : uint8
+{
+	AUT_OFF					UMETA(DisplayName = "Off"),
+	AUT_DECIMAL				UMETA(DisplayName = "Auto bytes (kB, MB)"),
+	AUT_BINARY				UMETA(DisplayName = "Auto bytes (KiB, MiB)"),
+	AUT_DECIMAL_BITS		UMETA(DisplayName = "Auto bits (kbit, Mbit)"),
+};
+
+
+UENUM(BlueprintType)
+enum class EUnitFamily : uint8
+{
+	UF_LENGTH				UMETA(DisplayName = "Length"),
+	UF_WEIGHT				UMETA(DisplayName = "Weight"),
+	UF_VOLUME				UMETA(DisplayName = "Volume"),
+	UF_AREA					UMETA(DisplayName = "Area"),
+	UF_TEMPERATURE			UMETA(DisplayName = "Temperature"),
+	UF_TIME					UMETA(DisplayName = "Time"),
+	UF_PRESSURE				UMETA(DisplayName = "Pressure"),
+	UF_ENERGY				UMETA(DisplayName = "Energy"),
+	UF_ANGLE				UMETA(DisplayName = "Angle"),
+	// Derived from the families above
+	UF_POWER				UMETA(DisplayName = "Power"),
+	UF_FLOW					UMETA(DisplayName = "Flow"),
+	UF_DENSITY				UMETA(DisplayName = "Density"),
+	UF_ACCELERATION			UMETA(DisplayName = "Acceleration"),
+	UF_TORQUE				UMETA(DisplayName = "Torque"),
+	// Data
+	UF_DATA_SIZE			UMETA(DisplayName = "Data size"),
+	UF_DATA_RATE			UMETA(DisplayName = "Data rate"),
+};
+
 
 UENUM(BlueprintType)
 enum class ELengthUnit : uint8
@@ -220,6 +255,26 @@ enum class ETimeUnit : uint8
 	TU_YR					UMETA(DisplayName = "Year"),
 };
 
+// How precision is read by the Format functions: fractional digits when fixed, significant digits otherwise.
+// Engineering keeps the exponent a multiple of 3, 123456.7 km at 3 digits is 123e3 km.
+UENUM(BlueprintType)
+enum class ENumberNotation : uint8
+{
+	NN_FIXED				UMETA(DisplayName = "Fixed decimals"),
+	NN_SIGNIFICANT			UMETA(DisplayName = "Significant figures"),
+	NN_ENGINEERING			UMETA(DisplayName = "Engineering"),
+};
+
+// Clock style time display, truncated to the last digit shown
+UENUM(BlueprintType)
+enum class EClockFormat : uint8
+{
+	CF_MIN_SEC_MS			UMETA(DisplayName = "mm:ss.fff"),
+	CF_HR_MIN_SEC			UMETA(DisplayName = "hh:mm:ss"),
+	CF_HR_MIN_SEC_MS		UMETA(DisplayName = "hh:mm:ss.fff"),
+	CF_SEC_MS				UMETA(DisplayName = "ss.fff"),
+};
+
 UENUM(BlueprintType)
 enum class EPressureUnit : uint8
 {
@@ -236,6 +291,9 @@ enum class EPressureUnit : uint8
 	PU_MET_GPA			UMETA(DisplayName = "gigapascal"),
 	// Imperial (US)
 	PU_MET_PSI			UMETA(DisplayName = "PSI"),
+	// Gauge, relative to the standard atmosphere
+	PU_MET_BARG			UMETA(DisplayName = "bar (gauge)"),
+	PU_US_PSIG			UMETA(DisplayName = "PSI (gauge)"),
 };
 
 UENUM(BlueprintType)
@@ -265,435 +323,244 @@ enum class EAngleUnit : uint8
 	AU_MIL_SU			UMETA(DisplayName = "MIL (SU)"),
 };
 
+UENUM(BlueprintType)
+enum class EPowerUnit : uint8
+{
+	// Metric
+	PW_MET_MILIW		UMETA(DisplayName = "miliwatt"),
+	PW_MET_W			UMETA(DisplayName = "watt"),
+	PW_MET_KW			UMETA(DisplayName = "kilowatt"),
+	PW_MET_MW			UMETA(DisplayName = "megawatt"),
+	PW_MET_GW			UMETA(DisplayName = "gigawatt"),
+	PW_MET_PS			UMETA(DisplayName = "metric horsepower (PS)"),
+	// Imperial (US)
+	PW_US_FTLBF_S		UMETA(DisplayName = "foot-pound force per second"),
+	PW_US_HP			UMETA(DisplayName = "horsepower"),
+};
+
+UENUM(BlueprintType)
+enum class EFlowUnit : uint8
+{
+	// Metric
+	FU_MET_ML_S			UMETA(DisplayName = "mililiter per second"),
+	FU_MET_L_S			UMETA(DisplayName = "liter per second"),
+	FU_MET_L_MIN		UMETA(DisplayName = "liter per minute"),
+	FU_MET_L_H			UMETA(DisplayName = "liter per hour"),
+	FU_MET_M3_S			UMETA(DisplayName = "cubic meter per second"),
+	FU_MET_M3_H			UMETA(DisplayName = "cubic meter per hour"),
+	// Imperial (US)
+	FU_US_GAL_MIN		UMETA(DisplayName = "gallon per minute"),
+	FU_US_GAL_H			UMETA(DisplayName = "gallon per hour"),
+	FU_US_FT3_S			UMETA(DisplayName = "cubic foot per second"),
+	FU_US_FT3_MIN		UMETA(DisplayName = "cubic foot per minute"),
+};
+
+UENUM(BlueprintType)
+enum class EDensityUnit : uint8
+{
+	// Metric
+	DU_MET_G_M3			UMETA(DisplayName = "gram per cubic meter"),
+	DU_MET_KG_M3		UMETA(DisplayName = "kilogram per cubic meter"),
+	DU_MET_G_CM3		UMETA(DisplayName = "gram per cubic centimeter"),
+	DU_MET_G_L			UMETA(DisplayName = "gram per liter"),
+	DU_MET_KG_L			UMETA(DisplayName = "kilogram per liter"),
+	// Imperial (US)
+	DU_US_LB_FT3		UMETA(DisplayName = "pound per cubic foot"),
+	DU_US_LB_IN3		UMETA(DisplayName = "pound per cubic inch"),
+	DU_US_LB_GAL		UMETA(DisplayName = "pound per gallon"),
+};
+
+UENUM(BlueprintType)
+enum class EAccelerationUnit : uint8
+{
+	// Metric
+	AC_MET_MM_S2		UMETA(DisplayName = "milimeter per second squared"),
+	AC_MET_CM_S2		UMETA(DisplayName = "centimeter per second squared"),
+	AC_MET_M_S2			UMETA(DisplayName = "meter per second squared"),
+	AC_G				UMETA(DisplayName = "standard gravity (g)"),
+	// Imperial (US)
+	AC_US_IN_S2			UMETA(DisplayName = "inch per second squared"),
+	AC_US_FT_S2			UMETA(DisplayName = "foot per second squared"),
+};
+
+UENUM(BlueprintType)
+enum class ETorqueUnit : uint8
+{
+	// Metric
+	TQ_MET_N_CM			UMETA(DisplayName = "newton centimeter"),
+	TQ_MET_N_M			UMETA(DisplayName = "newton meter"),
+	TQ_MET_KN_M			UMETA(DisplayName = "kilonewton meter"),
+	TQ_MET_KGF_M		UMETA(DisplayName = "kilogram force meter"),
+	// Imperial (US)
+	TQ_US_LBF_IN		UMETA(DisplayName = "pound force inch"),
+	TQ_US_LBF_FT		UMETA(DisplayName = "pound force foot"),
+};
+
+UENUM(BlueprintType)
+enum class EDataSizeUnit : uint8
+{
+	// Bits
+	DS_BIT				UMETA(DisplayName = "bit"),
+	DS_KBIT				UMETA(DisplayName = "kilobit"),
+	DS_MBIT				UMETA(DisplayName = "megabit"),
+	DS_GBIT				UMETA(DisplayName = "gigabit"),
+	DS_TBIT				UMETA(DisplayName = "terabit"),
+	// Bytes, SI
+	DS_BYTE				UMETA(DisplayName = "byte"),
+	DS_KB				UMETA(DisplayName = "kilobyte"),
+	DS_MB				UMETA(DisplayName = "megabyte"),
+	DS_GB				UMETA(DisplayName = "gigabyte"),
+	DS_TB				UMETA(DisplayName = "terabyte"),
+	DS_PB				UMETA(DisplayName = "petabyte"),
+	// Bytes, IEC
+	DS_KIB				UMETA(DisplayName = "kibibyte"),
+	DS_MIB				UMETA(DisplayName = "mebibyte"),
+	DS_GIB				UMETA(DisplayName = "gibibyte"),
+	DS_TIB				UMETA(DisplayName = "tebibyte"),
+	DS_PIB				UMETA(DisplayName = "pebibyte"),
+};
+
+// Same layout as EDataSizeUnit, per second
+UENUM(BlueprintType)
+enum class EDataRateUnit : uint8
+{
+	// Bits
+	DR_BIT_S			UMETA(DisplayName = "bit per second"),
+	DR_KBIT_S			UMETA(DisplayName = "kilobit per second"),
+	DR_MBIT_S			UMETA(DisplayName = "megabit per second"),
+	DR_GBIT_S			UMETA(DisplayName = "gigabit per second"),
+	DR_TBIT_S			UMETA(DisplayName = "terabit per second"),
+	// Bytes, SI
+	DR_BYTE_S			UMETA(DisplayName = "byte per second"),
+	DR_KB_S				UMETA(DisplayName = "kilobyte per second"),
+	DR_MB_S				UMETA(DisplayName = "megabyte per second"),
+	DR_GB_S				UMETA(DisplayName = "gigabyte per second"),
+	DR_TB_S				UMETA(DisplayName = "terabyte per second"),
+	DR_PB_S				UMETA(DisplayName = "petabyte per second"),
+	// Bytes, IEC
+	DR_KIB_S			UMETA(DisplayName = "kibibyte per second"),
+	DR_MIB_S			UMETA(DisplayName = "mebibyte per second"),
+	DR_GIB_S			UMETA(DisplayName = "gibibyte per second"),
+	DR_TIB_S			UMETA(DisplayName = "tebibyte per second"),
+	DR_PIB_S			UMETA(DisplayName = "pebibyte per second"),
+};
+
+// Speed displays of engine velocities (cm/s), see UTicTacToeUnitFormatBPLibrary::FormatEngineSpeed
+UENUM(BlueprintType)
+enum class EEngineSpeedUnit : uint8
+{
+	ESU_KM_H			UMETA(DisplayName = "kilometer per hour"),
+	ESU_MI_H			UMETA(DisplayName = "mile per hour"),
+	ESU_KN				UMETA(DisplayName = "knot"),
+	ESU_M_S				UMETA(DisplayName = "meter per second"),
+};
+
+// Factor table of TicTacToeUnitCore read by enum value: a bounds check and an array read, no hashing
+template<typename UnitType>
+struct TTicTacToeUnitFactors
+{
+	std::span<const double> Factors;
+
+	constexpr bool Contains(UnitType Unit) const { return (size_t)Unit < Factors.size(); }
+
+	constexpr double operator[](UnitType Unit) const { return Factors[(size_t)Unit]; }
+};
+
 UCLASS()
 class TICTACTOEUNITFORMAT_API UTicTacToeUnitFormatBPLibrary : public UBlueprintFunctionLibrary
 {
 	GENERATED_BODY()
 
-#define LOCTEXT_NAMESPACE "FTicTacToeUnitFormatModule"
-
 	// --- --- LENGTH --- --- //
 
-	inline static const TMap<ELengthUnit, double> LengthConversionsToM =
-	{
-		// Metric
-		{ ELengthUnit::LU_MET_MM			, 0.001			},
-		{ ELengthUnit::LU_MET_CM			, 0.01			},
-		{ ELengthUnit::LU_MET_DM			, 0.1			},
-		{ ELengthUnit::LU_MET_M				, 1.0			},
-		{ ELengthUnit::LU_MET_DAM			, 10.0			},
-		{ ELengthUnit::LU_MET_HM			, 100.0			},
-		{ ELengthUnit::LU_MET_KM			, 1000.0		},
-
-		// Imperial USA
-		{ ELengthUnit::LU_US_TWIP			, 0.0000017638	},
-		{ ELengthUnit::LU_US_MIL			, 0.00000254	},
-		{ ELengthUnit::LU_US_POINT			, 0.00003527	},
-		{ ELengthUnit::LU_US_PICA			, 0.00423		},
-		{ ELengthUnit::LU_US_INCH			, 0.0254		},
-		{ ELengthUnit::LU_US_FOOT			, 0.3048		},
-		{ ELengthUnit::LU_US_YARD			, 0.9144		},
-		{ ELengthUnit::LU_US_MILE			, 1609.344		},
-		{ ELengthUnit::LU_US_LEAGUE			, 4828.032		},
-		// Imperial British
-		{ ELengthUnit::LU_BRIT_THOU			, 0.00000254	},
-		{ ELengthUnit::LU_BRIT_BARLEYCORN	, 0.00846		},
-		{ ELengthUnit::LU_BRIT_IN			, 0.0254		},
-		{ ELengthUnit::LU_BRIT_HH			, 0.1016		},
-		{ ELengthUnit::LU_BRIT_FT			, 0.3048		},
-		{ ELengthUnit::LU_BRIT_YD			, 0.9144		},
-		{ ELengthUnit::LU_BRIT_CH			, 20.1168		},
-		{ ELengthUnit::LU_BRIT_FUR			, 201.168		},
-		{ ELengthUnit::LU_BRIT_MI			, 1609.344		},
-		{ ELengthUnit::LU_BRIT_LEA			, 4828.032		},
-		// Maritime British
-		{ ELengthUnit::LU_BRIT_FTM			, 1.852			},
-		{ ELengthUnit::LU_BRIT_CABLE		, 185.2			},
-		{ ELengthUnit::LU_BRIT_NMI			, 1852.0		},
-	};
-
-	inline static const TMap<ELengthUnit, FText> LengthUnitDisplayStrings =
-	{
-		// Metric
-		{ ELengthUnit::LU_MET_MM			, LOCTEXT("mm"		,	"mm")	},
-		{ ELengthUnit::LU_MET_CM			, LOCTEXT("cm"		,	"cm")	},
-		{ ELengthUnit::LU_MET_DM			, LOCTEXT("dm"		,	"dm")	},
-		{ ELengthUnit::LU_MET_M				, LOCTEXT("m"		,	"m")	},
-		{ ELengthUnit::LU_MET_DAM			, LOCTEXT("dam"		,	"dam")	},
-		{ ELengthUnit::LU_MET_HM			, LOCTEXT("Hm"		,	"Hm")	},
-		{ ELengthUnit::LU_MET_KM			, LOCTEXT("Km"		,	"Km")	},
-		// Imperial USA
-		{ ELengthUnit::LU_US_TWIP			, LOCTEXT("LU_US_TWIP"		,	"twip")		},
-		{ ELengthUnit::LU_US_MIL			, LOCTEXT("LU_US_MIL"		,	"mil")		},
-		{ ELengthUnit::LU_US_POINT			, LOCTEXT("LU_US_POINT"		,	"p")		},
-		{ ELengthUnit::LU_US_PICA			, LOCTEXT("LU_US_PICA"		,	"P")		},
-		{ ELengthUnit::LU_US_INCH			, LOCTEXT("LU_US_INCH"		,	"in")		},
-		{ ELengthUnit::LU_US_FOOT			, LOCTEXT("LU_US_FOOT"		,	"ft")		},
-		{ ELengthUnit::LU_US_YARD			, LOCTEXT("LU_US_YARD"		,	"yd")		},
-		{ ELengthUnit::LU_US_MILE			, LOCTEXT("LU_US_MILE"		,	"mi")		},
-		{ ELengthUnit::LU_US_LEAGUE			, LOCTEXT("LU_US_LEAGUE"	,	"le")		},
-		// Imperial British
-		{ ELengthUnit::LU_BRIT_THOU			, LOCTEXT("th"		,	"th")	},
-		{ ELengthUnit::LU_BRIT_BARLEYCORN	, LOCTEXT("BCorn"	,	"BCorn")	},
-		{ ELengthUnit::LU_BRIT_IN			, LOCTEXT("in"		,	"in")	},
-		{ ELengthUnit::LU_BRIT_HH			, LOCTEXT("hh"		,	"hh")	},
-		{ ELengthUnit::LU_BRIT_FT			, LOCTEXT("ft"		,	"ft")	},
-		{ ELengthUnit::LU_BRIT_YD			, LOCTEXT("yd"		,	"yd")	},
-		{ ELengthUnit::LU_BRIT_CH			, LOCTEXT("ch"		,	"ch")	},
-		{ ELengthUnit::LU_BRIT_FUR			, LOCTEXT("fur"		,	"fur")	},
-		{ ELengthUnit::LU_BRIT_MI			, LOCTEXT("mi"		,	"mi")	},
-		{ ELengthUnit::LU_BRIT_LEA			, LOCTEXT("lea"		,	"lea")	},
-		// Maritime
-		{ ELengthUnit::LU_BRIT_FTM			, LOCTEXT("ftm"		,	"ftm")	},
-		{ ELengthUnit::LU_BRIT_CABLE		, LOCTEXT("cable"	,	"cable")	},
-		{ ELengthUnit::LU_BRIT_NMI			, LOCTEXT("nmi"		,	"nmi")	},
-	};
+	inline static constexpr TTicTacToeUnitFactors<ELengthUnit> LengthConversionsToM{ TicTacToeUnitCore::LengthToM };
 
 	// --- --- WEIGHT --- --- //
 
-	inline static const TMap<EWeightUnit, double> WeightConversionToKG =
-	{
-		// Metric
-		{ EWeightUnit::WU_MET_MG			, 0.00001				},
-		{ EWeightUnit::WU_MET_CG			, 0.0001				},
-		{ EWeightUnit::WU_MET_G				, 0.001					},
-		{ EWeightUnit::WU_MET_DG			, 0.01					},
-		{ EWeightUnit::WU_MET_HG			, 0.1					},
-		{ EWeightUnit::WU_MET_KG			, 1.0					},
-		{ EWeightUnit::WU_MET_TON			, 1000.0				},
-		// Imperial US
-		{ EWeightUnit::WU_US_GR				, 0.00006479891			},
-		{ EWeightUnit::WU_US_DR				, 0.0017718451953125	},
-		{ EWeightUnit::WU_US_OZ				, 0.028349523125		},
-		{ EWeightUnit::WU_US_LB				, 0.45359237			},
-		{ EWeightUnit::WU_US_CWT_S			, 45.359237				},
-		{ EWeightUnit::WU_US_CWT_L			, 50.80234544			},
-		{ EWeightUnit::WU_US_TON_S			, 907.18474				},
-		{ EWeightUnit::WU_US_TON_L			, 1016.0469088			},
-		// Imperial British
-		{ EWeightUnit::WU_BRIT_GR			, 0.00006479891			},
-		{ EWeightUnit::WU_BRIT_DR			, 0.0017718451953125	},
-		{ EWeightUnit::WU_BRIT_OZ			, 0.028349523125		},
-		{ EWeightUnit::WU_BRIT_LB			, 0.45359237			},
-		{ EWeightUnit::WU_BRIT_ST			, 6.35029318			},
-		{ EWeightUnit::WU_BRIT_QR			, 12.70058636			},
-		{ EWeightUnit::WU_BRIT_CWT			, 50.80234544			},
-		{ EWeightUnit::WU_BRIT_TON			, 1016.0469088			},
-		// Other
-		{ EWeightUnit::WU_BRIT_SLUG			, 14.59390294			},
-	};
-
-	inline static const TMap<EWeightUnit, FText> WeightUnitDisplayStrings =
-	{
-		// Metric
-		{ EWeightUnit::WU_MET_MG			, LOCTEXT("mg"		,	"mg")		},
-		{ EWeightUnit::WU_MET_CG			, LOCTEXT("cg"		,	"cg")		},
-		{ EWeightUnit::WU_MET_G				, LOCTEXT("g"		,	"g")		},
-		{ EWeightUnit::WU_MET_DG			, LOCTEXT("dg"		,	"dg")		},
-		{ EWeightUnit::WU_MET_HG			, LOCTEXT("hg"		,	"hg")		},
-		{ EWeightUnit::WU_MET_KG			, LOCTEXT("kg"		,	"kg")		},
-		{ EWeightUnit::WU_MET_TON			, LOCTEXT("t"		,	"t")		},
-		// Imperial US
-		{ EWeightUnit::WU_US_GR				, LOCTEXT("gr"		,	"gr")		},
-		{ EWeightUnit::WU_US_DR				, LOCTEXT("dr"		,	"dr")		},
-		{ EWeightUnit::WU_US_OZ				, LOCTEXT("oz"		,	"oz")		},
-		{ EWeightUnit::WU_US_LB				, LOCTEXT("lb"		,	"lb")		},
-		{ EWeightUnit::WU_US_CWT_S			, LOCTEXT("cwt"		,	"cwt")		},
-		{ EWeightUnit::WU_US_CWT_L			, LOCTEXT("cwt"		,	"cwt")		},
-		{ EWeightUnit::WU_US_TON_S			, LOCTEXT("ton"		,	"ton")		},
-		{ EWeightUnit::WU_US_TON_L			, LOCTEXT("ton"		,	"ton")		},
-		// Imperial British
-		{ EWeightUnit::WU_BRIT_GR			, LOCTEXT("gr"		,	"gr")		},
-		{ EWeightUnit::WU_BRIT_DR			, LOCTEXT("dr"		,	"dr")		},
-		{ EWeightUnit::WU_BRIT_OZ			, LOCTEXT("oz"		,	"oz")		},
-		{ EWeightUnit::WU_BRIT_LB			, LOCTEXT("lb"		,	"lb")		},
-		{ EWeightUnit::WU_BRIT_ST			, LOCTEXT("st"		,	"st")		},
-		{ EWeightUnit::WU_BRIT_QR			, LOCTEXT("qr"		,	"qr")		},
-		{ EWeightUnit::WU_BRIT_CWT			, LOCTEXT("cwt"		,	"cwt")		},
-		{ EWeightUnit::WU_BRIT_TON			, LOCTEXT("ton"		,	"ton")		},
-		// Other
-		{ EWeightUnit::WU_BRIT_SLUG			, LOCTEXT("slug"	,	"slug")		},
-	};
+	inline static constexpr TTicTacToeUnitFactors<EWeightUnit> WeightConversionToKG{ TicTacToeUnitCore::WeightToKg };
 
 	// --- --- VOLUME --- --- //
 
-	inline static const TMap<EVolumeUnit, double> VolumeConversionToM3 =
-	{
-		// Metric fluid
-		{ EVolumeUnit::VU_MET_ML			, 0.000001					},
-		{ EVolumeUnit::VU_MET_CL			, 0.00001					},
-		{ EVolumeUnit::VU_MET_DL			, 0.0001					},
-		{ EVolumeUnit::VU_MET_L				, 0.001						},
-		{ EVolumeUnit::VU_MET_DAL			, 0.010						},
-		{ EVolumeUnit::VU_MET_HL			, 0.1						},
-		{ EVolumeUnit::VU_MET_KL			, 1.0						},
-		// Metric
-		{ EVolumeUnit::VU_MET_MM3			, 0.000000001				},
-		{ EVolumeUnit::VU_MET_CM3			, 0.000001					},
-		{ EVolumeUnit::VU_MET_DM3			, 0.001						},
-		{ EVolumeUnit::VU_MET_M3			, 1.0						},
-		{ EVolumeUnit::VU_MET_DAM3			, 1000.0					},
-		{ EVolumeUnit::VU_MET_HM3			, 1000000.0					},
-		{ EVolumeUnit::VU_MET_KM3			, 1000000000.0				},
-		// Imperial british fluid
-		{ EVolumeUnit::VU_BRIT_FLOZ			, 0.000029574				},
-		{ EVolumeUnit::VU_BRIT_GI			, 0.000118294				},
-		{ EVolumeUnit::VU_BRIT_PT			, 0.000473176				},
-		{ EVolumeUnit::VU_BRIT_QT			, 0.0011365225				},
-		{ EVolumeUnit::VU_BRIT_GAL			, 0.00454609				},
-		// Imperial US fluid
-		{ EVolumeUnit::VU_US_MIN			, 0.000000061611519921875	},
-		{ EVolumeUnit::VU_US_FLDR			, 0.0000036966911953125		},
-		{ EVolumeUnit::VU_US_TSP			, 0.00000492892159375		},
-		{ EVolumeUnit::VU_US_TBSP			, 0.00001478676478125		},
-		{ EVolumeUnit::VU_US_FLOZ			, 0.0000295735295625		},
-		{ EVolumeUnit::VU_US_JIG			, 0.00004436029434375		},
-		{ EVolumeUnit::VU_US_GI				, 0.00011829411825			},
-		{ EVolumeUnit::VU_US_C				, 0.0002365882365			},
-		{ EVolumeUnit::VU_US_PT				, 0.0004731764773			},
-		{ EVolumeUnit::VU_US_QT				, 0.000946352946			},
-		{ EVolumeUnit::VU_US_POT			, 0.001892705892			},
-		{ EVolumeUnit::VU_US_GAL			, 0.003785411784			},
-		{ EVolumeUnit::VU_US_BBL			, 0.119240471196			},
-		{ EVolumeUnit::VU_US_OILBBL			, 0.158987294928			},
-		{ EVolumeUnit::VU_US_HOGSHEAD		, 0.238480942392			},
-		// Imperial US
-		{ EVolumeUnit::VU_US_IN3			, 0.000016387064			},
-		{ EVolumeUnit::VU_US_FT3			, 0.028316846592			},
-		{ EVolumeUnit::VU_US_YD3			, 0.764554857984			},
-		{ EVolumeUnit::VU_US_ACREFT			, 1233.482					},
-	};
-
-	inline static const TMap<EVolumeUnit, FText> VolumeUnitDisplayStrings =
-	{
-		// Metric liters
-		{ EVolumeUnit::VU_MET_ML			, LOCTEXT("met_mL"		, "mL")			},
-		{ EVolumeUnit::VU_MET_CL			, LOCTEXT("met_cL"		, "cL")			},
-		{ EVolumeUnit::VU_MET_DL			, LOCTEXT("met_dL"		, "dL")			},
-		{ EVolumeUnit::VU_MET_L				, LOCTEXT("met_L"		, "L")			},
-		{ EVolumeUnit::VU_MET_DAL			, LOCTEXT("met_DaL"		, "DaL")		},
-		{ EVolumeUnit::VU_MET_HL			, LOCTEXT("met_hL"		, "hL")			},
-		{ EVolumeUnit::VU_MET_KL			, LOCTEXT("met_kL"		, "kL")			},
-		// Metric											
-		{ EVolumeUnit::VU_MET_MM3			, LOCTEXT("met_mm3"		, "mm3")		},
-		{ EVolumeUnit::VU_MET_CM3			, LOCTEXT("met_cm3"		, "cm3")		},
-		{ EVolumeUnit::VU_MET_DM3			, LOCTEXT("met_dm3"		, "dm3")		},
-		{ EVolumeUnit::VU_MET_M3			, LOCTEXT("met_m3"		, "m3")			},
-		{ EVolumeUnit::VU_MET_DAM3			, LOCTEXT("met_Dam3"	, "Dam3")		},
-		{ EVolumeUnit::VU_MET_HM3			, LOCTEXT("met_hm3"		, "hm3")		},
-		{ EVolumeUnit::VU_MET_KM3			, LOCTEXT("met_km3"		, "km3")		},
-		// Imperial	
-		{ EVolumeUnit::VU_BRIT_FLOZ			, LOCTEXT("brit_fl oz"	, "fl oz")		},
-		{ EVolumeUnit::VU_BRIT_GI			, LOCTEXT("brit_gi"		, "gi")			},
-		{ EVolumeUnit::VU_BRIT_PT			, LOCTEXT("brit_pt"		, "pt")			},
-		{ EVolumeUnit::VU_BRIT_QT			, LOCTEXT("brit_qt"		, "qt")			},
-		{ EVolumeUnit::VU_BRIT_GAL			, LOCTEXT("brit_gal"	, "gal")		},
-		// Imperial US fluid
-		{ EVolumeUnit::VU_US_MIN			, LOCTEXT("us_min"		, "min")	},
-		{ EVolumeUnit::VU_US_FLDR			, LOCTEXT("us_fl dr"	, "fl dr")	},
-		{ EVolumeUnit::VU_US_TSP			, LOCTEXT("us_tsp"		, "tsp")	},
-		{ EVolumeUnit::VU_US_TBSP			, LOCTEXT("us_tbsp"		, "tbsp")	},
-		{ EVolumeUnit::VU_US_FLOZ			, LOCTEXT("us_fl oz"	, "fl oz")	},
-		{ EVolumeUnit::VU_US_JIG			, LOCTEXT("us_jig"		, "jig")	},
-		{ EVolumeUnit::VU_US_GI				, LOCTEXT("us_gi"		, "gi")	},
-		{ EVolumeUnit::VU_US_C				, LOCTEXT("us_c"		, "c")	},
-		{ EVolumeUnit::VU_US_PT				, LOCTEXT("us_pint"		, "pint")	},
-		{ EVolumeUnit::VU_US_QT				, LOCTEXT("us_qt"		, "qt")	},
-		{ EVolumeUnit::VU_US_POT			, LOCTEXT("us_pot"		, "pot")	},
-		{ EVolumeUnit::VU_US_GAL			, LOCTEXT("us_gal"		, "gal")	},
-		{ EVolumeUnit::VU_US_BBL			, LOCTEXT("us_bbl"		, "bbl")	},
-		{ EVolumeUnit::VU_US_OILBBL			, LOCTEXT("us_oilbbl"	, "bbl")	},
-		{ EVolumeUnit::VU_US_HOGSHEAD		, LOCTEXT("us_hogshead"	, "hogshead")	},
-		// Imperial US	
-		{ EVolumeUnit::VU_US_IN3			, LOCTEXT("us_in3"		, "in3")		},
-		{ EVolumeUnit::VU_US_FT3			, LOCTEXT("us_ft3"		, "ft3")		},
-		{ EVolumeUnit::VU_US_YD3			, LOCTEXT("us_yd3"		, "yd3")		},
-		{ EVolumeUnit::VU_US_ACREFT			, LOCTEXT("us_acrefoot"	, "acre-foot")	},
-	};
+	inline static constexpr TTicTacToeUnitFactors<EVolumeUnit> VolumeConversionToM3{ TicTacToeUnitCore::VolumeToM3 };
 
 	// --- --- AREA --- --- //
 
-	inline static const TMap<EAreaUnit, double> AreaConversionToM2 =
-	{
-		// Metric
-		{ EAreaUnit::AU_MET_MM2				, 0.000001			},
-		{ EAreaUnit::AU_MET_CM2				, 0.0001			},
-		{ EAreaUnit::AU_MET_DM2				, 0.01				},
-		{ EAreaUnit::AU_MET_M2				, 1.0				},
-		{ EAreaUnit::AU_MET_DAM2			, 100.0				},
-		{ EAreaUnit::AU_MET_HM2				, 10000.0			},
-		{ EAreaUnit::AU_MET_HA				, 1000000.0			},
-		{ EAreaUnit::AU_MET_KM2				, 100000000.0		},
-		// Imperial US						  
-		{ EAreaUnit::AU_US_SQIN				, 0.00064516		},
-		{ EAreaUnit::AU_US_SQFT				, 0.09290304		},
-		{ EAreaUnit::AU_US_SQYD				, 0.83612736		},
-		{ EAreaUnit::AU_US_SQCH				, 404.68564224		},
-		{ EAreaUnit::AU_US_ACRE				, 4046.8564224		},
-		{ EAreaUnit::AU_US_SEC				, 258999800.0		},
-		{ EAreaUnit::AU_US_TWP				, 9323993000.0		},
-	};
-
-	inline static const TMap<EAreaUnit, FText> AreaUnitDisplayStrings =
-	{
-		// Metric
-		{ EAreaUnit::AU_MET_MM2				, LOCTEXT("met_mm2",	"mm2")	},
-		{ EAreaUnit::AU_MET_CM2				, LOCTEXT("met_cm2",	"cm2")	},
-		{ EAreaUnit::AU_MET_DM2				, LOCTEXT("met_dm2",	"dm2")	},
-		{ EAreaUnit::AU_MET_M2				, LOCTEXT("met_m2",	"m2")	},
-		{ EAreaUnit::AU_MET_DAM2			, LOCTEXT("met_dam2",	"Dam2")	},
-		{ EAreaUnit::AU_MET_HM2				, LOCTEXT("met_hm2",	"hm2")	},
-		{ EAreaUnit::AU_MET_HA				, LOCTEXT("met_ha",	"ha")	},
-		{ EAreaUnit::AU_MET_KM2				, LOCTEXT("met_km2",	"km2")	},
-		// Imperial US						  
-		{ EAreaUnit::AU_US_SQIN				, LOCTEXT("us_sqin",	"sq in")	},
-		{ EAreaUnit::AU_US_SQFT				, LOCTEXT("us_sqft",	"sq ft")	},
-		{ EAreaUnit::AU_US_SQYD				, LOCTEXT("us_sqyd",	"sq yd")	},
-		{ EAreaUnit::AU_US_SQCH				, LOCTEXT("us_sq ch",	"sq ch")	},
-		{ EAreaUnit::AU_US_ACRE				, LOCTEXT("us_acre",	"acre")		},
-		{ EAreaUnit::AU_US_SEC				, LOCTEXT("us_sec",	"sec")		},
-		{ EAreaUnit::AU_US_TWP				, LOCTEXT("us_twp",	"twp")		},
-	};
-
-	// --- --- TEMPERATURE --- --- //
-
-	inline static const TMap<ETemperatureUnit, FText> TemperatureUnitDisplayStrings =
-	{
-		{ ETemperatureUnit::TU_CEL			, LOCTEXT("cel",		"C")		},
-		{ ETemperatureUnit::TU_FAR			, LOCTEXT("far",		"F")		},
-		{ ETemperatureUnit::TU_KEL			, LOCTEXT("kel",		"K")		},
-	};
-
+	inline static constexpr TTicTacToeUnitFactors<EAreaUnit> AreaConversionToM2{ TicTacToeUnitCore::AreaToM2 };
 
 	// --- --- TIME --- --- //
 
-	inline static const TMap<ETimeUnit, double> TimeConversionToS =
-	{
-		{ ETimeUnit::TU_SEC	,	1.0										},
-		{ ETimeUnit::TU_MIN	,	0.01666666666666666666666666666667		},
-		{ ETimeUnit::TU_HR	,	2.7777777777777777777777777777778e-4	},
-		{ ETimeUnit::TU_DAY	,	1.1574074074074074074074074074074e-5	},
-		{ ETimeUnit::TU_MO	,	3.858024691358024691358024691358e-7		},
-		{ ETimeUnit::TU_YR	,	3.1709791983764586504312531709792e-8	},
-	};
-
-	inline static const TMap<ETimeUnit, FText> TimeUnitDisplayStrings =
-	{
-		// Metric
-		{ ETimeUnit::TU_SEC	,	LOCTEXT("second"	, "s")			},
-		{ ETimeUnit::TU_MIN	,	LOCTEXT("minute"	, "m")			},
-		{ ETimeUnit::TU_HR	,	LOCTEXT("hour"		, "h")			},
-		{ ETimeUnit::TU_DAY	,	LOCTEXT("day"		, "d")			},
-		{ ETimeUnit::TU_MO	,	LOCTEXT("month"	, "m")			},
-		{ ETimeUnit::TU_YR	,	LOCTEXT("year"		, "y")			},
-	};
+	inline static constexpr TTicTacToeUnitFactors<ETimeUnit> TimeConversionToS{ TicTacToeUnitCore::TimeToS };
 
 	// --- --- PRESSURE --- --- //
 
-	inline static const TMap<EPressureUnit, double> PressureConversionToPa =
-	{
-		// Metric
-		{ EPressureUnit::PU_MET_MILIPA		, 0.001					},
-		{ EPressureUnit::PU_MET_CPA			, 0.01					},
-		{ EPressureUnit::PU_MET_DPA			, 0.1					},
-		{ EPressureUnit::PU_MET_PA			, 1.0					},
-		{ EPressureUnit::PU_MET_DAPA		, 10.0					},
-		{ EPressureUnit::PU_MET_HPA			, 100.0					},
-		{ EPressureUnit::PU_MET_KPA			, 1000.0				},
-		{ EPressureUnit::PU_MET_BAR			, 100000.0				},
-		{ EPressureUnit::PU_MET_MPA			, 1000000.0				},
-		{ EPressureUnit::PU_MET_GPA			, 1000000000.0			},
-		// Imperial (US)
-		{ EPressureUnit::PU_MET_PSI			, 6894.757				},
-	};
-
-	inline static const TMap<EPressureUnit, FText> PressureUnitDisplayStrings =
-	{
-		{ EPressureUnit::PU_MET_MILIPA		, LOCTEXT("met_miliPa", "mPa")	},
-		{ EPressureUnit::PU_MET_CPA			, LOCTEXT("met_cPa", "cPa")		},
-		{ EPressureUnit::PU_MET_DPA			, LOCTEXT("met_dPa", "dPa")		},
-		{ EPressureUnit::PU_MET_PA			, LOCTEXT("met_Pa", "Pa")		},
-		{ EPressureUnit::PU_MET_DAPA		, LOCTEXT("met_daPa", "daPa")	},
-		{ EPressureUnit::PU_MET_HPA			, LOCTEXT("met_hPa", "hPa")		},
-		{ EPressureUnit::PU_MET_KPA			, LOCTEXT("met_kPa", "kPa")		},
-		{ EPressureUnit::PU_MET_BAR			, LOCTEXT("met_bar", "bar")		},
-		{ EPressureUnit::PU_MET_MPA			, LOCTEXT("met_MPa", "MPa")		},
-		{ EPressureUnit::PU_MET_GPA			, LOCTEXT("met_GPa", "GPa")		},
-		// Imperial (US)
-		{ EPressureUnit::PU_MET_PSI			, LOCTEXT("us_psi", "PSI")		},
-	};
-
+	// Gauge units have an offset, they are converted by FTicTacToeAffine
+	inline static constexpr TTicTacToeUnitFactors<EPressureUnit> PressureConversionToPa{ TicTacToeUnitCore::PressureToPa };
 
 	// --- --- ENERGY --- --- //
 
-	inline static const TMap<EEnergyUnit, double> EnergyConversionToJ =
-	{
-		// Joules
-		{ EEnergyUnit::EU_UJ			, 0.000001					},
-		{ EEnergyUnit::EU_MILIJ			, 0.001						},
-		{ EEnergyUnit::EU_J				, 1.0						},
-		{ EEnergyUnit::EU_KJ			, 1000.0					},
-		{ EEnergyUnit::EU_MJ			, 1000000.0					},
-		// Watt-hour
-		{ EEnergyUnit::EU_WH			, 3600.0					},
-		{ EEnergyUnit::EU_KWH			, 3600000.0					},
-		{ EEnergyUnit::EU_MWH			, 3600000000.0				},
-		// Calorie
-		{ EEnergyUnit::EU_CAL			, 0.0						},
-		{ EEnergyUnit::EU_KCAL			, 0.0						},
-	};
-
-	inline static const TMap<EEnergyUnit, FText> EnergyUnitDisplayStrings =
-	{
-		// Joules
-		{ EEnergyUnit::EU_UJ			, LOCTEXT("EU_UJ" ,		"J")				},
-		{ EEnergyUnit::EU_MILIJ			, LOCTEXT("EU_MILIJ" ,	"mJ")				},
-		{ EEnergyUnit::EU_J				, LOCTEXT("EU_J" ,		"J")				},
-		{ EEnergyUnit::EU_KJ			, LOCTEXT("EU_KJ" ,		"kJ")				},
-		{ EEnergyUnit::EU_MJ			, LOCTEXT("EU_MJ" ,		"MJ")				},
-		// Watt-hour
-		{ EEnergyUnit::EU_WH			, LOCTEXT("EU_WH" ,	"Wh")				},
-		{ EEnergyUnit::EU_KWH			, LOCTEXT("EU_KWH" ,	"kWh")				},
-		{ EEnergyUnit::EU_MWH			, LOCTEXT("EU_MWH" ,	"MWh")				},
-		// Calorie
-		{ EEnergyUnit::EU_CAL			, LOCTEXT("EU_CAL" ,	"cal")				},
-		{ EEnergyUnit::EU_KCAL			, LOCTEXT("EU_KCAL" ,	"kCal")			},
-	};
-
+	inline static constexpr TTicTacToeUnitFactors<EEnergyUnit> EnergyConversionToJ{ TicTacToeUnitCore::EnergyToJ };
 
 	// --- --- ANGLE --- --- //
 
-	inline static const TMap<EAngleUnit, double> AngleConversionToDeg =
-	{
-		{ EAngleUnit::AU_DEG			, 1.0						},
-		{ EAngleUnit::AU_RAD			, 57.2958					},
-		{ EAngleUnit::AU_MOA			, 0.016666666666666			},
-		{ EAngleUnit::AU_MILIR			, 0.0572958					},
-		{ EAngleUnit::AU_MIL_OTAN		, 0.05625					},
-		{ EAngleUnit::AU_MIL_RU			, 0.06						},
-		{ EAngleUnit::AU_MIL_SU			, 0.057143					},
-	};
-
-	inline static const TMap<EAngleUnit, FText> AngleUnitDisplayStrings =
-	{
-		{ EAngleUnit::AU_DEG			, LOCTEXT("au_deg",			"")	},
-		{ EAngleUnit::AU_RAD			, LOCTEXT("au_rad",			"rad")	},
-		{ EAngleUnit::AU_MOA			, LOCTEXT("au_moa",			"MOA")	},
-		{ EAngleUnit::AU_MILIR			, LOCTEXT("au_milir",		"milirad")	},
-		{ EAngleUnit::AU_MIL_OTAN		, LOCTEXT("au_milotan",		"mil")	},
-		{ EAngleUnit::AU_MIL_RU			, LOCTEXT("au_milru",		"mil")	},
-		{ EAngleUnit::AU_MIL_SU			, LOCTEXT("au_milsu",		"mil")	},
-	};
-
-#undef LOCTEXT_NAMESPACE
+	inline static constexpr TTicTacToeUnitFactors<EAngleUnit> AngleConversionToDeg{ TicTacToeUnitCore::AngleToDeg };
+
+	// --- --- DATA --- --- //
+
+	inline static constexpr TTicTacToeUnitFactors<EDataSizeUnit> DataSizeConversionToByte{ TicTacToeUnitCore::DataSizeToByte };
+
+	inline static constexpr TTicTacToeUnitFactors<EDataRateUnit> DataRateConversionToByteS{ TicTacToeUnitCore::DataSizeToByte };
 
 
 	static ELengthUnit GetAutoLength(double length_meters, EAutoUnitType AutoUnit);
 
+	static EWeightUnit GetAutoWeight(double weight_kg, EAutoUnitType AutoUnit);
+
+	static EVolumeUnit GetAutoVolume(double volume_m3, EAutoVolumeUnitType AutoUnit, bool UseExtendedAutoUnits);
+
+	static EAreaUnit GetAutoArea(double area_m2, EAutoUnitType AutoUnit);
+
+	static ETimeUnit GetAutoTime(double time_s);
+
 	static EPressureUnit GetAutoPressure(double pressure_pascals, EAutoPressureUnitType AutoUnit);
 
 	static EEnergyUnit GetAutoEnergy(double energy_joules, EAutoEnergyUnitType AutoUnit);
 
+	static EPowerUnit GetAutoPower(double power_watts, EAutoUnitType AutoUnit);
+
+	static EFlowUnit GetAutoFlow(double flow_m3_s, EAutoUnitType AutoUnit);
+
+	static EDensityUnit GetAutoDensity(double density_kg_m3, EAutoUnitType AutoUnit);
+
+	static EAccelerationUnit GetAutoAcceleration(double acceleration_m_s2, EAutoUnitType AutoUnit);
+
+	static ETorqueUnit GetAutoTorque(double torque_n_m, EAutoUnitType AutoUnit);
+
+	static EDataSizeUnit GetAutoDataSize(double size_bytes, EAutoDataUnitType AutoUnit, bool UseExtendedAutoUnits);
+
+	static EDataRateUnit GetAutoDataRate(double rate_bytes_s, EAutoDataUnitType AutoUnit, bool UseExtendedAutoUnits);
+
+	// Number followed by its suffix. With StableWidth > 0 the number is right aligned in StableWidth - suffixSlot characters
+	// and the suffix left aligned in suffixSlot characters, padded with figure spaces.
+	static FText FormatValue(double value, const FText& suffix, int32 suffixSlot, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	// FormatValue in significant figures or engineering notation, digits is the number of significant digits
+	static FText FormatNotation(double value, const FText& suffix, int32 suffixSlot, int digits, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation);
+
+	// Number right aligned in StableWidth - suffixSlot characters, suffix left aligned in suffixSlot characters
+	static FText PadValue(const FText& number, const FText& suffix, int32 suffixSlot, int StableWidth);
+
+	// Number from FTicTacToeFixedPoint::ApplyToDecimal in the culture's digits and separators, with the sign, grouping and trailing
+	// zero rules of Conv_DoubleToText: a negative that rounds to zero keeps its minus sign and ForceSign puts a plus on zero.
+	// The digits are printed as they are, whatever the magnitude. Unlike FText::AsNumber the text is built from the current
+	// culture once and is not rebuilt when the culture changes, format again after a culture change.
+	static FText FormatDecimal(bool negative, uint64 whole, uint64 fraction, int32 fractionalDigits, int32 minFractionalDigits, bool ForceSign, bool UseGrouping);
+
+	// Format function of the derived families, which all use EAutoUnitType
+	static FText FormatDerived(double value, EUnitFamily family, uint8 fromUnit, uint8 toUnit, EAutoUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	// Format function of the int64 data sizes and rates, both families share one unit layout
+	static FText FormatDataInt64(int64 value, EUnitFamily family, uint8 fromUnit, uint8 toUnit, EAutoDataUnitType AutoUnit, bool UseExtendedAutoUnits, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation);
+
 
 public:
 
@@ -701,7 +568,7 @@ public:
 	static double ConvertLength(double length, ELengthUnit fromUnit = ELengthUnit::LU_MET_CM, ELengthUnit toUnit = ELengthUnit::LU_MET_CM);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
-	static FText FormatLength(double length, ELengthUnit fromUnit = ELengthUnit::LU_MET_CM, ELengthUnit toUnit = ELengthUnit::LU_MET_M, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static FText FormatLength(double length, ELengthUnit fromUnit = ELengthUnit::LU_MET_CM, ELengthUnit toUnit = ELengthUnit::LU_MET_M, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
 
 
 
@@ -709,7 +576,7 @@ public:
 	static double ConvertWeight(double weight, EWeightUnit fromUnit = EWeightUnit::WU_MET_KG, EWeightUnit toUnit = EWeightUnit::WU_MET_KG);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
-	static FText FormatWeight(double weight, EWeightUnit fromUnit = EWeightUnit::WU_MET_KG, EWeightUnit toUnit = EWeightUnit::WU_MET_KG, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static FText FormatWeight(double weight, EWeightUnit fromUnit = EWeightUnit::WU_MET_KG, EWeightUnit toUnit = EWeightUnit::WU_MET_KG, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
 
 
 
@@ -717,7 +584,7 @@ public:
 	static double ConvertVolume(double volume, EVolumeUnit fromUnit = EVolumeUnit::VU_MET_CM3, EVolumeUnit toUnit = EVolumeUnit::VU_MET_CM3);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
-	static FText FormatVolume(double volume, EVolumeUnit fromUnit = EVolumeUnit::VU_MET_CM3, EVolumeUnit toUnit = EVolumeUnit::VU_MET_CM3, EAutoVolumeUnitType AutoUnit = EAutoVolumeUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static FText FormatVolume(double volume, EVolumeUnit fromUnit = EVolumeUnit::VU_MET_CM3, EVolumeUnit toUnit = EVolumeUnit::VU_MET_CM3, EAutoVolumeUnitType AutoUnit = EAutoVolumeUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
 
 
 
@@ -725,7 +592,7 @@ public:
 	static double ConvertArea(double volume, EAreaUnit fromUnit = EAreaUnit::AU_MET_CM2, EAreaUnit toUnit = EAreaUnit::AU_MET_CM2);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
-	static FText FormatArea(double volume, EAreaUnit fromUnit = EAreaUnit::AU_MET_CM2, EAreaUnit toUnit = EAreaUnit::AU_MET_CM2, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static FText FormatArea(double volume, EAreaUnit fromUnit = EAreaUnit::AU_MET_CM2, EAreaUnit toUnit = EAreaUnit::AU_MET_CM2, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
 
 
 
@@ -733,7 +600,7 @@ public:
 	static double ConvertTemperature(double temperature, ETemperatureUnit fromUnit = ETemperatureUnit::TU_CEL, ETemperatureUnit toUnit = ETemperatureUnit::TU_CEL);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
-	static FText FormatTemperature(double temperature, ETemperatureUnit fromUnit = ETemperatureUnit::TU_CEL, ETemperatureUnit toUnit = ETemperatureUnit::TU_CEL, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static FText FormatTemperature(double temperature, ETemperatureUnit fromUnit = ETemperatureUnit::TU_CEL, ETemperatureUnit toUnit = ETemperatureUnit::TU_CEL, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
 
 
 
@@ -741,7 +608,7 @@ public:
 	static double ConvertTime(double time, ETimeUnit fromUnit = ETimeUnit::TU_SEC, ETimeUnit toUnit = ETimeUnit::TU_SEC);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
-	static FText FormatTime(double volume, ETimeUnit fromUnit = ETimeUnit::TU_SEC, ETimeUnit toUnit = ETimeUnit::TU_SEC, bool AutoUnit = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static FText FormatTime(double volume, ETimeUnit fromUnit = ETimeUnit::TU_SEC, ETimeUnit toUnit = ETimeUnit::TU_SEC, bool AutoUnit = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
 
 
 
@@ -749,7 +616,7 @@ public:
 	static double ConvertSpeed(double speed, ELengthUnit fromLengthUnit = ELengthUnit::LU_MET_CM, ELengthUnit toLengthUnit = ELengthUnit::LU_MET_CM, ETimeUnit fromTimeUnit = ETimeUnit::TU_SEC, ETimeUnit toTimeUnit = ETimeUnit::TU_SEC);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
-	static FText FormatSpeed(double speed, ELengthUnit fromLengthUnit = ELengthUnit::LU_MET_CM, ELengthUnit toLengthUnit = ELengthUnit::LU_MET_CM, ETimeUnit fromTimeUnit = ETimeUnit::TU_SEC, ETimeUnit toTimeUnit = ETimeUnit::TU_SEC, EAutoUnitType AutoLengthUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static FText FormatSpeed(double speed, ELengthUnit fromLengthUnit = ELengthUnit::LU_MET_CM, ELengthUnit toLengthUnit = ELengthUnit::LU_MET_CM, ETimeUnit fromTimeUnit = ETimeUnit::TU_SEC, ETimeUnit toTimeUnit = ETimeUnit::TU_SEC, EAutoUnitType AutoLengthUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
 
 
 
@@ -757,7 +624,7 @@ public:
 	static double ConvertPressure(double pressure, EPressureUnit fromUnit = EPressureUnit::PU_MET_PA, EPressureUnit toUnit = EPressureUnit::PU_MET_PA);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
-	static FText FormatPressure(double pressure, EPressureUnit fromUnit = EPressureUnit::PU_MET_PA, EPressureUnit toUnit = EPressureUnit::PU_MET_PA, EAutoPressureUnitType AutoUnit = EAutoPressureUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static FText FormatPressure(double pressure, EPressureUnit fromUnit = EPressureUnit::PU_MET_PA, EPressureUnit toUnit = EPressureUnit::PU_MET_PA, EAutoPressureUnitType AutoUnit = EAutoPressureUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
 
 
 
@@ -765,7 +632,7 @@ public:
 	static double ConvertEnergy(double energy, EEnergyUnit fromUnit = EEnergyUnit::EU_J, EEnergyUnit toUnit = EEnergyUnit::EU_J);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
-	static FText FormatEnergy(double energy, EEnergyUnit fromUnit = EEnergyUnit::EU_J, EEnergyUnit toUnit = EEnergyUnit::EU_J, EAutoEnergyUnitType AutoUnit = EAutoEnergyUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static FText FormatEnergy(double energy, EEnergyUnit fromUnit = EEnergyUnit::EU_J, EEnergyUnit toUnit = EEnergyUnit::EU_J, EAutoEnergyUnitType AutoUnit = EAutoEnergyUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
 
 
 
@@ -773,9 +640,254 @@ public:
 	static double ConvertAngle(double angle, EAngleUnit fromUnit = EAngleUnit::AU_DEG, EAngleUnit toUnit = EAngleUnit::AU_DEG);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
-	static FText FormatAngle(double angle, EAngleUnit fromUnit = EAngleUnit::AU_DEG, EAngleUnit toUnit = EAngleUnit::AU_DEG, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static FText FormatAngle(double angle, EAngleUnit fromUnit = EAngleUnit::AU_DEG, EAngleUnit toUnit = EAngleUnit::AU_DEG, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	// --- --- DERIVED --- --- //
+
+	// Units defined as products of the tables above (W = J/s, hp = 550 ft lbf/s, L/min, lb/ft3, g, N m...).
+	// The factor of every unit pair is computed once, a conversion is a table read, a multiply and a divide.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static double ConvertPower(double power, EPowerUnit fromUnit = EPowerUnit::PW_MET_W, EPowerUnit toUnit = EPowerUnit::PW_MET_W);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatPower(double power, EPowerUnit fromUnit = EPowerUnit::PW_MET_W, EPowerUnit toUnit = EPowerUnit::PW_MET_W, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static double ConvertFlow(double flow, EFlowUnit fromUnit = EFlowUnit::FU_MET_L_MIN, EFlowUnit toUnit = EFlowUnit::FU_MET_L_MIN);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatFlow(double flow, EFlowUnit fromUnit = EFlowUnit::FU_MET_L_MIN, EFlowUnit toUnit = EFlowUnit::FU_MET_L_MIN, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static double ConvertDensity(double density, EDensityUnit fromUnit = EDensityUnit::DU_MET_KG_M3, EDensityUnit toUnit = EDensityUnit::DU_MET_KG_M3);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatDensity(double density, EDensityUnit fromUnit = EDensityUnit::DU_MET_KG_M3, EDensityUnit toUnit = EDensityUnit::DU_MET_KG_M3, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static double ConvertAcceleration(double acceleration, EAccelerationUnit fromUnit = EAccelerationUnit::AC_MET_M_S2, EAccelerationUnit toUnit = EAccelerationUnit::AC_MET_M_S2);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatAcceleration(double acceleration, EAccelerationUnit fromUnit = EAccelerationUnit::AC_MET_M_S2, EAccelerationUnit toUnit = EAccelerationUnit::AC_MET_M_S2, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static double ConvertTorque(double torque, ETorqueUnit fromUnit = ETorqueUnit::TQ_MET_N_M, ETorqueUnit toUnit = ETorqueUnit::TQ_MET_N_M);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatTorque(double torque, ETorqueUnit fromUnit = ETorqueUnit::TQ_MET_N_M, ETorqueUnit toUnit = ETorqueUnit::TQ_MET_N_M, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+
+
+	// --- --- DATA --- --- //
+
+	// SI (kB = 1000 B) and IEC (KiB = 1024 B) units. The auto units are picked from the integer byte count with a leading zero
+	// count, TB, PB, TiB, PiB and Tbit are extended auto units. The Int64 versions take exact counts (file sizes, bytes sent...)
+	// and print the exact converted quotient and remainder digits without going through a double, so in fixed notation every
+	// digit shown is exact even past 2^53 bytes. That text follows the current culture when it is made but is not rebuilt when
+	// the culture changes. Significant and engineering notations round the double value.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static double ConvertDataSize(double size, EDataSizeUnit fromUnit = EDataSizeUnit::DS_BYTE, EDataSizeUnit toUnit = EDataSizeUnit::DS_BYTE);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatDataSize(double size, EDataSizeUnit fromUnit = EDataSizeUnit::DS_BYTE, EDataSizeUnit toUnit = EDataSizeUnit::DS_BYTE, EAutoDataUnitType AutoUnit = EAutoDataUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatDataSizeInt64(int64 size, EDataSizeUnit fromUnit = EDataSizeUnit::DS_BYTE, EDataSizeUnit toUnit = EDataSizeUnit::DS_BYTE, EAutoDataUnitType AutoUnit = EAutoDataUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static double ConvertDataRate(double rate, EDataRateUnit fromUnit = EDataRateUnit::DR_BYTE_S, EDataRateUnit toUnit = EDataRateUnit::DR_BYTE_S);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatDataRate(double rate, EDataRateUnit fromUnit = EDataRateUnit::DR_BYTE_S, EDataRateUnit toUnit = EDataRateUnit::DR_BYTE_S, EAutoDataUnitType AutoUnit = EAutoDataUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatDataRateInt64(int64 rate, EDataRateUnit fromUnit = EDataRateUnit::DR_BYTE_S, EDataRateUnit toUnit = EDataRateUnit::DR_BYTE_S, EAutoDataUnitType AutoUnit = EAutoDataUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+
+
+	// --- --- ENGINE UNITS --- --- //
+
+	// Speeds in cm/s, as read from a movement or primitive component's velocity, with factors folded at compile time
+	// instead of the unit pair lookups of ConvertSpeed. Suffixes are km/h, mph, kn and m/s.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static double ConvertEngineSpeed(double speed, EEngineSpeedUnit toUnit = EEngineSpeedUnit::ESU_KM_H);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "2"), Category = "TicTacToe UnitFormat")
+	static FText FormatEngineSpeed(double speed, EEngineSpeedUnit toUnit = EEngineSpeedUnit::ESU_KM_H, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	// Length of the velocity, without its Z component when IgnoreVertical is set
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatEngineVelocity(const FVector& velocity, EEngineSpeedUnit toUnit = EEngineSpeedUnit::ESU_KM_H, bool IgnoreVertical = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	// Engine speed display of a length per time pair, false when the pair has none (e.g. ft/s)
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static bool GetEngineSpeedUnit(ELengthUnit lengthUnit, ETimeUnit timeUnit, EEngineSpeedUnit& engineSpeedUnit);
+
+
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static FText FormatPercentage(double percentage, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+
+
+	// --- --- STABLE WIDTH --- --- //
+
+	// Passing StableWidth to a Format function pads the text to that many characters with figure spaces, so a HUD value
+	// keeps the same width as it changes (9.9km -> 10.0km) and Slate does not re-layout its parents. Works best with a
+	// font that has tabular digits. GetStableWidth is the width to reserve for the family: auto units keep values below
+	// 1000, hence 3 integer digits. For speed, add the length and time suffix widths plus one for the slash.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static int GetStableWidth(EUnitFamily family, int precision = 1, int integerDigits = 3, bool UseGrouping = false);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static int GetStableNumberWidth(int precision = 1, int integerDigits = 3, bool UseGrouping = false);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static int GetStableSuffixWidth(EUnitFamily family);
+
+
+
+	// --- --- CLOCK --- --- //
+
+	// Stateless clock display, empty for non-finite seconds. For timers updated every frame, keep an FTicTacToeRaceTimer instead.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static FText FormatClock(double seconds, EClockFormat format = EClockFormat::CF_MIN_SEC_MS, bool ForceSign = false);
+
+
+
+	// --- --- WIDTH BUDGET --- --- //
+
+	// Fits the value in MaxCharacters, suffix and sign included, for compact slots (minimap markers, table cells...).
+	// Picks the unit of the auto unit ladder (toUnit when AutoUnit is off) and the precision that show the most significant
+	// digits, preferring the regular auto unit on ties. Widths are computed from the decimal exponent, only the final
+	// text is formatted. When nothing fits, the narrowest text is returned.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "4"), Category = "TicTacToe UnitFormat")
+	static FText FormatLengthToWidth(double length, ELengthUnit fromUnit = ELengthUnit::LU_MET_CM, ELengthUnit toUnit = ELengthUnit::LU_MET_M, EAutoUnitType AutoUnit = EAutoUnitType::AUT_MET_AUTO, bool UseExtendedAutoUnits = false, int MaxCharacters = 6, int MaxPrecision = 3, bool ForceSign = false, bool UseGrouping = false);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "4"), Category = "TicTacToe UnitFormat")
+	static FText FormatWeightToWidth(double weight, EWeightUnit fromUnit = EWeightUnit::WU_MET_KG, EWeightUnit toUnit = EWeightUnit::WU_MET_KG, EAutoUnitType AutoUnit = EAutoUnitType::AUT_MET_AUTO, bool UseExtendedAutoUnits = false, int MaxCharacters = 6, int MaxPrecision = 3, bool ForceSign = false, bool UseGrouping = false);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "4"), Category = "TicTacToe UnitFormat")
+	static FText FormatVolumeToWidth(double volume, EVolumeUnit fromUnit = EVolumeUnit::VU_MET_CM3, EVolumeUnit toUnit = EVolumeUnit::VU_MET_CM3, EAutoVolumeUnitType AutoUnit = EAutoVolumeUnitType::AUT_MET_AUTO, bool UseExtendedAutoUnits = false, int MaxCharacters = 6, int MaxPrecision = 3, bool ForceSign = false, bool UseGrouping = false);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "4"), Category = "TicTacToe UnitFormat")
+	static FText FormatAreaToWidth(double area, EAreaUnit fromUnit = EAreaUnit::AU_MET_CM2, EAreaUnit toUnit = EAreaUnit::AU_MET_CM2, EAutoUnitType AutoUnit = EAutoUnitType::AUT_MET_AUTO, bool UseExtendedAutoUnits = false, int MaxCharacters = 6, int MaxPrecision = 3, bool ForceSign = false, bool UseGrouping = false);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "4"), Category = "TicTacToe UnitFormat")
+	static FText FormatTimeToWidth(double time, ETimeUnit fromUnit = ETimeUnit::TU_SEC, ETimeUnit toUnit = ETimeUnit::TU_SEC, bool AutoUnit = true, int MaxCharacters = 6, int MaxPrecision = 3, bool ForceSign = false, bool UseGrouping = false);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "4"), Category = "TicTacToe UnitFormat")
+	static FText FormatPressureToWidth(double pressure, EPressureUnit fromUnit = EPressureUnit::PU_MET_PA, EPressureUnit toUnit = EPressureUnit::PU_MET_PA, EAutoPressureUnitType AutoUnit = EAutoPressureUnitType::AUT_MET_AUTO, bool UseExtendedAutoUnits = false, int MaxCharacters = 6, int MaxPrecision = 3, bool ForceSign = false, bool UseGrouping = false);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "4"), Category = "TicTacToe UnitFormat")
+	static FText FormatEnergyToWidth(double energy, EEnergyUnit fromUnit = EEnergyUnit::EU_J, EEnergyUnit toUnit = EEnergyUnit::EU_J, EAutoEnergyUnitType AutoUnit = EAutoEnergyUnitType::AUT_JOULES, bool UseExtendedAutoUnits = false, int MaxCharacters = 6, int MaxPrecision = 3, bool ForceSign = false, bool UseGrouping = false);
+
+
+
+	// --- --- VECTOR / ROTATOR --- --- //
+
+	// All three components are converted in a single vector register operation.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static FVector ConvertLengthVector(const FVector& length, ELengthUnit fromUnit = ELengthUnit::LU_MET_CM, ELengthUnit toUnit = ELengthUnit::LU_MET_CM);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static FVector ConvertSpeedVector(const FVector& speed, ELengthUnit fromLengthUnit = ELengthUnit::LU_MET_CM, ELengthUnit toLengthUnit = ELengthUnit::LU_MET_CM, ETimeUnit fromTimeUnit = ETimeUnit::TU_SEC, ETimeUnit toTimeUnit = ETimeUnit::TU_SEC);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static FRotator ConvertAngleRotator(const FRotator& angle, EAngleUnit fromUnit = EAngleUnit::AU_DEG, EAngleUnit toUnit = EAngleUnit::AU_DEG);
+
+	// Auto unit is chosen once from the largest component, so every component shares the same unit.
+	// StableWidth and Notation apply to each component, as in FormatLength.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatVector(const FVector& length, ELengthUnit fromUnit = ELengthUnit::LU_MET_CM, ELengthUnit toUnit = ELengthUnit::LU_MET_M, EAutoUnitType AutoUnit = EAutoUnitType::AUT_OFF, bool UseExtendedAutoUnits = false, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatRotator(const FRotator& angle, EAngleUnit fromUnit = EAngleUnit::AU_DEG, EAngleUnit toUnit = EAngleUnit::AU_DEG, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+
+
+	// --- --- FIXED POINT --- --- //
+
+	// Integer-only conversions with exact unit ratios, bit-identical on every platform. See FTicTacToeFixedPoint.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static int64 ConvertLengthFixed(int64 length, bool& Overflow, ELengthUnit fromUnit = ELengthUnit::LU_MET_CM, ELengthUnit toUnit = ELengthUnit::LU_MET_CM, TEnumAsByte<ERoundingMode> RoundingMode = ERoundingMode::HalfToEven);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static bool ConvertLengthFixedArray(UPARAM(ref) TArray<int64>& lengths, ELengthUnit fromUnit = ELengthUnit::LU_MET_CM, ELengthUnit toUnit = ELengthUnit::LU_MET_CM, TEnumAsByte<ERoundingMode> RoundingMode = ERoundingMode::HalfToEven);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static int64 ConvertWeightFixed(int64 weight, bool& Overflow, EWeightUnit fromUnit = EWeightUnit::WU_MET_KG, EWeightUnit toUnit = EWeightUnit::WU_MET_KG, TEnumAsByte<ERoundingMode> RoundingMode = ERoundingMode::HalfToEven);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static bool ConvertWeightFixedArray(UPARAM(ref) TArray<int64>& weights, EWeightUnit fromUnit = EWeightUnit::WU_MET_KG, EWeightUnit toUnit = EWeightUnit::WU_MET_KG, TEnumAsByte<ERoundingMode> RoundingMode = ERoundingMode::HalfToEven);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static int64 ConvertVolumeFixed(int64 volume, bool& Overflow, EVolumeUnit fromUnit = EVolumeUnit::VU_MET_CM3, EVolumeUnit toUnit = EVolumeUnit::VU_MET_CM3, TEnumAsByte<ERoundingMode> RoundingMode = ERoundingMode::HalfToEven);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static bool ConvertVolumeFixedArray(UPARAM(ref) TArray<int64>& volumes, EVolumeUnit fromUnit = EVolumeUnit::VU_MET_CM3, EVolumeUnit toUnit = EVolumeUnit::VU_MET_CM3, TEnumAsByte<ERoundingMode> RoundingMode = ERoundingMode::HalfToEven);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static int64 ConvertAreaFixed(int64 area, bool& Overflow, EAreaUnit fromUnit = EAreaUnit::AU_MET_CM2, EAreaUnit toUnit = EAreaUnit::AU_MET_CM2, TEnumAsByte<ERoundingMode> RoundingMode = ERoundingMode::HalfToEven);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static bool ConvertAreaFixedArray(UPARAM(ref) TArray<int64>& areas, EAreaUnit fromUnit = EAreaUnit::AU_MET_CM2, EAreaUnit toUnit = EAreaUnit::AU_MET_CM2, TEnumAsByte<ERoundingMode> RoundingMode = ERoundingMode::HalfToEven);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static int64 ConvertDataSizeFixed(int64 size, bool& Overflow, EDataSizeUnit fromUnit = EDataSizeUnit::DS_BYTE, EDataSizeUnit toUnit = EDataSizeUnit::DS_BYTE, TEnumAsByte<ERoundingMode> RoundingMode = ERoundingMode::HalfToEven);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static int64 ConvertDataRateFixed(int64 rate, bool& Overflow, EDataRateUnit fromUnit = EDataRateUnit::DR_BYTE_S, EDataRateUnit toUnit = EDataRateUnit::DR_BYTE_S, TEnumAsByte<ERoundingMode> RoundingMode = ERoundingMode::HalfToEven);
+
+
+
+	// --- --- GENERIC --- --- //
+
+	// Family-generic entry points for code that stores units as data. Units are the underlying value of the family's unit enum,
+	// AutoUnit is the family's auto unit enum (EAutoUnitType, EAutoVolumeUnitType, ...) or non-zero for automatic time.
+	static double ConvertUnit(double value, EUnitFamily family, uint8 fromUnit, uint8 toUnit);
+
+	static FText FormatUnit(double value, EUnitFamily family, uint8 fromUnit, uint8 toUnit, uint8 AutoUnit = 0, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	// Value already in the unit of suffix, printed as the Format functions print it. The suffix slot of StableWidth is the family's.
+	static FText FormatValue(double value, const FText& suffix, EUnitFamily family, int precision, bool ForceSign, bool UseGrouping, int StableWidth, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	// Unit the Format functions display the value in once the automatic unit is picked, toUnit when AutoUnit is off
+	static uint8 GetDisplayUnit(double value, EUnitFamily family, uint8 fromUnit, uint8 toUnit, uint8 AutoUnit = 0, bool UseExtendedAutoUnits = false);
+
+	// Every unit the auto unit can pick from, smallest first. Empty when AutoUnit is off.
+	static void GetAutoUnitLadder(EUnitFamily family, uint8 AutoUnit, bool UseExtendedAutoUnits, TArray<uint8, TInlineAllocator<8>>& OutUnits);
+
+	static FText FormatUnitToWidth(double value, EUnitFamily family, uint8 fromUnit, uint8 toUnit, uint8 AutoUnit, bool UseExtendedAutoUnits, int MaxCharacters, int MaxPrecision = 3, bool ForceSign = false, bool UseGrouping = false);
+
+
+
+	// --- --- SI PREFIX --- --- //
+
+	// Works for any base unit (W, Hz, N...), value is in the base unit. Power is the unit dimension, 2 for m2, 3 for m3.
+	// The default prefixes are every power of 1000 from quecto to quetta.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static ESIPrefix SelectSIPrefix(double value, UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/TicTacToeUnitFormat.ESIPrefix")) int32 AllowedPrefixes = 33526783, int32 Power = 1);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	static FText FormatSI(double value, FText unitSymbol, UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/TicTacToeUnitFormat.ESIPrefix")) int32 AllowedPrefixes = 33526783, int32 Power = 1, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED);
+
+	// Prefixes the metric auto units of a family pick from (length, pressure, energy in joules and power).
+	// Prefixes the family has no unit for are dropped, families without metric auto units ignore it.
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static void SetAutoUnitPrefixes(EUnitFamily family, UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/TicTacToeUnitFormat.ESIPrefix")) int32 AllowedPrefixes);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
-	static FText FormatPercentage(double percentage, int precision = 1, bool ForceSign = false, bool UseGrouping = false);
+	static int32 GetAutoUnitPrefixes(EUnitFamily family);
 
 };
\ No newline at end of file
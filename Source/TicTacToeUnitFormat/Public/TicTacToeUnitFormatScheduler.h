@@ -0,0 +1,220 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitFormatScheduler.generated.h"
+
+// What a label displays, same parameters as the Format functions
+USTRUCT(BlueprintType)
+struct TICTACTOEUNITFORMAT_API FTicTacToeFormatRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	double Value = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	EUnitFamily Family = EUnitFamily::UF_LENGTH;
+
+	// Underlying value of the family's unit enum, e.g. (uint8)ELengthUnit::LU_MET_CM
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	uint8 FromUnit = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat", meta = (EditCondition = "!UseUnitPreferences"))
+	uint8 ToUnit = 0;
+
+	// Underlying value of the family's auto unit enum (EAutoUnitType, EAutoVolumeUnitType...), non-zero for automatic time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat", meta = (EditCondition = "!UseUnitPreferences"))
+	uint8 AutoUnit = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat", meta = (EditCondition = "!UseUnitPreferences"))
+	bool UseExtendedAutoUnits = false;
+
+	// Display in the player's units from UTicTacToeUnitPreferenceSubsystem, labels are reformatted when they change
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	bool UseUnitPreferences = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat", meta = (ClampMin = "0"))
+	int32 Precision = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	ENumberNotation Notation = ENumberNotation::NN_FIXED;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	bool ForceSign = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	bool UseGrouping = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	int32 StableWidth = 0;
+
+	// Formats Value, in the player's units when UseUnitPreferences is set and Preferences is not null
+	FText Format(const class UTicTacToeUnitPreferenceSubsystem* Preferences = nullptr) const;
+
+	bool operator==(const FTicTacToeFormatRequest& Other) const
+	{
+		return Value == Other.Value && Family == Other.Family && FromUnit == Other.FromUnit && ToUnit == Other.ToUnit
+			&& AutoUnit == Other.AutoUnit && UseExtendedAutoUnits == Other.UseExtendedAutoUnits && UseUnitPreferences == Other.UseUnitPreferences
+			&& Precision == Other.Precision && Notation == Other.Notation && ForceSign == Other.ForceSign && UseGrouping == Other.UseGrouping && StableWidth == Other.StableWidth;
+	}
+	bool operator!=(const FTicTacToeFormatRequest& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FTicTacToeFormatRequest& Request)
+	{
+		const uint32 Units = uint32(Request.Family) | (uint32(Request.FromUnit) << 8) | (uint32(Request.ToUnit) << 16) | (uint32(Request.AutoUnit) << 24);
+		const uint32 Options = uint32(Request.Precision) | (uint32(Request.StableWidth) << 8) | (uint32(Request.UseExtendedAutoUnits) << 16)
+			| (uint32(Request.UseUnitPreferences) << 17) | (uint32(Request.ForceSign) << 18) | (uint32(Request.UseGrouping) << 19)
+			| (uint32(Request.Notation) << 20);
+		return HashCombine(HashCombine(GetTypeHash(Request.Value), Units), Options);
+	}
+};
+
+// Label registered with UTicTacToeUnitFormatScheduler, stays invalid once the label is released
+USTRUCT(BlueprintType)
+struct TICTACTOEUNITFORMAT_API FTicTacToeFormatHandle
+{
+	GENERATED_BODY()
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	bool operator==(const FTicTacToeFormatHandle& Other) const { return Index == Other.Index && Serial == Other.Serial; }
+
+private:
+
+	friend class UTicTacToeUnitFormatScheduler;
+
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY()
+	uint32 Serial = 0;
+};
+
+DECLARE_DELEGATE_OneParam(FOnTicTacToeLabelFormatted, const FText& /*Text*/);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnTicTacToeLabelFormattedDynamic, const FText&, Text);
+
+/*
+*	Formats large sets of labels (map markers, inventory loads, capacities...) within a per-frame time budget
+*	instead of reformatting all of them in the frame their values change.
+*
+*	Widgets register a label once, then update its request as often as they like: a label is queued at most
+*	once and only its latest request is formatted, and requests identical to one already formatted reuse its
+*	text. Each frame the queue is processed visible labels first, most recently changed first, until the
+*	budget is spent. Results are delivered through the label's callback and kept for GetLabelText.
+*
+*	Labels with UseUnitPreferences are requeued when the player's units change, so switching unit system
+*	spreads the reformat over a few frames rather than hitching.
+*/
+UCLASS()
+class TICTACTOEUNITFORMAT_API UTicTacToeUnitFormatScheduler : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Null outside of a game world, e.g. in the widget designer
+	static UTicTacToeUnitFormatScheduler* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	FTicTacToeFormatHandle RegisterLabel(const FTicTacToeFormatRequest& Request, FOnTicTacToeLabelFormatted OnFormatted = FOnTicTacToeLabelFormatted());
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac", DisplayName = "Register Label", AutoCreateRefTerm = "OnFormatted"), Category = "TicTacToe UnitFormat")
+	FTicTacToeFormatHandle RegisterLabelDynamic(const FTicTacToeFormatRequest& Request, const FOnTicTacToeLabelFormattedDynamic& OnFormatted);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void UpdateLabel(FTicTacToeFormatHandle Handle, const FTicTacToeFormatRequest& Request);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void UpdateLabelValue(FTicTacToeFormatHandle Handle, double Value);
+
+	// Hidden labels are formatted after every visible one, e.g. rows scrolled out of a list
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void SetLabelVisible(FTicTacToeFormatHandle Handle, bool Visible);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void ReleaseLabel(UPARAM(ref) FTicTacToeFormatHandle& Handle);
+
+	// Last formatted text, false until the label is formatted once
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	bool GetLabelText(FTicTacToeFormatHandle Handle, FText& Text) const;
+
+	// True while the label has a request that is not formatted yet
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	bool IsLabelPending(FTicTacToeFormatHandle Handle) const;
+
+	// Formats the label now, outside of the budget, e.g. for a tooltip that just opened
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void FlushLabel(FTicTacToeFormatHandle Handle);
+
+	// Formats every pending label now, e.g. behind a loading screen
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void Flush();
+
+	// Time spent formatting per frame. At least one label is formatted every frame whatever the budget.
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void SetFrameBudget(float Milliseconds) { FrameBudgetMs = FMath::Max(Milliseconds, 0.0f); }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	float GetFrameBudget() const { return FrameBudgetMs; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	int32 GetNumPendingLabels() const { return Pending.Num(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override { return !Pending.IsEmpty(); }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+	virtual TStatId GetStatId() const override;
+
+private:
+
+	struct FLabel
+	{
+		FTicTacToeFormatRequest Request;
+		FText Text;
+		FOnTicTacToeLabelFormatted OnFormatted;
+		FOnTicTacToeLabelFormattedDynamic OnFormattedDynamic;
+		uint64 ChangedFrame = 0;
+		uint32 Serial = 0;
+		bool bVisible = true;
+		bool bPending = false;
+		bool bFormatted = false;
+	};
+
+	FLabel* FindLabel(FTicTacToeFormatHandle Handle);
+	const FLabel* FindLabel(FTicTacToeFormatHandle Handle) const;
+
+	FTicTacToeFormatHandle AddLabel(const FTicTacToeFormatRequest& Request);
+	void Enqueue(int32 Index);
+
+	// Formats a label and returns whether its text changed, the callbacks are left to the caller
+	bool FormatLabel(FLabel& Label);
+
+	// Formats pending labels until the deadline, the whole queue when Deadline is 0
+	void ProcessPending(uint64 Deadline);
+
+	void OnPreferencesChanged();
+
+	TSparseArray<FLabel> Labels;
+	uint32 NextSerial = 1;
+
+	// Sorted lowest priority first and processed from the back, sorted again only after it changed
+	TArray<int32> Pending;
+	bool bPendingSorted = true;
+
+	// Text of recently formatted requests, shared by labels that display the same thing
+	TMap<FTicTacToeFormatRequest, FText> Results;
+
+	float FrameBudgetMs = 0.5f;
+
+	TWeakObjectPtr<class UTicTacToeUnitPreferenceSubsystem> BoundPreferences;
+	FDelegateHandle PreferencesChangedHandle;
+};
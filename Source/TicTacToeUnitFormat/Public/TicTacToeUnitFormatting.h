@@ -4,14 +4,23 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "TicTacToeUnitQuantity.h"
 #include "TicTacToeUnitFormatting.generated.h"
 
 /**
- * 
+ * Blueprint nodes working on unit-tagged values (FTicTacToeQuantity) rather than raw doubles.
  */
 UCLASS()
 class TICTACTOEUNITFORMAT_API UTicTacToeUnitFormatting : public UBlueprintFunctionLibrary
 {
 	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static FText FormatQuantity(const FTicTacToeQuantity& quantity, bool ForceSign = false, bool UseGrouping = false);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	static FTicTacToeQuantity ConvertQuantity(const FTicTacToeQuantity& quantity, uint8 toUnit);
 	
 };
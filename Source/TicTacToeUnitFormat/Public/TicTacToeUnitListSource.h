@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "TicTacToeUnitFormatScheduler.h"
+#include "TicTacToeUnitListSource.generated.h"
+
+DECLARE_MULTICAST_DELEGATE(FOnTicTacToeListSourceInvalidated);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnTicTacToeListSourceInvalidatedDynamic);
+
+/*
+*	Raw values and unit configuration of a list or tile view, formatted only for the rows the view generates.
+*
+*	Each column has a FTicTacToeFormatRequest (its Value is ignored) and one double per row. GetText formats a
+*	cell the first time it is asked for and keeps the texts of the last MaxCachedRows rows that were asked for,
+*	so opening a 50k row list costs the rows on screen, and scrolling back and forth reuses them. Entry widgets
+*	call GetText from OnListItemObjectSet (UMG) or from the row's GenerateWidgetForColumn (Slate).
+*
+*	OnInvalidated fires when texts already handed out are out of date: a column format changed, the values of
+*	a cached row changed, or the player's units changed for a column that uses them. Views regenerate their
+*	entries when it fires, so batch value updates through SetColumnValues rather than SetValue per row.
+*/
+UCLASS(BlueprintType)
+class TICTACTOEUNITFORMAT_API UTicTacToeUnitListSource : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Source whose columns can use the player's units of WorldContextObject's game instance
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac", WorldContext = "WorldContextObject"), Category = "TicTacToe UnitFormat")
+	static UTicTacToeUnitListSource* CreateListSource(UObject* WorldContextObject, int32 MaxCachedRows = 128);
+
+	virtual void BeginDestroy() override;
+
+	// Adds a column of zeros and returns its index
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	int32 AddColumn(const FTicTacToeFormatRequest& Format);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void SetColumnFormat(int32 Column, const FTicTacToeFormatRequest& Format);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	int32 GetNumColumns() const { return Columns.Num(); }
+
+	// New rows are zeros
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void SetNumRows(int32 NumRows);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	int32 GetNumRows() const { return RowCount; }
+
+	// Replaces the values of a column, the row count becomes Values.Num()
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void SetColumnValues(int32 Column, const TArray<double>& Values);
+
+	void SetColumnValues(int32 Column, TArrayView<const double> Values);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void SetValue(int32 Row, int32 Column, double Value);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	double GetValue(int32 Row, int32 Column) const;
+
+	// Text of a cell, formatted now when the row is not cached. Empty for cells out of range.
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	FText GetText(int32 Row, int32 Column);
+
+	// Texts of every column of a row
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void GetRowTexts(int32 Row, TArray<FText>& Texts);
+
+	// Drops every cached text, e.g. after the culture changed
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void Invalidate();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	int32 GetNumCachedRows() const { return CachedRows.Num(); }
+
+	// Native listeners, fired before the Blueprint event
+	FOnTicTacToeListSourceInvalidated& OnInvalidatedNative() { return InvalidatedNative; }
+
+	UPROPERTY(BlueprintAssignable, Category = "TicTacToe UnitFormat")
+	FOnTicTacToeListSourceInvalidatedDynamic OnInvalidated;
+
+private:
+
+	struct FColumn
+	{
+		FTicTacToeFormatRequest Format;
+		TArray<double> Values;
+	};
+
+	// Texts of one row, Texts[Column] is valid when bit Column of Formatted is set
+	struct FCachedRow
+	{
+		int32 Row = INDEX_NONE;
+		uint64 LastUsed = 0;
+		TArray<FText, TInlineAllocator<4>> Texts;
+		TBitArray<TInlineAllocator<1>> Formatted;
+	};
+
+	// Cached row of Row, recycling the least recently used one when the cache is full
+	FCachedRow& FindOrAddCachedRow(int32 Row);
+	void InvalidateRow(int32 Row);
+	void InvalidateColumn(int32 Column);
+
+	void BindUnitPreferences(class UTicTacToeUnitPreferenceSubsystem* Preferences);
+	void UnbindUnitPreferences();
+	void OnPreferencesChanged();
+
+	void BroadcastInvalidated();
+
+	TArray<FColumn> Columns;
+	int32 RowCount = 0;
+
+	TArray<FCachedRow> CachedRows;
+	TMap<int32, int32> CachedRowIndices;
+	uint64 UseCounter = 0;
+	int32 MaxCachedRows = 128;
+
+	TWeakObjectPtr<class UTicTacToeUnitPreferenceSubsystem> BoundPreferences;
+	FDelegateHandle PreferencesChangedHandle;
+
+	FOnTicTacToeListSourceInvalidated InvalidatedNative;
+};
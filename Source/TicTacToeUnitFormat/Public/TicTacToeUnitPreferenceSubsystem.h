@@ -0,0 +1,143 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitPreferenceSubsystem.generated.h"
+
+UENUM(BlueprintType)
+enum class EUnitSystem : uint8
+{
+	US_METRIC				UMETA(DisplayName = "Metric"),
+	US_IMPERIAL_US			UMETA(DisplayName = "Imperial (US)"),
+	US_IMPERIAL_BRIT		UMETA(DisplayName = "Imperial (British)"),
+	US_NAUTICAL				UMETA(DisplayName = "Nautical"),
+};
+
+// Target unit of one family, same meaning as the parameters of the Format functions
+USTRUCT(BlueprintType)
+struct TICTACTOEUNITFORMAT_API FTicTacToeUnitOverride
+{
+	GENERATED_BODY()
+
+	// Underlying value of the family's unit enum, e.g. (uint8)ELengthUnit::LU_MET_KM
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	uint8 ToUnit = 0;
+
+	// Underlying value of the family's auto unit enum (EAutoUnitType, EAutoVolumeUnitType...), non-zero for automatic time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	uint8 AutoUnit = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	bool UseExtendedAutoUnits = false;
+
+	bool operator==(const FTicTacToeUnitOverride& Other) const
+	{
+		return ToUnit == Other.ToUnit && AutoUnit == Other.AutoUnit && UseExtendedAutoUnits == Other.UseExtendedAutoUnits;
+	}
+	bool operator!=(const FTicTacToeUnitOverride& Other) const { return !(*this == Other); }
+};
+
+// What the player picked in the settings menu
+USTRUCT(BlueprintType)
+struct TICTACTOEUNITFORMAT_API FTicTacToeUnitPreferences
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	EUnitSystem UnitSystem = EUnitSystem::US_METRIC;
+
+	// Families displayed differently from the unit system, e.g. metric with Fahrenheit temperatures
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	TMap<EUnitFamily, FTicTacToeUnitOverride> Overrides;
+};
+
+// Resolved display of one family, with the auto unit ladder it can switch between
+struct FTicTacToeResolvedUnit
+{
+	FTicTacToeUnitOverride Unit;
+	TArray<uint8, TInlineAllocator<8>> Ladder;
+};
+
+DECLARE_MULTICAST_DELEGATE(FOnTicTacToeUnitPreferencesChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnTicTacToeUnitPreferencesChangedDynamic);
+
+/*
+*	Owns the player's unit preferences for the game instance.
+*
+*	Target units and auto unit ladders are resolved once per change and cached, so formatting through the
+*	subsystem is a map lookup on top of the library call. Displays bind OnPreferencesChanged and reformat when
+*	it fires instead of reading settings every frame. The event fires once per actual change; ApplyPreferences
+*	sets the system and every override with a single broadcast.
+*
+*	Persistence stays with the game's own settings object, which calls ApplyPreferences after loading.
+*/
+UCLASS()
+class TICTACTOEUNITFORMAT_API UTicTacToeUnitPreferenceSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// Null outside of a game world, e.g. in the widget designer
+	static UTicTacToeUnitPreferenceSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	UFUNCTION(BlueprintCallable, Category = "TicTacToe UnitFormat")
+	void SetUnitSystem(EUnitSystem UnitSystem);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "TicTacToe UnitFormat")
+	EUnitSystem GetUnitSystem() const { return Preferences.UnitSystem; }
+
+	UFUNCTION(BlueprintCallable, Category = "TicTacToe UnitFormat")
+	void SetFamilyOverride(EUnitFamily family, FTicTacToeUnitOverride Override);
+
+	UFUNCTION(BlueprintCallable, Category = "TicTacToe UnitFormat")
+	void ClearFamilyOverride(EUnitFamily family);
+
+	UFUNCTION(BlueprintCallable, Category = "TicTacToe UnitFormat")
+	void ApplyPreferences(const FTicTacToeUnitPreferences& InPreferences);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "TicTacToe UnitFormat")
+	FTicTacToeUnitPreferences GetPreferences() const { return Preferences; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "TicTacToe UnitFormat")
+	FTicTacToeUnitOverride GetFamilyUnit(EUnitFamily family) const;
+
+	// Length and time unit speeds are displayed in: km/h, mph or knots
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "TicTacToe UnitFormat")
+	void GetSpeedUnits(ELengthUnit& LengthUnit, ETimeUnit& TimeUnit) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	FText Format(double value, EUnitFamily family, uint8 fromUnit, int precision = 1, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac", AdvancedDisplay = "3"), Category = "TicTacToe UnitFormat")
+	FText FormatSpeed(double speed, ELengthUnit fromLengthUnit = ELengthUnit::LU_MET_CM, ETimeUnit fromTimeUnit = ETimeUnit::TU_SEC, int precision = 0, bool ForceSign = false, bool UseGrouping = false, int StableWidth = 0, ENumberNotation Notation = ENumberNotation::NN_FIXED) const;
+
+	const FTicTacToeResolvedUnit& GetResolvedUnit(EUnitFamily family) const;
+
+	// Native listeners, fired before the Blueprint event
+	FOnTicTacToeUnitPreferencesChanged& OnPreferencesChangedNative() { return PreferencesChangedNative; }
+
+	UPROPERTY(BlueprintAssignable, Category = "TicTacToe UnitFormat")
+	FOnTicTacToeUnitPreferencesChangedDynamic OnPreferencesChanged;
+
+	// Default unit of a family in a unit system
+	static FTicTacToeUnitOverride GetSystemUnit(EUnitSystem UnitSystem, EUnitFamily family);
+
+private:
+
+	// Resolves every family from Preferences and broadcasts when any of them changed
+	void ResolveAndBroadcast();
+
+	FTicTacToeUnitPreferences Preferences;
+
+	TMap<EUnitFamily, FTicTacToeResolvedUnit> Resolved;
+	ELengthUnit SpeedLengthUnit = ELengthUnit::LU_MET_KM;
+	ETimeUnit SpeedTimeUnit = ETimeUnit::TU_HR;
+
+	FOnTicTacToeUnitPreferencesChanged PreferencesChangedNative;
+};
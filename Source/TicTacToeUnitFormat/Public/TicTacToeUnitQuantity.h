@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+#include "TicTacToeUnitQuantity.generated.h"
+
+/*
+*	A value tagged with its unit, meant to be replicated instead of a raw double plus separate enum bytes.
+*
+*	On the wire the family, unit and precision are packed into 14 bits, and the value is quantized to
+*	Precision fractional digits and sent as a zigzag variable-length integer. Values that cannot be
+*	quantized (non finite, or too large for the precision) fall back to the full double.
+*
+*	Two quantities are Identical when they display the same. Property replication compares against the last
+*	sent state with Identical, so an unchanged quantity, or a change smaller than the display precision,
+*	is not sent at all.
+*/
+USTRUCT(BlueprintType)
+struct TICTACTOEUNITFORMAT_API FTicTacToeQuantity
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	double Value = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	EUnitFamily Family = EUnitFamily::UF_LENGTH;
+
+	// Underlying value of the family's unit enum, e.g. (uint8)EWeightUnit::WU_MET_KG
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat")
+	uint8 Unit = 0;
+
+	// Fractional digits kept when replicating, usually the precision the value is displayed with
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TicTacToe UnitFormat", meta = (ClampMin = "0", ClampMax = "7"))
+	uint8 Precision = 1;
+
+	static constexpr int32 FamilyBits = 4;
+	static constexpr int32 UnitBits = 6;
+	static constexpr int32 PrecisionBits = 3;
+	static constexpr uint8 MaxPrecision = (1 << PrecisionBits) - 1;
+
+	FTicTacToeQuantity() = default;
+
+	FTicTacToeQuantity(double InValue, EUnitFamily InFamily, uint8 InUnit, uint8 InPrecision = 1)
+		: Value(InValue), Family(InFamily), Unit(InUnit), Precision(FMath::Min(InPrecision, MaxPrecision))
+	{
+	}
+
+	// Value scaled by 10^Precision and rounded half to even, false when it does not fit the variable-length encoding
+	bool GetQuantizedValue(int64& OutQuantized) const;
+
+	double ConvertTo(uint8 ToUnit) const;
+
+	FText ToText(bool ForceSign = false, bool UseGrouping = false) const;
+
+	bool Identical(const FTicTacToeQuantity* Other, uint32 PortFlags) const;
+
+	// Fails on a family or unit that does not exist, so a corrupt or hostile packet cannot produce one
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+private:
+
+	uint32 PackHeader() const;
+	bool UnpackHeader(uint32 Header);
+};
+
+template<>
+struct TStructOpsTypeTraits<FTicTacToeQuantity> : public TStructOpsTypeTraitsBase2<FTicTacToeQuantity>
+{
+	enum
+	{
+		WithIdentical = true,
+		WithNetSerializer = true,
+		WithNetSharedSerialization = true,
+	};
+};
@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TicTacToeUnitFormatBPLibrary.h"
+
+/*
+*	Clock display (mm:ss.fff, hh:mm:ss...) for lap and split timers updated every frame.
+*
+*	Input is integer FTimespan ticks, truncated to the last digit shown as race clocks do. The timer keeps its
+*	character buffer between updates and only rewrites the trailing digits that changed, walking the mixed
+*	radix digits from the least significant one and stopping as soon as the remaining higher part is unchanged.
+*	The layout is rebuilt only when the sign or the number of leading digits changes.
+*
+*	Reading the buffer (GetView, CopyTo) never allocates. ToText builds an FText only when the buffer changed.
+*	Separators are culture invariant.
+*/
+struct TICTACTOEUNITFORMAT_API FTicTacToeRaceTimer
+{
+	explicit FTicTacToeRaceTimer(EClockFormat InFormat = EClockFormat::CF_MIN_SEC_MS, bool bInForceSign = false);
+
+	// Index of the first character that changed, 0 when the layout was rebuilt, INDEX_NONE when nothing changed
+	int32 Update(int64 Ticks);
+
+	int32 Update(const FTimespan& Time) { return Update(Time.GetTicks()); }
+
+	// Non-finite seconds change nothing and return INDEX_NONE, larger values than FTimespan can hold are clamped
+	int32 UpdateSeconds(double Seconds);
+
+	// Forces the next update to rebuild the whole buffer
+	void Reset() { bValid = false; }
+
+	FStringView GetView() const { return FStringView(Buffer, Length); }
+
+	const TCHAR* GetData() const { return Buffer; }
+
+	int32 Len() const { return Length; }
+
+	// Copies at most Destination.Num() - 1 characters and a null terminator. Returns the number of characters copied.
+	int32 CopyTo(TArrayView<TCHAR> Destination) const;
+
+	const FText& ToText() const;
+
+private:
+
+	void Layout(int32 InTopDigits, bool bInNegative);
+
+	static constexpr int32 MaxLength = 32;
+	static constexpr int32 MaxDigits = 28;
+
+	EClockFormat Format;
+	bool bForceSign;
+
+	// Ticks per unit of the last digit, and units per unit of the leading field
+	int64 TicksPerUnit = 1;
+	uint64 UnitsPerTopUnit = 1;
+
+	TCHAR Buffer[MaxLength + 1];
+	int32 Length = 0;
+
+	// Least significant digit first
+	uint8 DigitPositions[MaxDigits];
+	uint8 DigitRadices[MaxDigits];
+	int32 NumDigits = 0;
+
+	int32 TopDigits = 0;
+	uint64 PreviousUnits = 0;
+	bool bNegative = false;
+	bool bValid = false;
+
+	mutable FText CachedText;
+	mutable bool bTextDirty = true;
+};
@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "STicTacToeUnitReadout.h"
+#include "TicTacToeUnitReadout.generated.h"
+
+/*
+*	UMG wrapper of STicTacToeUnitReadout, a numeric readout that draws cached glyphs instead of shaping new text
+*	every time the value changes. Call SetValue every frame rather than binding a text.
+*/
+UCLASS()
+class TICTACTOEUNITFORMAT_API UTicTacToeUnitReadout : public UWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	UTicTacToeUnitReadout();
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	double Value = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	EUnitFamily Family = EUnitFamily::UF_LENGTH;
+
+	// Underlying value of the family's unit enum, e.g. (uint8)ELengthUnit::LU_MET_CM
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	uint8 FromUnit = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (EditCondition = "!UseUnitPreferences"))
+	uint8 ToUnit = 0;
+
+	// Underlying value of the family's auto unit enum (EAutoUnitType, EAutoVolumeUnitType...), non-zero for automatic time
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (EditCondition = "!UseUnitPreferences"))
+	uint8 AutoUnit = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (EditCondition = "!UseUnitPreferences"))
+	bool UseExtendedAutoUnits = false;
+
+	// Display in the player's units from UTicTacToeUnitPreferenceSubsystem, and reformat when they change.
+	// ToUnit, AutoUnit and ToTimeUnit are used where there is no game instance, e.g. in the designer.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	bool UseUnitPreferences = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (ClampMin = "0"))
+	int32 Precision = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	bool ForceSign = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	bool UseGrouping = false;
+
+	// Characters of number and suffix together, padded with figure spaces so the text keeps its width. 0 to disable.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (ClampMin = "0"))
+	int32 StableWidth = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	ENumberNotation Notation = ENumberNotation::NN_FIXED;
+
+	// Length only: the value is a speed in FromUnit per FromTimeUnit, displayed per ToTimeUnit
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	bool PerTime = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (EditCondition = "PerTime"))
+	ETimeUnit FromTimeUnit = ETimeUnit::TU_SEC;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (EditCondition = "PerTime"))
+	ETimeUnit ToTimeUnit = ETimeUnit::TU_SEC;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Appearance")
+	FSlateFontInfo Font;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Appearance")
+	FSlateColor ColorAndOpacity = FSlateColor(FLinearColor::White);
+
+	UFUNCTION(BlueprintCallable, Category = "TicTacToe UnitFormat")
+	void SetValue(double InValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Appearance")
+	void SetFont(FSlateFontInfo InFont);
+
+	UFUNCTION(BlueprintCallable, Category = "Appearance")
+	void SetColorAndOpacity(FSlateColor InColorAndOpacity);
+
+	// Applies the unit and formatting properties after changing them at runtime
+	UFUNCTION(BlueprintCallable, Category = "TicTacToe UnitFormat")
+	void UpdateFormat();
+
+	virtual void SynchronizeProperties() override;
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+#if WITH_EDITOR
+	virtual const FText GetPaletteCategory() override;
+#endif
+
+protected:
+
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+	FTicTacToeReadoutFormat MakeFormat() const;
+
+	void BindUnitPreferences();
+	void UnbindUnitPreferences();
+
+	TSharedPtr<STicTacToeUnitReadout> MyReadout;
+
+	TWeakObjectPtr<class UTicTacToeUnitPreferenceSubsystem> BoundPreferences;
+	FDelegateHandle PreferencesChangedHandle;
+};
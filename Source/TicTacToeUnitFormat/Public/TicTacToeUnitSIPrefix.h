@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TicTacToeUnitSIPrefix.generated.h"
+
+// Every SI prefix, smallest first. Values are bit indices so a set of prefixes fits in an int32 mask.
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "false"))
+enum class ESIPrefix : uint8
+{
+	SI_QUECTO				UMETA(DisplayName = "quecto (q, 1e-30)"),
+	SI_RONTO				UMETA(DisplayName = "ronto (r, 1e-27)"),
+	SI_YOCTO				UMETA(DisplayName = "yocto (y, 1e-24)"),
+	SI_ZEPTO				UMETA(DisplayName = "zepto (z, 1e-21)"),
+	SI_ATTO					UMETA(DisplayName = "atto (a, 1e-18)"),
+	SI_FEMTO				UMETA(DisplayName = "femto (f, 1e-15)"),
+	SI_PICO					UMETA(DisplayName = "pico (p, 1e-12)"),
+	SI_NANO					UMETA(DisplayName = "nano (n, 1e-9)"),
+	SI_MICRO				UMETA(DisplayName = "micro (u, 1e-6)"),
+	SI_MILLI				UMETA(DisplayName = "milli (m, 1e-3)"),
+	SI_CENTI				UMETA(DisplayName = "centi (c, 1e-2)"),
+	SI_DECI					UMETA(DisplayName = "deci (d, 1e-1)"),
+	SI_NONE					UMETA(DisplayName = "none"),
+	SI_DECA					UMETA(DisplayName = "deca (da, 1e1)"),
+	SI_HECTO				UMETA(DisplayName = "hecto (h, 1e2)"),
+	SI_KILO					UMETA(DisplayName = "kilo (k, 1e3)"),
+	SI_MEGA					UMETA(DisplayName = "mega (M, 1e6)"),
+	SI_GIGA					UMETA(DisplayName = "giga (G, 1e9)"),
+	SI_TERA					UMETA(DisplayName = "tera (T, 1e12)"),
+	SI_PETA					UMETA(DisplayName = "peta (P, 1e15)"),
+	SI_EXA					UMETA(DisplayName = "exa (E, 1e18)"),
+	SI_ZETTA				UMETA(DisplayName = "zetta (Z, 1e21)"),
+	SI_YOTTA				UMETA(DisplayName = "yotta (Y, 1e24)"),
+	SI_RONNA				UMETA(DisplayName = "ronna (R, 1e27)"),
+	SI_QUETTA				UMETA(DisplayName = "quetta (Q, 1e30)"),
+};
+
+/*
+*	Picks an SI prefix for a value in constant time.
+*
+*	The decimal exponent is estimated from the binary exponent of the double (e2 * log10(2) as a fixed-point
+*	multiply) and corrected with a single compare against a power of ten table. The prefix is then a clamp plus
+*	a bit scan over the whitelist mask, so the cost is the same for every value and every set of prefixes.
+*
+*	Power is the dimension of the unit the prefix applies to: 2 for square meters (1 km2 = 1e6 m2), 3 for cubic meters.
+*/
+struct TICTACTOEUNITFORMAT_API FTicTacToeSIPrefix
+{
+	static constexpr int32 Mask(ESIPrefix Prefix) { return 1 << int32(Prefix); }
+
+	// Every prefix, and only the ones that are a power of 1000 (plus none)
+	static constexpr int32 AllPrefixes = (1 << (int32(ESIPrefix::SI_QUETTA) + 1)) - 1;
+	static constexpr int32 EngineeringPrefixes = AllPrefixes & ~((1 << int32(ESIPrefix::SI_CENTI)) | (1 << int32(ESIPrefix::SI_DECI)) | (1 << int32(ESIPrefix::SI_DECA)) | (1 << int32(ESIPrefix::SI_HECTO)));
+
+	// floor(log10(|Value|)). Zero and non finite values give MIN_int32.
+	static int32 GetDecimalExponent(double Value);
+
+	// Largest allowed prefix that keeps |Value| >= 1 in the prefixed unit, or the smallest allowed prefix when none does.
+	// Values are in the base unit. SI_NONE when AllowedPrefixes is empty.
+	static ESIPrefix Select(double Value, int32 AllowedPrefixes = EngineeringPrefixes, int32 Power = 1);
+
+	static int32 GetExponent(ESIPrefix Prefix);
+
+	// 10^(Exponent * Power), the size of one prefixed unit in base units
+	static double GetScale(ESIPrefix Prefix, int32 Power = 1);
+
+	static const FText& GetSymbol(ESIPrefix Prefix);
+
+	// Correctly rounded 10^Exponent, from a table for the usual range
+	static double GetPowerOfTen(int32 Exponent);
+};
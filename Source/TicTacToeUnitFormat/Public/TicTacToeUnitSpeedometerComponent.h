@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "TicTacToeUnitAffine.h"
+#include "TicTacToeUnitSpeedometerComponent.generated.h"
+
+class UTextBlock;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTicTacToeSpeedTextChanged, const FText& /*Text*/);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTicTacToeSpeedTextChangedDynamic, const FText&, Text);
+
+/*
+*	Speedometer of its owner, sampled and formatted without any Blueprint running per tick.
+*
+*	The component ticks SampleRate times per second after physics, reads the velocity of the velocity source
+*	(the owner's root component by default, whose velocity movement components and simulated bodies keep up to
+*	date) and converts it with a transform composed once per unit change. The text is only rebuilt when the
+*	displayed value changes, the speed rounded to Precision fractional digits as the text rounds it: cruising at
+*	87.4 km/h formats nothing. A new text is pushed to the bound text block and OnSpeedTextChanged fires.
+*
+*	With UseUnitPreferences the speed follows the player's speed units and is reformatted when they change.
+*	Speed units without an engine display (ft/s, m/min...) are formatted through FormatSpeed instead.
+*/
+UCLASS(ClassGroup = "TicTacToe UnitFormat", meta = (BlueprintSpawnableComponent))
+class TICTACTOEUNITFORMAT_API UTicTacToeUnitSpeedometerComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UTicTacToeUnitSpeedometerComponent();
+
+	// Samples per second, 0 samples every frame
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (ClampMin = "0"))
+	float SampleRate = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (EditCondition = "!UseUnitPreferences"))
+	EEngineSpeedUnit Unit = EEngineSpeedUnit::ESU_KM_H;
+
+	// Display in the player's speed units from UTicTacToeUnitPreferenceSubsystem, and reformat when they change.
+	// Unit is used where there is no game instance.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	bool UseUnitPreferences = false;
+
+	// Ground speed, the Z component of the velocity is ignored
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	bool IgnoreVertical = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (ClampMin = "0", ClampMax = "15"))
+	int32 Precision = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat")
+	bool UseGrouping = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TicTacToe UnitFormat", meta = (ClampMin = "0"))
+	int32 StableWidth = 0;
+
+	// Component whose velocity is sampled, the owner's root component when null
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void SetVelocitySource(USceneComponent* Source);
+
+	// Text block the speed text is set on when it changes, null to unbind
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void BindTextBlock(UTextBlock* TextBlock);
+
+	// Applies the unit, sampling and formatting properties after changing them at runtime, and reformats
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	void UpdateFormat();
+
+	// Last sampled speed in the display unit
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	double GetSpeed() const { return Speed; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "TicTac"), Category = "TicTacToe UnitFormat")
+	FText GetSpeedText() const { return SpeedText; }
+
+	// Native listeners, fired before the Blueprint event
+	FOnTicTacToeSpeedTextChanged& OnSpeedTextChangedNative() { return SpeedTextChangedNative; }
+
+	UPROPERTY(BlueprintAssignable, Category = "TicTacToe UnitFormat")
+	FOnTicTacToeSpeedTextChangedDynamic OnSpeedTextChanged;
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+
+	// Samples the velocity and reformats when the displayed value changed, or always when bForce is set
+	void Sample(bool bForce);
+
+	FText MakeSpeedText(double EngineSpeed) const;
+
+	void BindUnitPreferences();
+	void UnbindUnitPreferences();
+
+	UPROPERTY()
+	TWeakObjectPtr<USceneComponent> VelocitySource;
+
+	UPROPERTY()
+	TWeakObjectPtr<UTextBlock> BoundTextBlock;
+
+	// Display unit, an engine speed display when bEngineSpeed is set, a length per time pair otherwise
+	bool bEngineSpeed = true;
+	EEngineSpeedUnit EngineSpeedUnit = EEngineSpeedUnit::ESU_KM_H;
+	ELengthUnit LengthUnit = ELengthUnit::LU_MET_KM;
+	ETimeUnit TimeUnit = ETimeUnit::TU_HR;
+
+	// cm/s to the display unit
+	FTicTacToeAffineTransform ToDisplay;
+
+	// 10^Precision, the displayed value is the speed in steps of 1 / StepScale
+	double StepScale = 1.0;
+	double DisplayedSteps = -1.0;
+
+	double Speed = 0.0;
+	FText SpeedText;
+
+	TWeakObjectPtr<class UTicTacToeUnitPreferenceSubsystem> BoundPreferences;
+	FDelegateHandle PreferencesChangedHandle;
+
+	FOnTicTacToeSpeedTextChanged SpeedTextChangedNative;
+};
@@ -26,6 +26,12 @@ public class TicTacToeUnitFormat : ModuleRules
 			new string[]
 			{
 				"Core",
+				"CoreUObject",
+				"DeveloperSettings",
+				"Engine",
+				"Slate",
+				"SlateCore",
+				"UMG",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -34,10 +40,6 @@ public class TicTacToeUnitFormat : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
-				"CoreUObject",
-				"Engine",
-				"Slate",
-				"SlateCore",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -0,0 +1,153 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitLabelProcessor.h"
+#include "MassExecutionContext.h"
+#include "TicTacToeUnitAffine.h"
+#include "TicTacToeUnitBatch.h"
+#include "TicTacToeUnitPreferenceSubsystem.h"
+
+namespace TicTacToeUnitLabel
+{
+	// Display units a chunk can use, the longest auto ladder is well below this
+	static constexpr int32 MaxUnits = 64;
+
+	static uint64 GetDisplayedValue(double Value, double Scale)
+	{
+		// Same rounding as the number formatting, values that print the same digits share a key
+		const double Rounded = FMath::RoundHalfToEven(Value * Scale);
+
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &Rounded, sizeof(Bits));
+		return Bits;
+	}
+
+	// Significant and engineering digits depend on the magnitude, the key is the rounded value itself
+	static uint64 GetDisplayedValue(double Value, ENumberNotation Notation, int32 Digits)
+	{
+		const int32 RoundingExponent = TicTacToeUnitCore::GetNotationDigits(Value, (TicTacToeUnitCore::ENotation)Notation, Digits).RoundingExponent;
+		const double Rounded = FMath::RoundHalfToEven(Value * FTicTacToeSIPrefix::GetPowerOfTen(-RoundingExponent)) * FTicTacToeSIPrefix::GetPowerOfTen(RoundingExponent);
+
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &Rounded, sizeof(Bits));
+		return Bits;
+	}
+}
+
+UTicTacToeUnitLabelProcessor::UTicTacToeUnitLabelProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = int32(EProcessorExecutionFlags::Client | EProcessorExecutionFlags::Standalone);
+	ProcessingPhase = EMassProcessingPhase::PostPhysics;
+
+	// Text formatting reads the current culture
+	bRequiresGameThreadExecution = true;
+}
+
+void UTicTacToeUnitLabelProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FTicTacToeUnitValueFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FTicTacToeUnitLabelFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FTicTacToeUnitLabelFormatFragment>();
+}
+
+void UTicTacToeUnitLabelProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_TicTacToeUnitLabelProcessor);
+
+	const UTicTacToeUnitPreferenceSubsystem* Preferences = UTicTacToeUnitPreferenceSubsystem::Get(EntityManager.GetWorld());
+
+	NumProcessed = 0;
+	NumFormatted = 0;
+
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [this, Preferences](FMassExecutionContext& Context)
+	{
+		const FTicTacToeUnitLabelFormatFragment& Format = Context.GetConstSharedFragment<FTicTacToeUnitLabelFormatFragment>();
+		const TConstArrayView<FTicTacToeUnitValueFragment> Values = Context.GetFragmentView<FTicTacToeUnitValueFragment>();
+		const TArrayView<FTicTacToeUnitLabelFragment> Labels = Context.GetMutableFragmentView<FTicTacToeUnitLabelFragment>();
+
+		NumProcessed += Values.Num();
+		NumFormatted += UpdateLabels(Format.Format, Preferences, Values, Labels);
+	});
+}
+
+int32 UTicTacToeUnitLabelProcessor::UpdateLabels(const FTicTacToeFormatRequest& Format, const UTicTacToeUnitPreferenceSubsystem* Preferences,
+	TConstArrayView<FTicTacToeUnitValueFragment> Values, TArrayView<FTicTacToeUnitLabelFragment> Labels)
+{
+	using namespace TicTacToeUnitLabel;
+	using Library = UTicTacToeUnitFormatBPLibrary;
+
+	const int32 Num = FMath::Min(Values.Num(), Labels.Num());
+	if (Num == 0) return 0;
+
+	// Target of the whole chunk, resolved once
+	FTicTacToeFormatRequest Target = Format;
+	Target.Value = 0.0;
+	if (Format.UseUnitPreferences && Preferences)
+	{
+		const FTicTacToeUnitOverride& Unit = Preferences->GetResolvedUnit(Format.Family).Unit;
+		Target.ToUnit = Unit.ToUnit;
+		Target.AutoUnit = Unit.AutoUnit;
+		Target.UseExtendedAutoUnits = Unit.UseExtendedAutoUnits;
+	}
+	const double Scale = FTicTacToeSIPrefix::GetPowerOfTen(FMath::Max(Target.Precision, 0));
+
+	TArray<double, TInlineAllocator<256>> Input;
+	TArray<double, TInlineAllocator<256>> Converted;
+	Input.SetNumUninitialized(Num);
+	Converted.SetNumUninitialized(Num);
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		Input[Index] = Values[Index].Value;
+	}
+
+	// Without an auto unit every entity is displayed in ToUnit, otherwise the ladder works from canonical values
+	const bool bAuto = Target.AutoUnit != 0;
+	const uint8 ConvertedUnit = bAuto ? FTicTacToeUnitBatch::GetCanonicalUnit(Target.Family) : Target.ToUnit;
+	if (const FTicTacToeAffineTransform* Transform = FTicTacToeAffine::Find(Target.Family, Target.FromUnit, ConvertedUnit))
+	{
+		FTicTacToeAffine::Apply(Input, *Transform, Converted);
+	}
+	else
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Converted[Index] = Library::ConvertUnit(Input[Index], Target.Family, Target.FromUnit, ConvertedUnit);
+		}
+	}
+
+	// Transforms from FromUnit to each display unit met in the chunk
+	const FTicTacToeAffineTransform* UnitTransforms[MaxUnits] = {};
+
+	int32 NumFormatted = 0;
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		uint8 DisplayUnit = Target.ToUnit;
+		double Displayed = Converted[Index];
+		if (bAuto)
+		{
+			DisplayUnit = Library::GetDisplayUnit(Converted[Index], Target.Family, ConvertedUnit, Target.ToUnit, Target.AutoUnit, Target.UseExtendedAutoUnits);
+
+			const FTicTacToeAffineTransform* Transform = DisplayUnit < MaxUnits ? UnitTransforms[DisplayUnit] : nullptr;
+			if (!Transform)
+			{
+				Transform = FTicTacToeAffine::Find(Target.Family, Target.FromUnit, DisplayUnit);
+				if (DisplayUnit < MaxUnits) UnitTransforms[DisplayUnit] = Transform;
+			}
+			Displayed = Transform ? Transform->Apply(Input[Index]) : Library::ConvertUnit(Input[Index], Target.Family, Target.FromUnit, DisplayUnit);
+		}
+
+		FTicTacToeUnitLabelFragment& Label = Labels[Index];
+		const uint64 DisplayedValue = Target.Notation == ENumberNotation::NN_FIXED ? GetDisplayedValue(Displayed, Scale) : GetDisplayedValue(Displayed, Target.Notation, Target.Precision);
+		if (Label.bFormatted && Label.DisplayedValue == DisplayedValue && Label.DisplayUnit == DisplayUnit && Label.DisplayedFormat == Target) continue;
+
+		// Converted again by FormatUnit from the original value, so the text is the one the library would give
+		Label.Text = Library::FormatUnit(Input[Index], Target.Family, Target.FromUnit, DisplayUnit, 0, Target.Precision, Target.ForceSign, Target.UseGrouping, Target.StableWidth, Target.Notation);
+		Label.DisplayedValue = DisplayedValue;
+		Label.DisplayUnit = DisplayUnit;
+		Label.DisplayedFormat = Target;
+		Label.bFormatted = true;
+		++Label.Revision;
+		++NumFormatted;
+	}
+	return NumFormatted;
+}
@@ -0,0 +1,141 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitMassBenchmarkCommandlet.h"
+#include "TicTacToeUnitLabelProcessor.h"
+#include "MassEntityManager.h"
+#include "MassExecutor.h"
+#include "MassProcessingTypes.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTicTacToeUnitMassBenchmark, Log, All);
+
+namespace TicTacToeUnitMassBenchmark
+{
+	struct FScenario
+	{
+		const TCHAR* Name = TEXT("");
+		double Seconds = 0.0;
+		int64 Processed = 0;
+		int64 Formatted = 0;
+		int32 Frames = 0;
+	};
+
+	static void Report(int32 NumEntities, const FScenario& Scenario)
+	{
+		if (Scenario.Frames == 0) return;
+
+		UE_LOG(LogTicTacToeUnitMassBenchmark, Display, TEXT("%7d entities  %-10s  %8.3f ms/frame  %7.1f M entities/s  %9.1f reformatted/frame"),
+			NumEntities, Scenario.Name, Scenario.Seconds * 1000.0 / Scenario.Frames,
+			Scenario.Processed / FMath::Max(Scenario.Seconds, UE_DOUBLE_SMALL_NUMBER) / 1000000.0, double(Scenario.Formatted) / Scenario.Frames);
+	}
+}
+
+UTicTacToeUnitMassBenchmarkCommandlet::UTicTacToeUnitMassBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UTicTacToeUnitMassBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace TicTacToeUnitMassBenchmark;
+
+	FString EntitiesSpec = TEXT("10000,100000");
+	int32 NumFrames = 120;
+	float MovingShare = 0.25f;
+	FParse::Value(*Params, TEXT("entities="), EntitiesSpec, false);
+	FParse::Value(*Params, TEXT("frames="), NumFrames);
+	FParse::Value(*Params, TEXT("moving="), MovingShare);
+	NumFrames = FMath::Max(NumFrames, 1);
+	MovingShare = FMath::Clamp(MovingShare, 0.0f, 1.0f);
+
+	TArray<FString> Counts;
+	EntitiesSpec.ParseIntoArray(Counts, TEXT(","));
+	if (Counts.IsEmpty())
+	{
+		UE_LOG(LogTicTacToeUnitMassBenchmark, Error, TEXT("-entities= needs a comma separated list of entity counts"));
+		return 1;
+	}
+
+	FTicTacToeUnitLabelFormatFragment Format;
+	Format.Format.Family = EUnitFamily::UF_LENGTH;
+	Format.Format.FromUnit = (uint8)ELengthUnit::LU_MET_CM;
+	Format.Format.ToUnit = (uint8)ELengthUnit::LU_MET_M;
+	Format.Format.AutoUnit = (uint8)EAutoUnitType::AUT_MET_AUTO;
+	Format.Format.Precision = 1;
+
+	for (const FString& Count : Counts)
+	{
+		const int32 NumEntities = FCString::Atoi(*Count);
+		if (NumEntities <= 0) continue;
+
+		TSharedRef<FMassEntityManager> EntityManager = MakeShareable(new FMassEntityManager());
+		EntityManager->Initialize();
+
+		const FMassArchetypeHandle Archetype = EntityManager->CreateArchetype({ FTicTacToeUnitValueFragment::StaticStruct(), FTicTacToeUnitLabelFragment::StaticStruct() });
+
+		FMassArchetypeSharedFragmentValues SharedValues;
+		SharedValues.AddConstSharedFragment(EntityManager->GetOrCreateConstSharedFragment(Format));
+		SharedValues.Sort();
+
+		TArray<FMassEntityHandle> Entities;
+		EntityManager->BatchCreateEntities(Archetype, SharedValues, NumEntities, Entities);
+
+		// Same seed for every count, so runs compare
+		FRandomStream Random(NumEntities);
+		for (const FMassEntityHandle Entity : Entities)
+		{
+			EntityManager->GetFragmentDataChecked<FTicTacToeUnitValueFragment>(Entity).Value = Random.FRandRange(0.0f, 500000.0f);
+		}
+
+		UTicTacToeUnitLabelProcessor* Processor = NewObject<UTicTacToeUnitLabelProcessor>(GetTransientPackage());
+		Processor->CallInitialize(GetTransientPackage());
+
+		FMassProcessingContext ProcessingContext(EntityManager, 1.0f / 60.0f);
+		auto RunFrame = [&](FScenario& Scenario)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			UE::Mass::Executor::Run(*Processor, ProcessingContext);
+			Scenario.Seconds += FPlatformTime::Seconds() - StartTime;
+			Scenario.Processed += Processor->GetNumProcessed();
+			Scenario.Formatted += Processor->GetNumFormatted();
+			++Scenario.Frames;
+		};
+
+		FScenario Initial{ TEXT("initial") };
+		FScenario Moving{ TEXT("moving") };
+		FScenario Jumping{ TEXT("jumping") };
+		FScenario Still{ TEXT("still") };
+
+		RunFrame(Initial);
+
+		const int32 NumMoving = FMath::RoundToInt32(NumEntities * MovingShare);
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const bool bJump = Frame % 10 == 9;
+			const int32 NumChanged = bJump ? NumEntities : NumMoving;
+			for (int32 Index = 0; Index < NumChanged; ++Index)
+			{
+				const FMassEntityHandle Entity = bJump ? Entities[Index] : Entities[Random.RandHelper(NumEntities)];
+				double& Value = EntityManager->GetFragmentDataChecked<FTicTacToeUnitValueFragment>(Entity).Value;
+				Value = FMath::Max(Value + (bJump ? Random.FRandRange(-100000.0f, 100000.0f) : Random.FRandRange(-5.0f, 5.0f)), 0.0);
+			}
+
+			RunFrame(bJump ? Jumping : Moving);
+		}
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			RunFrame(Still);
+		}
+
+		Report(NumEntities, Initial);
+		Report(NumEntities, Moving);
+		Report(NumEntities, Jumping);
+		Report(NumEntities, Still);
+	}
+
+	return 0;
+}
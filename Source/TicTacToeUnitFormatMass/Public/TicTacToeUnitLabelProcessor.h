@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "TicTacToeUnitMassFragments.h"
+#include "TicTacToeUnitLabelProcessor.generated.h"
+
+/*
+*	Keeps FTicTacToeUnitLabelFragment::Text in step with FTicTacToeUnitValueFragment for every entity that has
+*	a FTicTacToeUnitLabelFormatFragment (distance to the player, cargo mass...).
+*
+*	A chunk shares its format, so its values are copied to a contiguous buffer and converted with the 4-wide
+*	FTicTacToeAffine kernel, to the fixed unit or to the family's canonical unit when the format picks an auto
+*	unit. Each entity then gets a display key: its display unit, its value rounded to the displayed precision
+*	and the format it was displayed with. Only entities whose key differs from the one of their current text
+*	are formatted, a distance that moves by less than the displayed precision is not reformatted.
+*
+*	Formats with UseUnitPreferences follow the player's units of the world's game instance.
+*/
+UCLASS()
+class TICTACTOEUNITFORMATMASS_API UTicTacToeUnitLabelProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+
+	UTicTacToeUnitLabelProcessor();
+
+	// Updates the labels of one chunk and returns the number of labels whose text was formatted
+	static int32 UpdateLabels(const FTicTacToeFormatRequest& Format, const class UTicTacToeUnitPreferenceSubsystem* Preferences,
+		TConstArrayView<FTicTacToeUnitValueFragment> Values, TArrayView<FTicTacToeUnitLabelFragment> Labels);
+
+	// Counts of the last Execute, for profiling
+	int32 GetNumProcessed() const { return NumProcessed; }
+	int32 GetNumFormatted() const { return NumFormatted; }
+
+protected:
+
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery EntityQuery;
+
+	int32 NumProcessed = 0;
+	int32 NumFormatted = 0;
+};
@@ -0,0 +1,28 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "TicTacToeUnitMassBenchmarkCommandlet.generated.h"
+
+/*
+*	Throughput of UTicTacToeUnitLabelProcessor on a standalone entity manager.
+*
+*	UnrealEditor-Cmd <Project> -run=TicTacToeUnitMassBenchmark [-entities=10000,100000] [-frames=120] [-moving=0.25]
+*
+*	Labels are distances in centimeters displayed in automatic metric units. For each entity count the first
+*	frame formats every label, then each frame moves a -moving share of the entities by a few centimeters and
+*	one frame in ten moves all of them by up to a kilometer. Reported per scenario: mean frame time, entities
+*	processed per second and labels reformatted per frame.
+*/
+UCLASS()
+class UTicTacToeUnitMassBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UTicTacToeUnitMassBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "TicTacToeUnitFormatScheduler.h"
+#include "TicTacToeUnitMassFragments.generated.h"
+
+// Value a label displays, in the FromUnit of the entity's FTicTacToeUnitLabelFormatFragment
+USTRUCT()
+struct TICTACTOEUNITFORMATMASS_API FTicTacToeUnitValueFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "TicTacToe UnitFormat")
+	double Value = 0.0;
+};
+
+// How the labels of a group of entities are formatted, shared so a chunk is converted with a single transform.
+// Format.Value is ignored.
+USTRUCT()
+struct TICTACTOEUNITFORMATMASS_API FTicTacToeUnitLabelFormatFragment : public FMassConstSharedFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "TicTacToe UnitFormat")
+	FTicTacToeFormatRequest Format;
+};
+
+// Formatted text of an entity, rewritten only when the text it would show changes
+USTRUCT()
+struct TICTACTOEUNITFORMATMASS_API FTicTacToeUnitLabelFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "TicTacToe UnitFormat")
+	FText Text;
+
+	// Bumped every time Text changes, label renderers compare it with the revision they last drew
+	UPROPERTY(VisibleAnywhere, Category = "TicTacToe UnitFormat")
+	uint32 Revision = 0;
+
+	// Display key of Text: unit, value rounded to the displayed precision, and the resolved format itself (its Value is 0),
+	// compared field by field so two formats can never be mistaken for one another
+	FTicTacToeFormatRequest DisplayedFormat;
+	uint64 DisplayedValue = 0;
+	uint8 DisplayUnit = 0;
+	bool bFormatted = false;
+};
@@ -0,0 +1,205 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TicTacToeUnitCore.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+namespace Core = TicTacToeUnitCore;
+
+namespace TicTacToeUnitCoreTest
+{
+	double ConvertLength(double Value, Core::ELength From, Core::ELength To)
+	{
+		return Core::Convert(Core::GetFactors(Core::EFamily::Length), Value, uint8_t(From), uint8_t(To));
+	}
+}
+
+using namespace TicTacToeUnitCoreTest;
+
+// --- --- CONVERSIONS --- --- //
+
+TEST(Conversion, TablesCoverEveryUnit)
+{
+	EXPECT_EQ(Core::GetFactors(Core::EFamily::Length).size(), size_t(Core::ELength::Count));
+	EXPECT_EQ(Core::GetFactors(Core::EFamily::Weight).size(), size_t(Core::EWeight::Count));
+	EXPECT_EQ(Core::GetFactors(Core::EFamily::Volume).size(), size_t(Core::EVolume::Count));
+	EXPECT_EQ(Core::GetFactors(Core::EFamily::Area).size(), size_t(Core::EArea::Count));
+	EXPECT_EQ(Core::GetFactors(Core::EFamily::Time).size(), size_t(Core::ETime::Count));
+	// Gauge pressures have an offset, they are converted through the affine transforms and not the factor table
+	EXPECT_EQ(Core::GetFactors(Core::EFamily::Pressure).size(), size_t(Core::EPressure::MET_BARG));
+	EXPECT_EQ(Core::GetFactors(Core::EFamily::Energy).size(), size_t(Core::EEnergy::Count));
+	EXPECT_EQ(Core::GetFactors(Core::EFamily::Angle).size(), size_t(Core::EAngle::Count));
+	EXPECT_EQ(Core::GetFactors(Core::EFamily::DataSize).size(), size_t(Core::EDataSize::Count));
+	EXPECT_TRUE(Core::GetFactors(Core::EFamily::Temperature).empty());
+}
+
+TEST(Conversion, Linear)
+{
+	EXPECT_DOUBLE_EQ(ConvertLength(1.0, Core::ELength::US_INCH, Core::ELength::MET_CM), 2.54);
+	EXPECT_DOUBLE_EQ(ConvertLength(1.0, Core::ELength::US_MILE, Core::ELength::MET_M), 1609.344);
+	EXPECT_DOUBLE_EQ(ConvertLength(1.0, Core::ELength::BRIT_NMI, Core::ELength::MET_M), 1852.0);
+	EXPECT_DOUBLE_EQ(ConvertLength(3.0, Core::ELength::US_FOOT, Core::ELength::US_YARD), 1.0);
+	EXPECT_EQ(ConvertLength(1.0, Core::ELength::MET_KM, Core::ELength::MET_M), 1000.0);
+
+	EXPECT_EQ(Core::Convert(Core::TimeToS, 1.0, uint8_t(Core::ETime::HR), uint8_t(Core::ETime::SEC)), 3600.0);
+	EXPECT_EQ(Core::Convert(Core::DataSizeToByte, 1.0, uint8_t(Core::EDataSize::KIB), uint8_t(Core::EDataSize::BYTE)), 1024.0);
+	EXPECT_EQ(Core::Convert(Core::DataSizeToByte, 1.0, uint8_t(Core::EDataSize::BYTE), uint8_t(Core::EDataSize::BIT)), 8.0);
+	EXPECT_DOUBLE_EQ(Core::Convert(Core::PressureToPa, 1.0, uint8_t(Core::EPressure::MET_BAR), uint8_t(Core::EPressure::MET_KPA)), 100.0);
+}
+
+TEST(Conversion, OutOfRangeUnitIsZero)
+{
+	EXPECT_EQ(Core::Convert(Core::LengthToM, 1.0, uint8_t(Core::ELength::Count), uint8_t(Core::ELength::MET_M)), 0.0);
+	EXPECT_EQ(Core::Convert(Core::LengthToM, 1.0, uint8_t(Core::ELength::MET_M), 255), 0.0);
+	EXPECT_EQ(Core::ConvertEngineSpeed(100.0, Core::EEngineSpeed::Count), 0.0);
+}
+
+TEST(Conversion, Temperature)
+{
+	EXPECT_EQ(Core::ConvertTemperature(100.0, Core::ETemperature::CEL, Core::ETemperature::FAR), 212.0);
+	EXPECT_EQ(Core::ConvertTemperature(-40.0, Core::ETemperature::CEL, Core::ETemperature::FAR), -40.0);
+	EXPECT_EQ(Core::ConvertTemperature(-40.0, Core::ETemperature::FAR, Core::ETemperature::CEL), -40.0);
+	EXPECT_EQ(Core::ConvertTemperature(0.0, Core::ETemperature::CEL, Core::ETemperature::KEL), 273.15);
+	EXPECT_EQ(Core::ConvertTemperature(0.0, Core::ETemperature::KEL, Core::ETemperature::FAR), -459.67);
+	EXPECT_EQ(Core::ConvertTemperature(21.5, Core::ETemperature::CEL, Core::ETemperature::CEL), 21.5);
+}
+
+TEST(Conversion, TemperatureRoundTrip)
+{
+	for (int32_t Celsius = -273; Celsius <= 5000; ++Celsius)
+	{
+		const double Fahrenheit = Core::ConvertTemperature(Celsius, Core::ETemperature::CEL, Core::ETemperature::FAR);
+		ASSERT_EQ(Core::ConvertTemperature(Fahrenheit, Core::ETemperature::FAR, Core::ETemperature::CEL), double(Celsius)) << Celsius;
+	}
+}
+
+TEST(Conversion, EngineSpeed)
+{
+	EXPECT_EQ(Core::ConvertEngineSpeed(100.0, Core::EEngineSpeed::KM_H), 3.6);
+	EXPECT_EQ(Core::ConvertEngineSpeed(100.0, Core::EEngineSpeed::M_S), 1.0);
+	EXPECT_DOUBLE_EQ(Core::ConvertEngineSpeed(160934.4 / 3600.0, Core::EEngineSpeed::MI_H), 1.0);
+	EXPECT_DOUBLE_EQ(Core::ConvertEngineSpeed(185200.0 / 3600.0, Core::EEngineSpeed::KN), 1.0);
+}
+
+// --- --- AUTO UNITS --- --- //
+
+TEST(AutoUnits, Length)
+{
+	EXPECT_EQ(Core::GetAutoLength(0.005, Core::EAutoSystem::Metric), Core::ELength::MET_MM);
+	EXPECT_EQ(Core::GetAutoLength(5.0, Core::EAutoSystem::Metric), Core::ELength::MET_M);
+	EXPECT_EQ(Core::GetAutoLength(5000.0, Core::EAutoSystem::Metric), Core::ELength::MET_KM);
+	EXPECT_EQ(Core::GetAutoLength(-5000.0, Core::EAutoSystem::Metric), Core::ELength::MET_KM);
+}
+
+TEST(AutoUnits, DataSize)
+{
+	EXPECT_EQ(Core::GetAutoDataSize(uint64_t(999), Core::EAutoData::Decimal, false), Core::EDataSize::BYTE);
+	EXPECT_EQ(Core::GetAutoDataSize(uint64_t(1000), Core::EAutoData::Decimal, false), Core::EDataSize::KB);
+	EXPECT_EQ(Core::GetAutoDataSize(uint64_t(1023), Core::EAutoData::Binary, false), Core::EDataSize::BYTE);
+	EXPECT_EQ(Core::GetAutoDataSize(uint64_t(1024), Core::EAutoData::Binary, false), Core::EDataSize::KIB);
+	EXPECT_EQ(Core::GetAutoDataSize(uint64_t(125), Core::EAutoData::DecimalBits, false), Core::EDataSize::KBIT);
+	EXPECT_EQ(Core::GetAutoDataSize(uint64_t(1) << 50, Core::EAutoData::Decimal, false), Core::EDataSize::GB);
+	EXPECT_EQ(Core::GetAutoDataSize(uint64_t(1) << 50, Core::EAutoData::Decimal, true), Core::EDataSize::PB);
+	EXPECT_EQ(Core::GetAutoDataSize(-2048.0, Core::EAutoData::Binary, false), Core::EDataSize::KIB);
+	EXPECT_EQ(Core::GetAutoDataSize(std::numeric_limits<double>::quiet_NaN(), Core::EAutoData::Decimal, false), Core::EDataSize::BYTE);
+}
+
+TEST(AutoUnits, SelectPrefix)
+{
+	EXPECT_EQ(Core::SelectPrefix(0.0), Core::EPrefix::Quecto);
+	EXPECT_EQ(Core::SelectPrefix(999.0), Core::EPrefix::None);
+	EXPECT_EQ(Core::SelectPrefix(1000.0), Core::EPrefix::Kilo);
+	EXPECT_EQ(Core::SelectPrefix(-0.02), Core::EPrefix::Milli);
+	EXPECT_EQ(Core::SelectPrefix(0.02, Core::AllPrefixes), Core::EPrefix::Centi);
+	EXPECT_EQ(Core::SelectPrefix(1e6, Core::EngineeringPrefixes, 2), Core::EPrefix::Kilo);
+	EXPECT_EQ(Core::SelectPrefix(1e6, 0), Core::EPrefix::None);
+}
+
+TEST(AutoUnits, DecimalExponent)
+{
+	EXPECT_EQ(Core::GetDecimalExponent(0.0), INT32_MIN);
+	EXPECT_EQ(Core::GetDecimalExponent(std::numeric_limits<double>::infinity()), INT32_MIN);
+	EXPECT_EQ(Core::GetDecimalExponent(1.0), 0);
+	EXPECT_EQ(Core::GetDecimalExponent(9.999999999999999), 0);
+	EXPECT_EQ(Core::GetDecimalExponent(10.0), 1);
+	EXPECT_EQ(Core::GetDecimalExponent(-0.001), -3);
+	EXPECT_EQ(Core::GetDecimalExponent(std::numeric_limits<double>::denorm_min()), -324);
+	EXPECT_EQ(Core::GetDecimalExponent(std::numeric_limits<double>::max()), 308);
+
+	for (int32_t Exponent = Core::MinPowerOfTen; Exponent <= Core::MaxPowerOfTen; ++Exponent)
+	{
+		ASSERT_EQ(Core::GetDecimalExponent(Core::GetPowerOfTen(Exponent)), Exponent);
+	}
+}
+
+// --- --- FORMATTING --- --- //
+
+TEST(Formatting, Fixed)
+{
+	EXPECT_EQ(Core::FormatNumber(1234567.891, 2), "1234567.89");
+	EXPECT_EQ(Core::FormatNumber(1234567.891, 2, false, true), "1,234,567.89");
+	EXPECT_EQ(Core::FormatNumber(1.5, 3), "1.5");
+	EXPECT_EQ(Core::FormatNumber(1.5, 3, false, false, 3), "1.500");
+	EXPECT_EQ(Core::FormatNumber(2.0, 2), "2");
+	EXPECT_EQ(Core::FormatNumber(5.0, 0, true), "+5");
+	EXPECT_EQ(Core::FormatNumber(-123.0, 0, false, true), "-123");
+}
+
+TEST(Formatting, RoundsOnceTiesToEven)
+{
+	EXPECT_EQ(Core::FormatNumber(0.5, 0), "0");
+	EXPECT_EQ(Core::FormatNumber(1.5, 0), "2");
+	EXPECT_EQ(Core::FormatNumber(2.5, 0), "2");
+	EXPECT_EQ(Core::FormatNumber(0.125, 2), "0.12");
+	// 1.005 is 1.00499999999999989... in binary
+	EXPECT_EQ(Core::FormatNumber(1.005, 2), "1");
+}
+
+TEST(Formatting, ZeroHasNoSign)
+{
+	EXPECT_EQ(Core::FormatNumber(-0.0, 2), "0");
+	EXPECT_EQ(Core::FormatNumber(-0.001, 2), "0");
+	EXPECT_EQ(Core::FormatNumber(-0.001, 2, true), "+0");
+}
+
+TEST(Formatting, NonFinite)
+{
+	EXPECT_EQ(Core::FormatNumber(std::numeric_limits<double>::quiet_NaN(), 2), "nan");
+	EXPECT_EQ(Core::FormatNumber(std::numeric_limits<double>::infinity(), 2), "inf");
+	EXPECT_EQ(Core::FormatNumber(std::numeric_limits<double>::infinity(), 2, true), "+inf");
+	EXPECT_EQ(Core::FormatNumber(-std::numeric_limits<double>::infinity(), 2), "-inf");
+}
+
+TEST(Formatting, Significant)
+{
+	EXPECT_EQ(Core::FormatNumber(0.000123456, Core::ENotation::Significant, 3), "0.000123");
+	EXPECT_EQ(Core::FormatNumber(123456.7, Core::ENotation::Significant, 3), "123000");
+	EXPECT_EQ(Core::FormatNumber(9.996, Core::ENotation::Significant, 3), "10.0");
+	EXPECT_EQ(Core::FormatNumber(1.0, Core::ENotation::Significant, 3), "1.00");
+	EXPECT_EQ(Core::FormatNumber(0.0, Core::ENotation::Significant, 3), "0.00");
+}
+
+TEST(Formatting, SignificantFallsBackToExponent)
+{
+	// 18 fractional digits at most, past that the engineering exponent takes over
+	EXPECT_EQ(Core::FormatNumber(1.23e-16, Core::ENotation::Significant, 3), "0.000000000000000123");
+	EXPECT_EQ(Core::FormatNumber(1.23e-17, Core::ENotation::Significant, 3), "12.3e-18");
+	EXPECT_EQ(Core::FormatNumber(-4.5e-300, Core::ENotation::Significant, 2), "-4.5e-300");
+
+	for (int32_t Exponent = -320; Exponent <= 300; Exponent += 7)
+	{
+		const Core::FNotationDigits Digits = Core::GetNotationDigits(1.2345 * Core::GetPowerOfTen(Exponent), Core::ENotation::Significant, 17);
+		ASSERT_LE(Digits.FractionalDigits, Core::MaxNotationFractionalDigits) << Exponent;
+	}
+}
+
+TEST(Formatting, Engineering)
+{
+	EXPECT_EQ(Core::FormatNumber(0.000123456, Core::ENotation::Engineering, 3), "123e-6");
+	EXPECT_EQ(Core::FormatNumber(123456.7, Core::ENotation::Engineering, 3), "123e3");
+	EXPECT_EQ(Core::FormatNumber(999.96, Core::ENotation::Engineering, 4), "1.000e3");
+	EXPECT_EQ(Core::FormatNumber(-4.7e-9, Core::ENotation::Engineering, 2), "-4.7e-9");
+	EXPECT_EQ(Core::FormatNumber(12.0, Core::ENotation::Engineering, 3), "12.0");
+}